@@ -24,6 +24,8 @@
 
 #include <memory>
 #include <chrono>
+#include <map>
+#include <string>
 #include <unordered_map>
 #include <cstdint>
 #include <optional>
@@ -34,6 +36,8 @@ namespace hive
 {
 namespace modelsLibrary
 {
+class DescriptorSignaler;
+
 class ControllerManager : public QObject
 {
 	Q_OBJECT
@@ -54,6 +58,46 @@ public:
 	using StreamInputErrorCounters = std::unordered_map<la::avdecc::entity::StreamInputCounterValidFlag, la::avdecc::entity::model::DescriptorCounter>;
 	using StatisticsErrorCounters = std::unordered_map<StatisticsErrorCounterFlag, std::uint64_t>;
 
+	/** Kind of change accumulated for an entity between two coalesced notifications */
+	enum class EntityChangeFlag : std::uint32_t
+	{
+		Online = 1u << 0,
+		Offline = 1u << 1,
+		EntityInfo = 1u << 2, /**< Capabilities, AssociationID, Compatibility, Unsolicited Registration, Identification */
+		AccessState = 1u << 3, /**< Acquire and Lock states */
+		Gptp = 1u << 4,
+		Names = 1u << 5, /**< Any descriptor name */
+		Configuration = 1u << 6, /**< Sampling rate, clock source, control values, media clock chain and reference info, max transit time, system unique ID */
+		StreamFormat = 1u << 7,
+		StreamInfo = 1u << 8, /**< Stream dynamic info and running state */
+		Connections = 1u << 9,
+		AudioMappings = 1u << 10,
+		AvbInterface = 1u << 11, /**< AvbInterface info, AsPath, link status and redundant interfaces */
+		Counters = 1u << 12,
+		Statistics = 1u << 13,
+		Diagnostics = 1u << 14,
+		Operations = 1u << 15, /**< MemoryObject length and operations progress */
+	};
+	using EntityChangeFlags = la::avdecc::utils::EnumBitfield<EntityChangeFlag>;
+	using EntitiesChangedBatch = std::unordered_map<la::avdecc::UniqueIdentifier, EntityChangeFlags, la::avdecc::UniqueIdentifier::hash>;
+
+	/** Statistics of a kind of controller notification, between the thread it originates from and the manager's thread */
+	struct EventPipelineStatistic
+	{
+		std::uint64_t queuedCount{ 0u }; /**< Number of notifications received from the controller */
+		std::uint64_t deliveredCount{ 0u }; /**< Number of notifications processed by the manager's thread (queuedCount - deliveredCount is the queue depth) */
+		std::chrono::microseconds p50Latency{}; /**< Median delivery latency */
+		std::chrono::microseconds p99Latency{}; /**< 99th percentile delivery latency */
+		std::chrono::microseconds maxLatency{}; /**< Maximum delivery latency */
+	};
+	using EventPipelineStatistics = std::map<std::string, EventPipelineStatistic>;
+
+	enum class ReplaySpeed
+	{
+		RealTime = 0, /**< Events are replayed with the same timing they were recorded with */
+		Maximum = 1, /**< Events are replayed as fast as possible (the event loop still runs between batches of events) */
+	};
+
 	enum class AecpCommandType
 	{
 		None = 0,
@@ -219,6 +263,49 @@ public:
 	virtual void setEnableFullAemEnumeration(bool const enable) noexcept = 0;
 	virtual bool isFullAemEnumerationEnabled() const noexcept = 0;
 
+	/**
+	* @brief Enable/Disable coalesced notifications.
+	* @details When enabled, every controller notification marks the entity as dirty (from the network thread) and all changes accumulated
+	*          during flushInterval are delivered at once (in the GUI thread) through the entitiesChangedBatch signal.
+	*          Fine-grained signals are still emitted, whether coalesced notifications are enabled or not.
+	*/
+	virtual void setEnableCoalescedNotifications(bool const enable, std::chrono::milliseconds const flushInterval = std::chrono::milliseconds{ 16 }) noexcept = 0;
+	virtual bool isCoalescedNotificationsEnabled() const noexcept = 0;
+
+	/**
+	* @brief Enable/Disable event pipeline instrumentation.
+	* @details When enabled, every controller notification is timestamped when received and the time it takes to be delivered in
+	*          the manager's thread (where the queued signals are processed) is measured, per kind of notification.
+	*          Disabling the instrumentation does not reset the statistics.
+	*/
+	virtual void setEnableEventPipelineInstrumentation(bool const enable) noexcept = 0;
+	virtual bool isEventPipelineInstrumentationEnabled() const noexcept = 0;
+	virtual EventPipelineStatistics getEventPipelineStatistics() const noexcept = 0;
+	virtual void resetEventPipelineStatistics() noexcept = 0;
+
+	/**
+	* @brief Record controller events to a file.
+	* @details The current network state is stored at the beginning of the file, then every controller notification is appended with its
+	*          timestamp and payload, as delivered through the signals of this class. Recording stops when the controller is destroyed.
+	*          Control values, media clock chain and diagnostics notifications are recorded without their payload: their replay re-emits the
+	*          values currently in the entity model, intermediate values are not reproduced.
+	*          Returns false if the file cannot be created or a recording is already in progress.
+	*/
+	virtual bool startEventsRecording(QString const& filePath) noexcept = 0;
+	virtual void stopEventsRecording() noexcept = 0;
+	virtual bool isRecordingEvents() const noexcept = 0;
+
+	/**
+	* @brief Replay a file previously recorded with startEventsRecording.
+	* @details The recorded network state is loaded as virtual entities in the current controller, then every event is emitted again through
+	*          the signals of this class (entities going online/offline are loaded/unloaded as virtual entities). Meant to be used with a
+	*          controller not attached to a live network (eg. the Virtual interface). eventsReplayFinished is emitted once all events have been replayed.
+	*          Returns false (and sets errorMessage) if the file cannot be read or a replay is already in progress.
+	*/
+	virtual bool startEventsReplay(QString const& filePath, ReplaySpeed const speed, QString& errorMessage) noexcept = 0;
+	virtual void stopEventsReplay() noexcept = 0;
+	virtual bool isReplayingEvents() const noexcept = 0;
+
 	/** Identify entity */
 	virtual void identifyEntity(la::avdecc::UniqueIdentifier const targetEntityID, std::chrono::milliseconds const duration, IdentifyEntityHandler const& resultHandler = {}) noexcept = 0;
 
@@ -320,14 +407,26 @@ public:
 	using ControlledEntityCallback = std::function<void(la::avdecc::UniqueIdentifier const&, la::avdecc::controller::ControlledEntity const&)>;
 	virtual void foreachEntity(ControlledEntityCallback const& callback) noexcept = 0;
 
+	/**
+	* @brief Gets the DescriptorSignaler for the specified descriptor, creating it if needed.
+	* @details The returned DescriptorSignaler only emits the notifications targeting (entityID, descriptorType, descriptorIndex), in the manager's thread.
+	*          Use DescriptorType::Entity and index 0 for entity level notifications (entity counters, statistics, diagnostics).
+	*          The signaler stays registered as long as a reference to it is held.
+	* @note Must be called from the manager's thread (GUI thread).
+	*/
+	using SharedDescriptorSignaler = std::shared_ptr<DescriptorSignaler>;
+	virtual SharedDescriptorSignaler getDescriptorSignaler(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::DescriptorType const descriptorType, la::avdecc::entity::model::DescriptorIndex const descriptorIndex) noexcept = 0;
+
 	/* Static methods */
 	static QString typeToString(AecpCommandType const type) noexcept;
 	static QString typeToString(MilanCommandType const type) noexcept;
 	static QString typeToString(AcmpCommandType const type) noexcept;
+	static QByteArray eventPipelineStatisticsToJson(EventPipelineStatistics const& statistics) noexcept;
 
 	/* Controller signals */
 	Q_SIGNAL void controllerOnline();
 	Q_SIGNAL void controllerOffline();
+	Q_SIGNAL void eventsReplayFinished(std::uint64_t const eventsCount);
 
 	/* Entity changed signals */
 	Q_SIGNAL void transportError();
@@ -383,6 +482,9 @@ public:
 	Q_SIGNAL void systemUniqueIDChanged(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::SystemUniqueIdentifier const systemUniqueID);
 	Q_SIGNAL void mediaClockReferenceInfoChanged(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::MediaClockReferenceInfo const& info);
 
+	/* Coalesced notifications signal (only emitted when coalesced notifications are enabled) */
+	Q_SIGNAL void entitiesChangedBatch(hive::modelsLibrary::ControllerManager::EntitiesChangedBatch const& changes);
+
 	/* Connection changed signals */
 	Q_SIGNAL void streamInputConnectionChanged(la::avdecc::entity::model::StreamIdentification const& stream, la::avdecc::entity::model::StreamInputConnectionInfo const& info);
 	Q_SIGNAL void streamOutputConnectionsChanged(la::avdecc::entity::model::StreamIdentification const& stream, la::avdecc::entity::model::StreamConnections const& connections);
@@ -416,5 +518,42 @@ public:
 	Q_SIGNAL void controlCurrentValueOutOfBoundsChanged(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ControlIndex const controlIndex, bool const isValueOutOfBounds);
 };
 
+/** Targeted signals for a single (entityID, descriptorType, descriptorIndex), as returned by ControllerManager::getDescriptorSignaler */
+class DescriptorSignaler : public QObject
+{
+	Q_OBJECT
+public:
+	/* Entity level signals (DescriptorType::Entity) */
+	Q_SIGNAL void entityCountersChanged(la::avdecc::entity::model::EntityCounters const& counters);
+	Q_SIGNAL void aecpRetryCounterChanged(std::uint64_t const value);
+	Q_SIGNAL void aecpTimeoutCounterChanged(std::uint64_t const value);
+	Q_SIGNAL void aecpUnexpectedResponseCounterChanged(std::uint64_t const value);
+	Q_SIGNAL void aecpResponseAverageTimeChanged(std::chrono::milliseconds const& value);
+	Q_SIGNAL void aemAecpUnsolicitedCounterChanged(std::uint64_t const value);
+	Q_SIGNAL void aemAecpUnsolicitedLossCounterChanged(std::uint64_t const value);
+	Q_SIGNAL void mvuAecpUnsolicitedCounterChanged(std::uint64_t const value);
+	Q_SIGNAL void mvuAecpUnsolicitedLossCounterChanged(std::uint64_t const value);
+	Q_SIGNAL void statisticsErrorCounterChanged(hive::modelsLibrary::ControllerManager::StatisticsErrorCounters const& errorCounters);
+	Q_SIGNAL void diagnosticsChanged(la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics);
+
+	/* AvbInterface signals (DescriptorType::AvbInterface) */
+	Q_SIGNAL void avbInterfaceCountersChanged(la::avdecc::entity::model::AvbInterfaceCounters const& counters);
+
+	/* ClockDomain signals (DescriptorType::ClockDomain) */
+	Q_SIGNAL void clockDomainCountersChanged(la::avdecc::entity::model::ClockDomainCounters const& counters);
+
+	/* StreamInput signals (DescriptorType::StreamInput) */
+	Q_SIGNAL void streamInputCountersChanged(la::avdecc::entity::model::StreamInputCounters const& counters);
+	Q_SIGNAL void streamInputErrorCounterChanged(hive::modelsLibrary::ControllerManager::StreamInputErrorCounters const& errorCounters);
+	Q_SIGNAL void streamInputConnectionChanged(la::avdecc::entity::model::StreamInputConnectionInfo const& info);
+	Q_SIGNAL void streamInputLatencyErrorChanged(bool const isLatencyError);
+
+	/* StreamOutput signals (DescriptorType::StreamOutput) */
+	Q_SIGNAL void streamOutputCountersChanged(la::avdecc::entity::model::StreamOutputCounters const& counters);
+
+	/* Control signals (DescriptorType::Control) */
+	Q_SIGNAL void controlCurrentValueOutOfBoundsChanged(bool const isValueOutOfBounds);
+};
+
 } // namespace modelsLibrary
 } // namespace hive
@@ -186,5 +186,20 @@ private:
 	friend class DiscoveredEntitiesModel;
 };
 
+/** Minimal DiscoveredEntities proxy without any column, for headless uses (daemon, benchmarks) where only the computed entity information is required */
+class HeadlessDiscoveredEntitiesModel final : public DiscoveredEntitiesAbstractTableModel
+{
+public:
+	DiscoveredEntitiesModel const& model() const noexcept;
+
+private:
+	// QAbstractTableModel overrides
+	virtual int rowCount(QModelIndex const& parent = {}) const override;
+	virtual int columnCount(QModelIndex const& parent = {}) const override;
+	virtual QVariant data(QModelIndex const& index, int role) const override;
+
+	DiscoveredEntitiesModel _model{ this };
+};
+
 } // namespace modelsLibrary
 } // namespace hive
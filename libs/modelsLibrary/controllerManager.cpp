@@ -18,13 +18,29 @@
 */
 
 #include "commandsExecutorImpl.hpp"
+#include "eventLog.hpp"
+#include "eventPipelineMonitor.hpp"
 #include "virtualController.hpp"
 #include "hive/modelsLibrary/controllerManager.hpp"
 
 #include <la/avdecc/logger.hpp>
 
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryFile>
+#include <QThreadPool>
+#include <QTimer>
+
+#include <array>
 #include <atomic>
+#include <deque>
+#include <functional>
+#include <optional>
 #include <thread>
+#include <mutex>
+#include <vector>
 
 #if __cpp_lib_experimental_atomic_smart_pointers
 #	define HAVE_ATOMIC_SMART_POINTERS
@@ -42,6 +58,15 @@ public:
 
 	class EntityDataCache
 	{
+	public:
+		// Counters that have been cleared, the caller is responsible for notifying the change (once the cache has been published)
+		struct ClearedCounters
+		{
+			bool statistics{ false };
+			std::vector<la::avdecc::entity::model::StreamIndex> streamInputs{};
+		};
+
+	private:
 		class InitVisitor : public la::avdecc::controller::model::DefaultedEntityModelVisitor
 		{
 		public:
@@ -98,15 +123,19 @@ public:
 		class ClearCounterVisitor : public la::avdecc::controller::model::DefaultedEntityModelVisitor
 		{
 		public:
-			ClearCounterVisitor(ControllerManager& manager, EntityDataCache& entityCache)
-				: _manager{ manager }
-				, _entityCache{ entityCache }
+			ClearCounterVisitor(EntityDataCache& entityCache)
+				: _entityCache{ entityCache }
+			{
+			}
+
+			ClearedCounters const& getClearedCounters() const noexcept
 			{
+				return _clearedCounters;
 			}
 
 		protected:
 			// la::avdecc::controller::model::EntityModelVisitor overrides
-			virtual void visit(la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::model::EntityNode const& /*node*/) noexcept override
+			virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::EntityNode const& /*node*/) noexcept override
 			{
 				{
 					auto& counterInfo = _entityCache._statisticsCounters[StatisticsErrorCounterFlag::AecpRetries];
@@ -120,21 +149,21 @@ public:
 					auto& counterInfo = _entityCache._statisticsCounters[StatisticsErrorCounterFlag::AecpUnexpectedResponses];
 					counterInfo.lastClearCount = counterInfo.currentCount;
 				}
-				emit _manager.statisticsErrorCounterChanged(entity->getEntity().getEntityID(), {});
+				_clearedCounters.statistics = true;
 			}
-			virtual void visit(la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::model::ConfigurationNode const* const /*parent*/, la::avdecc::controller::model::StreamInputNode const& node) noexcept override
+			virtual void visit(la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::controller::model::ConfigurationNode const* const /*parent*/, la::avdecc::controller::model::StreamInputNode const& node) noexcept override
 			{
-				for (auto& counterInfoKV : _entityCache._streamInputCounters[node.descriptorIndex])
-				{
-					auto& counterInfo = counterInfoKV.second;
-					counterInfo.lastClearCount = counterInfo.currentCount;
-				}
-				emit _manager.streamInputErrorCounterChanged(entity->getEntity().getEntityID(), node.descriptorIndex, {});
+				_entityCache._streamInputCounters[node.descriptorIndex].forEach(
+					[](la::avdecc::entity::StreamInputCounterValidFlag const /*flag*/, ErrorCounterInfo& counterInfo)
+					{
+						counterInfo.lastClearCount = counterInfo.currentCount;
+					});
+				_clearedCounters.streamInputs.push_back(node.descriptorIndex);
 			}
 
 		private:
-			ControllerManager& _manager;
 			EntityDataCache& _entityCache;
+			ClearedCounters _clearedCounters{};
 		};
 
 	public:
@@ -160,16 +189,16 @@ public:
 		{
 			auto counters = StreamInputErrorCounters{};
 
-			auto const streamIt = _streamInputCounters.find(streamIndex);
-			if (streamIt != std::end(_streamInputCounters))
+			if (streamIndex < _streamInputCounters.size())
 			{
-				for (auto const& [flag, errorCounter] : streamIt->second)
-				{
-					if (errorCounter.currentCount != errorCounter.lastClearCount)
+				_streamInputCounters[streamIndex].forEach(
+					[&counters](la::avdecc::entity::StreamInputCounterValidFlag const flag, ErrorCounterInfo const& errorCounter)
 					{
-						counters[flag] = errorCounter.currentCount - errorCounter.lastClearCount;
-					}
-				}
+						if (errorCounter.currentCount != errorCounter.lastClearCount)
+						{
+							counters[flag] = errorCounter.currentCount - errorCounter.lastClearCount;
+						}
+					});
 			}
 
 			return counters;
@@ -205,7 +234,7 @@ public:
 		// Clear the error for a given flag, returns true if the flag has changed, false otherwise
 		bool clearStreamInputCounter(la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::StreamInputCounterValidFlag const flag)
 		{
-			AVDECC_ASSERT(_streamInputCounters[streamIndex].count(flag) != 0, "Should not be possible to clear an error flag that does not exist");
+			AVDECC_ASSERT(_streamInputCounters[streamIndex].contains(flag), "Should not be possible to clear an error flag that does not exist");
 			auto& errorCounter = _streamInputCounters[streamIndex][flag];
 
 			if (errorCounter.lastClearCount != errorCounter.currentCount)
@@ -217,15 +246,12 @@ public:
 			return false;
 		}
 
-		// Clear all the error flags for all streams
-		void clearAllStreamInputCounters()
+		// Clear all the error flags for all streams (the entity is given by the caller, so it's not locked while the cache is being updated)
+		ClearedCounters clearAllStreamInputCounters(la::avdecc::controller::ControlledEntity const& entity)
 		{
-			auto& manager = ControllerManager::getInstance();
-			ClearCounterVisitor visitor{ manager, *this };
-			if (auto entity = manager.getControlledEntity(_entityID))
-			{
-				entity->accept(&visitor, false);
-			}
+			ClearCounterVisitor visitor{ *this };
+			entity.accept(&visitor, false);
+			return visitor.getClearedCounters();
 		}
 
 		/* ************************************************************ */
@@ -235,13 +261,14 @@ public:
 		{
 			auto counters = StatisticsErrorCounters{};
 
-			for (auto const& [flag, errorCounter] : _statisticsCounters)
-			{
-				if (errorCounter.currentCount != errorCounter.lastClearCount)
+			_statisticsCounters.forEach(
+				[&counters](StatisticsErrorCounterFlag const flag, StatisticsCounterInfo const& errorCounter)
 				{
-					counters[flag] = errorCounter.currentCount - errorCounter.lastClearCount;
-				}
-			}
+					if (errorCounter.currentCount != errorCounter.lastClearCount)
+					{
+						counters[flag] = errorCounter.currentCount - errorCounter.lastClearCount;
+					}
+				});
 
 			return counters;
 		}
@@ -276,7 +303,7 @@ public:
 		// Clear the error for a given flag, returns true if the flag has changed, false otherwise
 		bool clearStatisticsCounter(StatisticsErrorCounterFlag const flag)
 		{
-			AVDECC_ASSERT(_statisticsCounters.count(flag) != 0, "Should not be possible to clear an error flag that does not exist");
+			AVDECC_ASSERT(_statisticsCounters.contains(flag), "Should not be possible to clear an error flag that does not exist");
 			auto& errorCounter = _statisticsCounters[flag];
 
 			if (errorCounter.lastClearCount != errorCounter.currentCount)
@@ -288,15 +315,12 @@ public:
 			return false;
 		}
 
-		// Clear all the error flags
-		void clearAllStatisticsCounters()
+		// Clear all the error flags (the entity is given by the caller, so it's not locked while the cache is being updated)
+		ClearedCounters clearAllStatisticsCounters(la::avdecc::controller::ControlledEntity const& entity)
 		{
-			auto& manager = ControllerManager::getInstance();
-			ClearCounterVisitor visitor{ manager, *this };
-			if (auto entity = manager.getControlledEntity(_entityID))
-			{
-				entity->accept(&visitor, false);
-			}
+			ClearCounterVisitor visitor{ *this };
+			entity.accept(&visitor, false);
+			return visitor.getClearedCounters();
 		}
 
 		/* ************************************************************ */
@@ -339,12 +363,143 @@ public:
 			std::uint64_t lastClearCount{ 0u }; // Value when last Cleared
 		};
 
+		// Counters indexed by the bit position of their flag (one slot per possible bit, no allocation)
+		template<typename FlagType, typename CounterInfo>
+		class FlagCounters
+		{
+		public:
+			using Flags = la::avdecc::utils::EnumBitfield<FlagType>;
+
+			// Get or create the counter for the specified flag
+			CounterInfo& operator[](FlagType const flag) noexcept
+			{
+				_validFlags.set(flag);
+				return _counters[Flags::getPosition(flag)];
+			}
+
+			bool contains(FlagType const flag) const noexcept
+			{
+				return _validFlags.test(flag);
+			}
+
+			// Call the handler for each existing counter, only visiting the set bits
+			template<typename Handler>
+			void forEach(Handler const& handler) const noexcept
+			{
+				for (auto const flag : _validFlags)
+				{
+					handler(flag, _counters[Flags::getPosition(flag)]);
+				}
+			}
+
+			template<typename Handler>
+			void forEach(Handler const& handler) noexcept
+			{
+				for (auto const flag : _validFlags)
+				{
+					handler(flag, _counters[Flags::getPosition(flag)]);
+				}
+			}
+
+		private:
+			std::array<CounterInfo, sizeof(std::underlying_type_t<FlagType>) * 8> _counters{};
+			Flags _validFlags{};
+		};
+
+		// Dense per-stream counters, indexed by StreamIndex
+		class PerStreamInputCounters
+		{
+		public:
+			using Counters = FlagCounters<la::avdecc::entity::StreamInputCounterValidFlag, ErrorCounterInfo>;
+
+			// Get or create the counters for the specified stream
+			Counters& operator[](la::avdecc::entity::model::StreamIndex const streamIndex)
+			{
+				if (streamIndex >= _streams.size())
+				{
+					_streams.resize(streamIndex + 1u);
+				}
+				return _streams[streamIndex];
+			}
+
+			Counters const& operator[](la::avdecc::entity::model::StreamIndex const streamIndex) const noexcept
+			{
+				return _streams[streamIndex];
+			}
+
+			std::size_t size() const noexcept
+			{
+				return _streams.size();
+			}
+
+		private:
+			std::vector<Counters> _streams{};
+		};
+
 		la::avdecc::UniqueIdentifier _entityID{ la::avdecc::UniqueIdentifier::getNullUniqueIdentifier() };
-		std::unordered_map<la::avdecc::entity::model::StreamIndex, std::unordered_map<la::avdecc::entity::StreamInputCounterValidFlag, ErrorCounterInfo>> _streamInputCounters{};
-		std::unordered_map<StatisticsErrorCounterFlag, StatisticsCounterInfo> _statisticsCounters{};
+		PerStreamInputCounters _streamInputCounters{};
+		FlagCounters<StatisticsErrorCounterFlag, StatisticsCounterInfo> _statisticsCounters{};
 		la::avdecc::controller::ControlledEntity::Diagnostics _diagnostics{};
 	};
 
+	/** Immutable snapshot of an entity's cached data, never modified once published (Read-Copy-Update) */
+	using SharedEntityDataCache = std::shared_ptr<EntityDataCache const>;
+
+	/** Holder of the latest published snapshot of an entity's cached data */
+	class EntityDataCacheSlot
+	{
+	public:
+		EntityDataCacheSlot(SharedEntityDataCache cache) noexcept
+			: _cache{ std::move(cache) }
+		{
+		}
+
+		SharedEntityDataCache load() const noexcept
+		{
+#if HAVE_ATOMIC_SMART_POINTERS
+			return _cache;
+#else // !HAVE_ATOMIC_SMART_POINTERS
+			return std::atomic_load(&_cache);
+#endif // HAVE_ATOMIC_SMART_POINTERS
+		}
+
+		void store(SharedEntityDataCache cache) noexcept
+		{
+#if HAVE_ATOMIC_SMART_POINTERS
+			_cache = std::move(cache);
+#else // !HAVE_ATOMIC_SMART_POINTERS
+			std::atomic_store(&_cache, std::move(cache));
+#endif // HAVE_ATOMIC_SMART_POINTERS
+		}
+
+	private:
+#if HAVE_ATOMIC_SMART_POINTERS
+		std::atomic_shared_ptr<EntityDataCache const> _cache{ nullptr };
+#else // !HAVE_ATOMIC_SMART_POINTERS
+		SharedEntityDataCache _cache{ nullptr };
+#endif // HAVE_ATOMIC_SMART_POINTERS
+	};
+
+	/** Map of all entities' cached data, only replaced (never modified) when an entity is added or removed */
+	using EntityDataCaches = std::unordered_map<la::avdecc::UniqueIdentifier, std::shared_ptr<EntityDataCacheSlot>, la::avdecc::UniqueIdentifier::hash>;
+	using SharedEntityDataCaches = std::shared_ptr<EntityDataCaches const>;
+
+	/** Entity online (tracker is set) or offline event, waiting to be processed in the manager's thread */
+	struct DiscoveryEvent
+	{
+		la::avdecc::UniqueIdentifier entityID{};
+		SharedEntityDataCache tracker{ nullptr };
+		std::chrono::milliseconds enumerationTime{};
+	};
+
+	struct EventsReplay
+	{
+		std::vector<eventLog::Event> events{};
+		std::size_t nextEvent{ 0u };
+		ReplaySpeed speed{ ReplaySpeed::RealTime };
+		std::chrono::steady_clock::time_point startTime{};
+	};
+
 	ControllerManagerImpl() noexcept
 	{
 		qRegisterMetaType<std::uint8_t>("std::uint8_t");
@@ -356,6 +511,7 @@ public:
 		qRegisterMetaType<AcmpCommandType>("hive::modelsLibrary::ControllerManager::AcmpCommandType");
 		qRegisterMetaType<StreamInputErrorCounters>("hive::modelsLibrary::ControllerManager::StreamInputErrorCounters");
 		qRegisterMetaType<StatisticsErrorCounters>("hive::modelsLibrary::ControllerManager::StatisticsErrorCounters");
+		qRegisterMetaType<EntitiesChangedBatch>("hive::modelsLibrary::ControllerManager::EntitiesChangedBatch");
 		qRegisterMetaType<la::avdecc::UniqueIdentifier>("la::avdecc::UniqueIdentifier");
 		qRegisterMetaType<std::optional<la::avdecc::UniqueIdentifier>>("std::optional<la::avdecc::UniqueIdentifier>");
 		qRegisterMetaType<la::avdecc::entity::ControllerEntity::AemCommandStatus>("la::avdecc::entity::ControllerEntity::AemCommandStatus");
@@ -417,6 +573,27 @@ public:
 		qRegisterMetaType<la::avdecc::controller::ControlledEntity::Diagnostics>("la::avdecc::controller::ControlledEntity::Diagnostics");
 		qRegisterMetaType<la::avdecc::controller::model::AcquireState>("la::avdecc::controller::model::AcquireState");
 		qRegisterMetaType<la::avdecc::controller::model::LockState>("la::avdecc::controller::model::LockState");
+
+		// Coalesced notifications are flushed from the thread owning the manager (GUI thread)
+		connect(&_coalescedFlushTimer, &QTimer::timeout, this,
+			[this]()
+			{
+				flushCoalescedNotifications();
+			});
+
+		// Events replay is driven from the thread owning the manager (GUI thread)
+		_eventsReplayTimer.setSingleShot(true);
+		connect(&_eventsReplayTimer, &QTimer::timeout, this,
+			[this]()
+			{
+				processEventsReplay();
+			});
+
+		// Recorded events are written by a single thread, so they stay in order
+		_eventsRecorderPool.setMaxThreadCount(1);
+
+		// Forward targeted notifications to DescriptorSignalers (always from the manager's thread, as the connection context is the manager itself)
+		connectDescriptorSignalers();
 	}
 
 	~ControllerManagerImpl() noexcept
@@ -442,253 +619,333 @@ private:
 	// Global controller notifications
 	virtual void onTransportError(la::avdecc::controller::Controller const* const /*controller*/) noexcept override
 	{
+		monitorEvent("onTransportError");
 		emit transportError();
 	}
 	virtual void onEntityQueryError(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::Controller::QueryCommandError const error) noexcept override
 	{
+		monitorEvent("onEntityQueryError");
 		emit entityQueryError(entity->getEntity().getEntityID(), error);
 	}
 	// Discovery notifications (ADP)
 	virtual void onEntityOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
 	{
+		monitorDiscoveryEvent("onEntityOnline");
 		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
-		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
+		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so queue the event and process it in the same (main) thread
 
 		// Create the CounterTracker in this thread as it will try to lock the ControlledEntity
 		auto const entityID = entity->getEntity().getEntityID();
-		auto tracker = EntityDataCache{ entityID };
-
-		QMetaObject::invokeMethod(this,
-			[this, entityID, tracker = std::move(tracker), enumerationTime = entity->getEnumerationTime()]()
-			{
-				{
-					auto const lg = std::lock_guard{ _lock };
-					_entities.insert(entityID);
-					_entityDataCache[entityID] = std::move(tracker);
-				}
+		auto tracker = std::make_shared<EntityDataCache const>(entityID);
 
-				emit entityOnline(entityID, enumerationTime);
-			});
+		queueDiscoveryEvent(DiscoveryEvent{ entityID, std::move(tracker), entity->getEnumerationTime() });
 	}
 	virtual void onEntityOffline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
 	{
-		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
-		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
-		QMetaObject::invokeMethod(this,
-			[this, entityID = entity->getEntity().getEntityID()]()
-			{
-				{
-					auto const lg = std::lock_guard{ _lock };
-					_entities.erase(entityID);
-					_entityDataCache.erase(entityID);
-				}
-
-				emit entityOffline(entityID);
-			});
+		monitorDiscoveryEvent("onEntityOffline");
+		// Queued along with onEntityOnline events so both are processed in order, in the same (main) thread
+		queueDiscoveryEvent(DiscoveryEvent{ entity->getEntity().getEntityID() });
 	}
 	virtual void onEntityRedundantInterfaceOnline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::Entity::InterfaceInformation const& interfaceInfo) noexcept override
 	{
+		monitorEvent("onEntityRedundantInterfaceOnline");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AvbInterface);
 		auto const& e = entity->getEntity();
 		emit entityRedundantInterfaceOnline(e.getEntityID(), avbInterfaceIndex, interfaceInfo);
 	}
 	virtual void onEntityRedundantInterfaceOffline(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex) noexcept override
 	{
+		monitorEvent("onEntityRedundantInterfaceOffline");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AvbInterface);
 		auto const& e = entity->getEntity();
 		emit entityRedundantInterfaceOffline(e.getEntityID(), avbInterfaceIndex);
 	}
 	virtual void onEntityCapabilitiesChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
 	{
+		monitorEvent("onEntityCapabilitiesChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::EntityInfo);
 		auto const& e = entity->getEntity();
 		emit entityCapabilitiesChanged(e.getEntityID(), e.getEntityCapabilities());
 	}
 	virtual void onEntityAssociationIDChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
 	{
+		monitorEvent("onEntityAssociationIDChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::EntityInfo);
 		auto const& e = entity->getEntity();
 		auto const associationID = e.getAssociationID();
 		emit associationIDChanged(e.getEntityID(), associationID);
 	}
 	virtual void onGptpChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::UniqueIdentifier const grandMasterID, std::uint8_t const grandMasterDomain) noexcept override
 	{
+		monitorEvent("onGptpChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Gptp);
 		auto const& e = entity->getEntity();
 		emit gptpChanged(e.getEntityID(), avbInterfaceIndex, grandMasterID, grandMasterDomain);
 	}
 	// Global entity notifications
 	virtual void onUnsolicitedRegistrationChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, bool const isSubscribed) noexcept override
 	{
+		monitorEvent("onUnsolicitedRegistrationChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::EntityInfo);
 		emit unsolicitedRegistrationChanged(entity->getEntity().getEntityID(), isSubscribed);
 	}
 	virtual void onCompatibilityChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::ControlledEntity::CompatibilityFlags const compatibilityFlags, la::avdecc::entity::model::MilanVersion const& milanCompatibleVersion) noexcept override
 	{
+		monitorEvent("onCompatibilityChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::EntityInfo);
 		emit compatibilityChanged(entity->getEntity().getEntityID(), compatibilityFlags, milanCompatibleVersion);
 	}
 	virtual void onIdentificationStarted(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
 	{
+		monitorEvent("onIdentificationStarted");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::EntityInfo);
 		emit identificationStarted(entity->getEntity().getEntityID());
 	}
 	virtual void onIdentificationStopped(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity) noexcept override
 	{
+		monitorEvent("onIdentificationStopped");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::EntityInfo);
 		emit identificationStopped(entity->getEntity().getEntityID());
 	}
 	// Connection notifications (sniffed ACMP)
 	virtual void onStreamInputConnectionChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamInputConnectionInfo const& info, bool const /*changedByOther*/) noexcept override
 	{
+		monitorEvent("onStreamInputConnectionChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Connections);
 		emit streamInputConnectionChanged({ entity->getEntity().getEntityID(), streamIndex }, info);
 	}
 	virtual void onStreamOutputConnectionsChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamConnections const& connections) noexcept override
 	{
+		monitorEvent("onStreamOutputConnectionsChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Connections);
 		emit streamOutputConnectionsChanged({ entity->getEntity().getEntityID(), streamIndex }, connections);
 	}
 	// Entity model notifications (unsolicited AECP or changes this controller sent)
 	virtual void onAcquireStateChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::model::AcquireState const acquireState, la::avdecc::UniqueIdentifier const owningEntity) noexcept override
 	{
+		monitorEvent("onAcquireStateChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AccessState);
 		emit acquireStateChanged(entity->getEntity().getEntityID(), acquireState, owningEntity);
 	}
 	virtual void onLockStateChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::model::LockState const lockState, la::avdecc::UniqueIdentifier const lockingEntity) noexcept override
 	{
+		monitorEvent("onLockStateChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AccessState);
 		emit lockStateChanged(entity->getEntity().getEntityID(), lockState, lockingEntity);
 	}
 	virtual void onStreamInputFormatChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamFormat const streamFormat) noexcept override
 	{
+		monitorEvent("onStreamInputFormatChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::StreamFormat);
 		emit streamFormatChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex, streamFormat);
 	}
 	virtual void onStreamOutputFormatChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamFormat const streamFormat) noexcept override
 	{
+		monitorEvent("onStreamOutputFormatChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::StreamFormat);
 		emit streamFormatChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex, streamFormat);
 	}
 	virtual void onStreamInputDynamicInfoChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamDynamicInfo const& info) noexcept override
 	{
+		monitorEvent("onStreamInputDynamicInfoChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::StreamInfo);
 		emit streamDynamicInfoChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex, info);
 	}
 	virtual void onStreamOutputDynamicInfoChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamDynamicInfo const& info) noexcept override
 	{
+		monitorEvent("onStreamOutputDynamicInfoChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::StreamInfo);
 		emit streamDynamicInfoChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex, info);
 	}
 	virtual void onEntityNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvdeccFixedString const& entityName) noexcept override
 	{
+		monitorEvent("onEntityNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit entityNameChanged(entity->getEntity().getEntityID(), QString::fromStdString(entityName));
 	}
 	virtual void onEntityGroupNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvdeccFixedString const& entityGroupName) noexcept override
 	{
+		monitorEvent("onEntityGroupNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit entityGroupNameChanged(entity->getEntity().getEntityID(), QString::fromStdString(entityGroupName));
 	}
 	virtual void onConfigurationNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::AvdeccFixedString const& configurationName) noexcept override
 	{
+		monitorEvent("onConfigurationNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit configurationNameChanged(entity->getEntity().getEntityID(), configurationIndex, QString::fromStdString(configurationName));
 	}
 	virtual void onAudioUnitNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::AudioUnitIndex const audioUnitIndex, la::avdecc::entity::model::AvdeccFixedString const& audioUnitName) noexcept override
 	{
+		monitorEvent("onAudioUnitNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit audioUnitNameChanged(entity->getEntity().getEntityID(), configurationIndex, audioUnitIndex, QString::fromStdString(audioUnitName));
 	}
 	virtual void onStreamInputNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::AvdeccFixedString const& streamName) noexcept override
 	{
+		monitorEvent("onStreamInputNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit streamNameChanged(entity->getEntity().getEntityID(), configurationIndex, la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex, QString::fromStdString(streamName));
 	}
 	virtual void onStreamOutputNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::AvdeccFixedString const& streamName) noexcept override
 	{
+		monitorEvent("onStreamOutputNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit streamNameChanged(entity->getEntity().getEntityID(), configurationIndex, la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex, QString::fromStdString(streamName));
 	}
 	virtual void onJackInputNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::JackIndex const jackIndex, la::avdecc::entity::model::AvdeccFixedString const& jackName) noexcept override
 	{
+		monitorEvent("onJackInputNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit jackNameChanged(entity->getEntity().getEntityID(), configurationIndex, la::avdecc::entity::model::DescriptorType::JackInput, jackIndex, QString::fromStdString(jackName));
 	}
 	virtual void onJackOutputNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::JackIndex const jackIndex, la::avdecc::entity::model::AvdeccFixedString const& jackName) noexcept override
 	{
+		monitorEvent("onJackOutputNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit jackNameChanged(entity->getEntity().getEntityID(), configurationIndex, la::avdecc::entity::model::DescriptorType::JackOutput, jackIndex, QString::fromStdString(jackName));
 	}
 	virtual void onAvbInterfaceNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AvdeccFixedString const& avbInterfaceName) noexcept override
 	{
+		monitorEvent("onAvbInterfaceNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit avbInterfaceNameChanged(entity->getEntity().getEntityID(), configurationIndex, avbInterfaceIndex, QString::fromStdString(avbInterfaceName));
 	}
 	virtual void onClockSourceNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::ClockSourceIndex const clockSourceIndex, la::avdecc::entity::model::AvdeccFixedString const& clockSourceName) noexcept override
 	{
+		monitorEvent("onClockSourceNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit clockSourceNameChanged(entity->getEntity().getEntityID(), configurationIndex, clockSourceIndex, QString::fromStdString(clockSourceName));
 	}
 	virtual void onMemoryObjectNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::MemoryObjectIndex const memoryObjectIndex, la::avdecc::entity::model::AvdeccFixedString const& memoryObjectName) noexcept override
 	{
+		monitorEvent("onMemoryObjectNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit memoryObjectNameChanged(entity->getEntity().getEntityID(), configurationIndex, memoryObjectIndex, QString::fromStdString(memoryObjectName));
 	}
 	virtual void onAudioClusterNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::ClusterIndex const audioClusterIndex, la::avdecc::entity::model::AvdeccFixedString const& audioClusterName) noexcept override
 	{
+		monitorEvent("onAudioClusterNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit audioClusterNameChanged(entity->getEntity().getEntityID(), configurationIndex, audioClusterIndex, QString::fromStdString(audioClusterName));
 	}
 	virtual void onControlNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::ControlIndex const controlIndex, la::avdecc::entity::model::AvdeccFixedString const& controlName) noexcept override
 	{
+		monitorEvent("onControlNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit controlNameChanged(entity->getEntity().getEntityID(), configurationIndex, controlIndex, QString::fromStdString(controlName));
 	}
 	virtual void onClockDomainNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::AvdeccFixedString const& clockDomainName) noexcept override
 	{
+		monitorEvent("onClockDomainNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit clockDomainNameChanged(entity->getEntity().getEntityID(), configurationIndex, clockDomainIndex, QString::fromStdString(clockDomainName));
 	}
 	virtual void onTimingNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::TimingIndex const timingIndex, la::avdecc::entity::model::AvdeccFixedString const& timingName) noexcept override
 	{
+		monitorEvent("onTimingNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit timingNameChanged(entity->getEntity().getEntityID(), configurationIndex, timingIndex, QString::fromStdString(timingName));
 	}
 	virtual void onPtpInstanceNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::PtpInstanceIndex const ptpInstanceIndex, la::avdecc::entity::model::AvdeccFixedString const& ptpInstanceName) noexcept override
 	{
+		monitorEvent("onPtpInstanceNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit ptpInstanceNameChanged(entity->getEntity().getEntityID(), configurationIndex, ptpInstanceIndex, QString::fromStdString(ptpInstanceName));
 	}
 	virtual void onPtpPortNameChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::PtpPortIndex const ptpPortIndex, la::avdecc::entity::model::AvdeccFixedString const& ptpPortName) noexcept override
 	{
+		monitorEvent("onPtpPortNameChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Names);
 		emit ptpPortNameChanged(entity->getEntity().getEntityID(), configurationIndex, ptpPortIndex, QString::fromStdString(ptpPortName));
 	}
 	virtual void onAssociationIDChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::optional<la::avdecc::UniqueIdentifier> const associationID) noexcept override
 	{
+		monitorEvent("onAssociationIDChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::EntityInfo);
 		emit associationIDChanged(entity->getEntity().getEntityID(), associationID);
 	}
 	virtual void onAudioUnitSamplingRateChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AudioUnitIndex const audioUnitIndex, la::avdecc::entity::model::SamplingRate const samplingRate) noexcept override
 	{
+		monitorEvent("onAudioUnitSamplingRateChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Configuration);
 		emit audioUnitSamplingRateChanged(entity->getEntity().getEntityID(), audioUnitIndex, samplingRate);
 	}
 	virtual void onClockSourceChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::ClockSourceIndex const clockSourceIndex) noexcept override
 	{
+		monitorEvent("onClockSourceChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Configuration);
 		emit clockSourceChanged(entity->getEntity().getEntityID(), clockDomainIndex, clockSourceIndex);
 	}
 	virtual void onControlValuesChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ControlIndex const controlIndex, la::avdecc::entity::model::ControlValues const& controlValues) noexcept override
 	{
+		monitorEvent("onControlValuesChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Configuration);
 		emit controlValuesChanged(entity->getEntity().getEntityID(), controlIndex, controlValues);
 	}
 	virtual void onStreamInputStarted(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex) noexcept override
 	{
+		monitorEvent("onStreamInputStarted");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::StreamInfo);
 		emit streamRunningChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex, true);
 	}
 	virtual void onStreamOutputStarted(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex) noexcept override
 	{
+		monitorEvent("onStreamOutputStarted");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::StreamInfo);
 		emit streamRunningChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex, true);
 	}
 	virtual void onStreamInputStopped(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex) noexcept override
 	{
+		monitorEvent("onStreamInputStopped");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::StreamInfo);
 		emit streamRunningChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamInput, streamIndex, false);
 	}
 	virtual void onStreamOutputStopped(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex) noexcept override
 	{
+		monitorEvent("onStreamOutputStopped");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::StreamInfo);
 		emit streamRunningChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamOutput, streamIndex, false);
 	}
 	virtual void onAvbInterfaceInfoChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AvbInterfaceInfo const& info) noexcept override
 	{
+		monitorEvent("onAvbInterfaceInfoChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AvbInterface);
 		emit avbInterfaceInfoChanged(entity->getEntity().getEntityID(), avbInterfaceIndex, info);
 	}
 	virtual void onAsPathChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AsPath const& asPath) noexcept override
 	{
+		monitorEvent("onAsPathChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AvbInterface);
 		emit asPathChanged(entity->getEntity().getEntityID(), avbInterfaceIndex, asPath);
 	}
 	virtual void onAvbInterfaceLinkStatusChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::controller::ControlledEntity::InterfaceLinkStatus const linkStatus) noexcept override
 	{
+		monitorEvent("onAvbInterfaceLinkStatusChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AvbInterface);
 		emit avbInterfaceLinkStatusChanged(entity->getEntity().getEntityID(), avbInterfaceIndex, linkStatus);
 	}
 	virtual void onEntityCountersChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::EntityCounters const& counters) noexcept override
 	{
+		monitorEvent("onEntityCountersChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Counters);
 		emit entityCountersChanged(entity->getEntity().getEntityID(), counters);
 	}
 	virtual void onAvbInterfaceCountersChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AvbInterfaceCounters const& counters) noexcept override
 	{
+		monitorEvent("onAvbInterfaceCountersChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Counters);
 		emit avbInterfaceCountersChanged(entity->getEntity().getEntityID(), avbInterfaceIndex, counters);
 	}
 	virtual void onClockDomainCountersChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::ClockDomainCounters const& counters) noexcept override
 	{
+		monitorEvent("onClockDomainCountersChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Counters);
 		emit clockDomainCountersChanged(entity->getEntity().getEntityID(), clockDomainIndex, counters);
 	}
 	virtual void onStreamInputCountersChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamInputCounters const& counters) noexcept override
 	{
+		monitorEvent("onStreamInputCountersChanged");
 		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
 		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
 
@@ -740,17 +997,21 @@ private:
 		QMetaObject::invokeMethod(this,
 			[this, entityID = entity->getEntity().getEntityID(), streamIndex, counters, checkForChange = std::move(checkForChange)]()
 			{
-				if (auto* entityCache = entityCachedData(entityID))
-				{
-					auto changed = false;
-					for (auto const [flag, counter] : checkForChange)
-					{
-						changed |= entityCache->setStreamInputCounter(streamIndex, flag, counter);
-					}
-					if (changed)
+				markEntityDirty(entityID, EntityChangeFlag::Counters);
+
+				auto const entityCache = updateEntityCachedData(entityID,
+					[streamIndex, &checkForChange](EntityDataCache& cache)
 					{
-						emit streamInputErrorCounterChanged(entityID, streamIndex, entityCache->getStreamInputErrorCounters(streamIndex));
-					}
+						auto changed = false;
+						for (auto const [flag, counter] : checkForChange)
+						{
+							changed |= cache.setStreamInputCounter(streamIndex, flag, counter);
+						}
+						return changed;
+					});
+				if (entityCache)
+				{
+					emit streamInputErrorCounterChanged(entityID, streamIndex, entityCache->getStreamInputErrorCounters(streamIndex));
 				}
 
 				emit streamInputCountersChanged(entityID, streamIndex, counters);
@@ -758,59 +1019,84 @@ private:
 	}
 	virtual void onStreamOutputCountersChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamOutputCounters const& counters) noexcept override
 	{
+		monitorEvent("onStreamOutputCountersChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Counters);
 		emit streamOutputCountersChanged(entity->getEntity().getEntityID(), streamIndex, counters);
 	}
 	virtual void onMemoryObjectLengthChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ConfigurationIndex const configurationIndex, la::avdecc::entity::model::MemoryObjectIndex const memoryObjectIndex, std::uint64_t const length) noexcept override
 	{
+		monitorEvent("onMemoryObjectLengthChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Operations);
 		emit memoryObjectLengthChanged(entity->getEntity().getEntityID(), configurationIndex, memoryObjectIndex, length);
 	}
 	virtual void onStreamPortInputAudioMappingsChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamPortIndex const streamPortIndex) noexcept override
 	{
+		monitorEvent("onStreamPortInputAudioMappingsChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AudioMappings);
 		emit streamPortAudioMappingsChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamPortInput, streamPortIndex);
 	}
 	virtual void onStreamPortOutputAudioMappingsChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamPortIndex const streamPortIndex) noexcept override
 	{
+		monitorEvent("onStreamPortOutputAudioMappingsChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::AudioMappings);
 		emit streamPortAudioMappingsChanged(entity->getEntity().getEntityID(), la::avdecc::entity::model::DescriptorType::StreamPortOutput, streamPortIndex);
 	}
 	virtual void onOperationProgress(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::DescriptorType const descriptorType, la::avdecc::entity::model::DescriptorIndex const descriptorIndex, la::avdecc::entity::model::OperationID const operationID, float const percentComplete) noexcept override
 	{
+		monitorEvent("onOperationProgress");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Operations);
 		emit operationProgress(entity->getEntity().getEntityID(), descriptorType, descriptorIndex, operationID, percentComplete);
 	}
 	virtual void onOperationCompleted(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::DescriptorType const descriptorType, la::avdecc::entity::model::DescriptorIndex const descriptorIndex, la::avdecc::entity::model::OperationID const operationID, bool const failed) noexcept override
 	{
+		monitorEvent("onOperationCompleted");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Operations);
 		emit operationCompleted(entity->getEntity().getEntityID(), descriptorType, descriptorIndex, operationID, failed);
 	}
 	virtual void onMediaClockChainChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::controller::model::MediaClockChain const& mcChain) noexcept override
 	{
+		monitorEvent("onMediaClockChainChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Configuration);
 		emit mediaClockChainChanged(entity->getEntity().getEntityID(), clockDomainIndex, mcChain);
 	}
 	virtual void onMaxTransitTimeChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::StreamIndex const streamIndex, std::chrono::nanoseconds const& maxTransitTime) noexcept override
 	{
+		monitorEvent("onMaxTransitTimeChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Configuration);
 		emit maxTransitTimeChanged(entity->getEntity().getEntityID(), streamIndex, maxTransitTime);
 	}
 	virtual void onSystemUniqueIDChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::SystemUniqueIdentifier const systemUniqueID) noexcept override
 	{
+		monitorEvent("onSystemUniqueIDChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Configuration);
 		emit systemUniqueIDChanged(entity->getEntity().getEntityID(), systemUniqueID);
 	}
 	virtual void onMediaClockReferenceInfoChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::MediaClockReferenceInfo const& mcrInfo) noexcept override
 	{
+		monitorEvent("onMediaClockReferenceInfoChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Configuration);
 		emit mediaClockReferenceInfoChanged(entity->getEntity().getEntityID(), clockDomainIndex, mcrInfo);
 	}
 
 	// Statistics
 	virtual void onAecpRetryCounterChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::uint64_t const value) noexcept override
 	{
+		monitorEvent("onAecpRetryCounterChanged");
 		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
 		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
 		QMetaObject::invokeMethod(this,
 			[this, entityID = entity->getEntity().getEntityID(), value]()
 			{
-				if (auto* entityCache = entityCachedData(entityID))
-				{
-					if (entityCache->setStatisticsCounter(StatisticsErrorCounterFlag::AecpRetries, value))
+				markEntityDirty(entityID, EntityChangeFlag::Statistics);
+
+				auto const entityCache = updateEntityCachedData(entityID,
+					[value](EntityDataCache& cache)
 					{
-						emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
-					}
+						return cache.setStatisticsCounter(StatisticsErrorCounterFlag::AecpRetries, value);
+					});
+				if (entityCache)
+				{
+					emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
 				}
 
 				emit aecpRetryCounterChanged(entityID, value);
@@ -818,17 +1104,22 @@ private:
 	}
 	virtual void onAecpTimeoutCounterChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::uint64_t const value) noexcept override
 	{
+		monitorEvent("onAecpTimeoutCounterChanged");
 		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
 		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
 		QMetaObject::invokeMethod(this,
 			[this, entityID = entity->getEntity().getEntityID(), value]()
 			{
-				if (auto* entityCache = entityCachedData(entityID))
-				{
-					if (entityCache->setStatisticsCounter(StatisticsErrorCounterFlag::AecpTimeouts, value))
+				markEntityDirty(entityID, EntityChangeFlag::Statistics);
+
+				auto const entityCache = updateEntityCachedData(entityID,
+					[value](EntityDataCache& cache)
 					{
-						emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
-					}
+						return cache.setStatisticsCounter(StatisticsErrorCounterFlag::AecpTimeouts, value);
+					});
+				if (entityCache)
+				{
+					emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
 				}
 
 				emit aecpTimeoutCounterChanged(entityID, value);
@@ -836,17 +1127,22 @@ private:
 	}
 	virtual void onAecpUnexpectedResponseCounterChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::uint64_t const value) noexcept override
 	{
+		monitorEvent("onAecpUnexpectedResponseCounterChanged");
 		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
 		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
 		QMetaObject::invokeMethod(this,
 			[this, entityID = entity->getEntity().getEntityID(), value]()
 			{
-				if (auto* entityCache = entityCachedData(entityID))
-				{
-					if (entityCache->setStatisticsCounter(StatisticsErrorCounterFlag::AecpUnexpectedResponses, value))
+				markEntityDirty(entityID, EntityChangeFlag::Statistics);
+
+				auto const entityCache = updateEntityCachedData(entityID,
+					[value](EntityDataCache& cache)
 					{
-						emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
-					}
+						return cache.setStatisticsCounter(StatisticsErrorCounterFlag::AecpUnexpectedResponses, value);
+					});
+				if (entityCache)
+				{
+					emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
 				}
 
 				emit aecpUnexpectedResponseCounterChanged(entityID, value);
@@ -854,25 +1150,34 @@ private:
 	}
 	virtual void onAecpResponseAverageTimeChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::chrono::milliseconds const& value) noexcept override
 	{
+		monitorEvent("onAecpResponseAverageTimeChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Statistics);
 		emit aecpResponseAverageTimeChanged(entity->getEntity().getEntityID(), value);
 	}
 	virtual void onAemAecpUnsolicitedCounterChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::uint64_t const value) noexcept override
 	{
+		monitorEvent("onAemAecpUnsolicitedCounterChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Statistics);
 		emit aemAecpUnsolicitedCounterChanged(entity->getEntity().getEntityID(), value);
 	}
 	virtual void onAemAecpUnsolicitedLossCounterChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::uint64_t const value) noexcept override
 	{
+		monitorEvent("onAemAecpUnsolicitedLossCounterChanged");
 		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
 		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
 		QMetaObject::invokeMethod(this,
 			[this, entityID = entity->getEntity().getEntityID(), value]()
 			{
-				if (auto* entityCache = entityCachedData(entityID))
-				{
-					if (entityCache->setStatisticsCounter(StatisticsErrorCounterFlag::AemAecpUnsolicitedLosses, value))
+				markEntityDirty(entityID, EntityChangeFlag::Statistics);
+
+				auto const entityCache = updateEntityCachedData(entityID,
+					[value](EntityDataCache& cache)
 					{
-						emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
-					}
+						return cache.setStatisticsCounter(StatisticsErrorCounterFlag::AemAecpUnsolicitedLosses, value);
+					});
+				if (entityCache)
+				{
+					emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
 				}
 
 				emit aemAecpUnsolicitedLossCounterChanged(entityID, value);
@@ -880,21 +1185,28 @@ private:
 	}
 	virtual void onMvuAecpUnsolicitedCounterChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::uint64_t const value) noexcept override
 	{
+		monitorEvent("onMvuAecpUnsolicitedCounterChanged");
+		markEntityDirty(entity->getEntity().getEntityID(), EntityChangeFlag::Statistics);
 		emit mvuAecpUnsolicitedCounterChanged(entity->getEntity().getEntityID(), value);
 	}
 	virtual void onMvuAecpUnsolicitedLossCounterChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, std::uint64_t const value) noexcept override
 	{
+		monitorEvent("onMvuAecpUnsolicitedLossCounterChanged");
 		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
 		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
 		QMetaObject::invokeMethod(this,
 			[this, entityID = entity->getEntity().getEntityID(), value]()
 			{
-				if (auto* entityCache = entityCachedData(entityID))
-				{
-					if (entityCache->setStatisticsCounter(StatisticsErrorCounterFlag::MvuAecpUnsolicitedLosses, value))
+				markEntityDirty(entityID, EntityChangeFlag::Statistics);
+
+				auto const entityCache = updateEntityCachedData(entityID,
+					[value](EntityDataCache& cache)
 					{
-						emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
-					}
+						return cache.setStatisticsCounter(StatisticsErrorCounterFlag::MvuAecpUnsolicitedLosses, value);
+					});
+				if (entityCache)
+				{
+					emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
 				}
 
 				emit mvuAecpUnsolicitedLossCounterChanged(entityID, value);
@@ -903,12 +1215,16 @@ private:
 	// Diagnostics
 	virtual void onDiagnosticsChanged(la::avdecc::controller::Controller const* const /*controller*/, la::avdecc::controller::ControlledEntity const* const entity, la::avdecc::controller::ControlledEntity::Diagnostics const& diags) noexcept override
 	{
+		monitorEvent("onDiagnosticsChanged");
 		// Invoke all the code manipulating class members to the main thread, as onEntityOnline and onEntityOffline can happen at the same time from different threads (as of current avdecc_controller library)
 		// We don't want a class member to be reset by onEntityOffline while the entity is going Online again at the same time, so invoke in a queued manner in the same (main) thread
 		QMetaObject::invokeMethod(this,
 			[this, entityID = entity->getEntity().getEntityID(), diags]()
 			{
-				if (auto* entityCache = entityCachedData(entityID))
+				markEntityDirty(entityID, EntityChangeFlag::Diagnostics);
+
+				// Snapshot of the previous state, not affected by the update below
+				if (auto const entityCache = entityCachedData(entityID))
 				{
 					// Check for Redundancy Warning change
 					auto const redundancyWarnChanged = entityCache->getDiagnostics().redundancyWarning != diags.redundancyWarning;
@@ -958,7 +1274,12 @@ private:
 					}
 
 					// Update diags cache
-					entityCache->setDiagnostics(diags);
+					updateEntityCachedData(entityID,
+						[&diags](EntityDataCache& cache)
+						{
+							cache.setDiagnostics(diags);
+							return true;
+						});
 
 					// Notify
 					if (redundancyWarnChanged)
@@ -1049,9 +1370,23 @@ private:
 			{
 				auto const lg = std::lock_guard{ _lock };
 				_entities.clear();
-				_entityDataCache.clear();
+				storeEntityDataCaches(std::make_shared<EntityDataCaches const>());
+			}
+
+			// Drop pending coalesced changes and discovery events, they relate to the destroyed controller
+			{
+				auto const lg = std::lock_guard{ _coalescedLock };
+				_pendingChanges.clear();
+			}
+			{
+				auto const lg = std::lock_guard{ _discoveryEventsLock };
+				_pendingDiscoveryBatches.clear();
 			}
 
+			// Recorded events and replayed ones relate to the destroyed controller
+			stopEventsRecording();
+			stopEventsReplay();
+
 			// Notify
 			emit controllerOffline();
 		}
@@ -1182,144 +1517,429 @@ private:
 		return _fullAemEnumeration;
 	}
 
-	virtual void identifyEntity(la::avdecc::UniqueIdentifier const targetEntityID, std::chrono::milliseconds const duration, IdentifyEntityHandler const& resultHandler) noexcept override
+	virtual void setEnableCoalescedNotifications(bool const enable, std::chrono::milliseconds const flushInterval) noexcept override
 	{
-		auto controller = getController();
-		if (controller)
+		_coalescedNotificationsEnabled = enable;
+		if (enable)
 		{
-			emit beginAecpCommand(targetEntityID, AecpCommandType::IdentifyEntity, la::avdecc::entity::model::DescriptorIndex{ 0u });
-			controller->identifyEntity(targetEntityID, duration,
-				[this, targetEntityID, resultHandler](la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::entity::ControllerEntity::AemCommandStatus const status) noexcept
-				{
-					if (resultHandler)
-					{
-						la::avdecc::utils::invokeProtectedHandler(resultHandler, targetEntityID, status);
-					}
-					else
-					{
-						emit endAecpCommand(targetEntityID, AecpCommandType::IdentifyEntity, la::avdecc::entity::model::DescriptorIndex{ 0u }, status);
-					}
-				});
+			_coalescedFlushTimer.start(std::max(flushInterval, std::chrono::milliseconds{ 1 }));
 		}
-	}
-
-	EntityDataCache const* entityCachedData(la::avdecc::UniqueIdentifier const entityID) const noexcept
-	{
-		auto const lg = std::lock_guard{ _lock };
-
-		auto const it = _entityDataCache.find(entityID);
-		if (it != std::end(_entityDataCache))
+		else
 		{
-			return &it->second;
+			_coalescedFlushTimer.stop();
+			// Deliver what has been accumulated so far, so consumers don't miss any change
+			flushCoalescedNotifications();
 		}
+	}
 
-		return nullptr;
+	virtual bool isCoalescedNotificationsEnabled() const noexcept override
+	{
+		return _coalescedNotificationsEnabled;
 	}
 
-	EntityDataCache* entityCachedData(la::avdecc::UniqueIdentifier const entityID) noexcept
+	virtual void setEnableEventPipelineInstrumentation(bool const enable) noexcept override
 	{
-		return const_cast<EntityDataCache*>(static_cast<ControllerManagerImpl const*>(this)->entityCachedData(entityID));
+		_eventPipelineMonitor.setEnabled(enable);
 	}
 
-	virtual StreamInputErrorCounters getStreamInputErrorCounters(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex) const noexcept override
+	virtual bool isEventPipelineInstrumentationEnabled() const noexcept override
 	{
-		if (auto* entityCache = entityCachedData(entityID))
-		{
-			return entityCache->getStreamInputErrorCounters(streamIndex);
-		}
-		return {};
+		return _eventPipelineMonitor.isEnabled();
 	}
 
-	virtual void clearStreamInputCounterValidFlags(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::StreamInputCounterValidFlag const flag) noexcept override
+	virtual EventPipelineStatistics getEventPipelineStatistics() const noexcept override
 	{
-		if (auto* entityCache = entityCachedData(entityID))
-		{
-			if (entityCache->clearStreamInputCounter(streamIndex, flag))
-			{
-				emit streamInputErrorCounterChanged(entityID, streamIndex, entityCache->getStreamInputErrorCounters(streamIndex));
-			}
-		}
+		return _eventPipelineMonitor.getStatistics();
 	}
 
-	virtual void clearAllStreamInputCounterValidFlags(la::avdecc::UniqueIdentifier const entityID) noexcept override
+	virtual void resetEventPipelineStatistics() noexcept override
 	{
-		if (auto* entityCache = entityCachedData(entityID))
-		{
-			entityCache->clearAllStreamInputCounters();
-		}
+		_eventPipelineMonitor.reset();
 	}
 
-	virtual StatisticsErrorCounters getStatisticsCounters(la::avdecc::UniqueIdentifier const entityID) const noexcept override
+	virtual bool startEventsRecording(QString const& filePath) noexcept override
 	{
-		if (auto* entityCache = entityCachedData(entityID))
+		if (isRecordingEvents())
 		{
-			return entityCache->getStatisticsErrorCounters();
+			return false;
 		}
-		return {};
-	}
 
-	virtual void clearStatisticsCounterValidFlags(la::avdecc::UniqueIdentifier const entityID, StatisticsErrorCounterFlag const flag) noexcept override
-	{
-		if (auto* entityCache = entityCachedData(entityID))
+		// Start with the current network state, so the recording can be replayed from scratch (empty if the controller has no entity)
+		auto networkState = QByteArray{};
+		if (getController())
 		{
-			if (entityCache->clearStatisticsCounter(flag))
+			auto const state = serializeThroughFile(
+				[this](QString const& path)
+				{
+					return serializeAllControlledEntitiesAsJson(path, getEventsLogDumpFlags(), "Hive Events Recorder");
+				});
+			if (state)
 			{
-				emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
+				networkState = *state;
 			}
 		}
-	}
 
-	virtual void clearAllStatisticsCounterValidFlags(la::avdecc::UniqueIdentifier const entityID) noexcept override
-	{
-		if (auto* entityCache = entityCachedData(entityID))
+		auto writer = eventLog::Writer::create(filePath, networkState);
+		if (!writer)
 		{
-			entityCache->clearAllStatisticsCounters();
+			return false;
 		}
-	}
 
-	virtual la::avdecc::controller::ControlledEntity::Diagnostics getDiagnostics(la::avdecc::UniqueIdentifier const entityID) const noexcept override
-	{
-		if (auto* entityCache = entityCachedData(entityID))
 		{
-			return entityCache->getDiagnostics();
+			auto const lg = std::lock_guard{ _eventsRecorderLock };
+			_eventsRecorder = std::move(writer);
 		}
-		return {};
+
+		// Record at signal level, the same notifications consumers get (DirectConnection so events are recorded in the order they are emitted, from any thread)
+		forEachRecordedSignal(
+			[this](eventLog::EventType const type, auto const signal, std::optional<EntityChangeFlag> const /*flag*/)
+			{
+				connectEventRecorder(type, signal);
+			});
+		_eventsRecorderConnections.push_back(connect(
+			this, &ControllerManager::entityOnline, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::chrono::milliseconds const enumerationTime)
+			{
+				// Store the whole entity, it will be loaded as a virtual entity during replay (serialized by the recorder thread, not the one emitting the signal)
+				queueRecord(eventLog::EventType::EntityOnline,
+					[this, entityID, enumerationTime]() -> std::optional<eventLog::Buffer>
+					{
+						auto const entity = serializeThroughFile(
+							[this, entityID](QString const& path)
+							{
+								return serializeControlledEntityAsJson(entityID, path, getEventsLogDumpFlags(), "Hive Events Recorder");
+							});
+						if (!entity)
+						{
+							return std::nullopt;
+						}
+						auto payload = eventLog::Buffer{};
+						eventLog::serialize(payload, entityID);
+						eventLog::serialize(payload, enumerationTime);
+						eventLog::serialize(payload, *entity);
+						return payload;
+					});
+			},
+			Qt::DirectConnection));
+		// Complex payloads, only the event is recorded and the payload is read back from the entity model during replay
+		_eventsRecorderConnections.push_back(connect(
+			this, &ControllerManager::controlValuesChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ControlIndex const controlIndex, la::avdecc::entity::model::ControlValues const& /*controlValues*/)
+			{
+				recordEvent(eventLog::EventType::ControlValuesChanged, entityID, controlIndex);
+			},
+			Qt::DirectConnection));
+		_eventsRecorderConnections.push_back(connect(
+			this, &ControllerManager::mediaClockChainChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::controller::model::MediaClockChain const& /*mcChain*/)
+			{
+				recordEvent(eventLog::EventType::MediaClockChainChanged, entityID, clockDomainIndex);
+			},
+			Qt::DirectConnection));
+		_eventsRecorderConnections.push_back(connect(
+			this, &ControllerManager::diagnosticsChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::controller::ControlledEntity::Diagnostics const& /*diagnostics*/)
+			{
+				recordEvent(eventLog::EventType::DiagnosticsChanged, entityID);
+			},
+			Qt::DirectConnection));
+
+		_isRecordingEvents = true;
+		return true;
 	}
 
-	virtual bool isRedundancyWarning(la::avdecc::UniqueIdentifier const entityID) const noexcept override
+	virtual void stopEventsRecording() noexcept override
 	{
-		if (auto* entityCache = entityCachedData(entityID))
+		if (!isRecordingEvents())
 		{
-			return entityCache->getDiagnostics().redundancyWarning;
+			return;
 		}
-		return {};
-	}
 
-	virtual bool getStreamInputLatencyError(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex) const noexcept override
-	{
-		if (auto* entityCache = entityCachedData(entityID))
+		for (auto const& connection : _eventsRecorderConnections)
 		{
-			return entityCache->getStreamInputLatencyError(streamIndex);
+			disconnect(connection);
 		}
-		return {};
-	}
+		_eventsRecorderConnections.clear();
+
+		// Write the events still queued
+		_eventsRecorderPool.waitForDone();
 
-	virtual bool getControlValueOutOfBounds(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ControlIndex const controlIndex) const noexcept override
-	{
-		if (auto* entityCache = entityCachedData(entityID))
 		{
-			return entityCache->getControlValueOutOfBounds(controlIndex);
+			auto const lg = std::lock_guard{ _eventsRecorderLock };
+			_eventsRecorder.reset();
 		}
-		return {};
+
+		_isRecordingEvents = false;
 	}
 
-	/* Discovery Protocol (ADP) */
-	virtual bool enableEntityAdvertising(std::uint32_t const availableDuration, std::optional<la::avdecc::entity::model::AvbInterfaceIndex> const interfaceIndex) noexcept
+	virtual bool isRecordingEvents() const noexcept override
 	{
-		auto controller = getController();
-		if (controller)
-		{
-			try
+		return _isRecordingEvents;
+	}
+
+	virtual bool startEventsReplay(QString const& filePath, ReplaySpeed const speed, QString& errorMessage) noexcept override
+	{
+		if (isReplayingEvents())
+		{
+			errorMessage = "A replay is already in progress";
+			return false;
+		}
+		if (!getController())
+		{
+			errorMessage = "Controller offline";
+			return false;
+		}
+
+		auto log = eventLog::readEventLog(filePath, errorMessage);
+		if (!log)
+		{
+			return false;
+		}
+
+		// Load the recorded network state (entities that fail to load are skipped, their events will be ignored by the consumers)
+		if (!log->networkState.isEmpty())
+		{
+			loadThroughFile(log->networkState,
+				[this](QString const& path)
+				{
+					return loadVirtualEntitiesFromJsonNetworkState(path, getEventsLogDumpFlags());
+				});
+		}
+
+		_eventsReplay = EventsReplay{ std::move(log->events), 0u, speed, std::chrono::steady_clock::now() };
+
+		// Start once the entities of the network state have been announced (queued in the manager's thread)
+		_eventsReplayTimer.start(0);
+		return true;
+	}
+
+	virtual void stopEventsReplay() noexcept override
+	{
+		_eventsReplayTimer.stop();
+		_eventsReplay.reset();
+	}
+
+	virtual bool isReplayingEvents() const noexcept override
+	{
+		return _eventsReplay.has_value();
+	}
+
+	virtual void identifyEntity(la::avdecc::UniqueIdentifier const targetEntityID, std::chrono::milliseconds const duration, IdentifyEntityHandler const& resultHandler) noexcept override
+	{
+		auto controller = getController();
+		if (controller)
+		{
+			emit beginAecpCommand(targetEntityID, AecpCommandType::IdentifyEntity, la::avdecc::entity::model::DescriptorIndex{ 0u });
+			controller->identifyEntity(targetEntityID, duration,
+				[this, targetEntityID, resultHandler](la::avdecc::controller::ControlledEntity const* const /*entity*/, la::avdecc::entity::ControllerEntity::AemCommandStatus const status) noexcept
+				{
+					if (resultHandler)
+					{
+						la::avdecc::utils::invokeProtectedHandler(resultHandler, targetEntityID, status);
+					}
+					else
+					{
+						emit endAecpCommand(targetEntityID, AecpCommandType::IdentifyEntity, la::avdecc::entity::model::DescriptorIndex{ 0u }, status);
+					}
+				});
+		}
+	}
+
+	SharedEntityDataCaches loadEntityDataCaches() const noexcept
+	{
+#if HAVE_ATOMIC_SMART_POINTERS
+		return _entityDataCaches;
+#else // !HAVE_ATOMIC_SMART_POINTERS
+		return std::atomic_load(&_entityDataCaches);
+#endif // HAVE_ATOMIC_SMART_POINTERS
+	}
+
+	// Must be called with _lock held
+	void storeEntityDataCaches(SharedEntityDataCaches caches) noexcept
+	{
+#if HAVE_ATOMIC_SMART_POINTERS
+		_entityDataCaches = std::move(caches);
+#else // !HAVE_ATOMIC_SMART_POINTERS
+		std::atomic_store(&_entityDataCaches, std::move(caches));
+#endif // HAVE_ATOMIC_SMART_POINTERS
+	}
+
+	// Returns the latest published snapshot of the entity's cached data, without blocking (can be called from any thread)
+	SharedEntityDataCache entityCachedData(la::avdecc::UniqueIdentifier const entityID) const noexcept
+	{
+		auto const caches = loadEntityDataCaches();
+
+		auto const it = caches->find(entityID);
+		if (it != std::end(*caches))
+		{
+			return it->second->load();
+		}
+
+		return nullptr;
+	}
+
+	// Updates a copy of the entity's cached data then publishes it if the handler returns true. Returns the published snapshot, or nullptr if nothing was published
+	// The handler is called with _lock held (it must not emit any signal)
+	template<typename Handler>
+	SharedEntityDataCache updateEntityCachedData(la::avdecc::UniqueIdentifier const entityID, Handler const& handler) noexcept
+	{
+		auto const lg = std::lock_guard{ _lock };
+		auto const caches = loadEntityDataCaches();
+
+		auto const it = caches->find(entityID);
+		if (it == std::end(*caches))
+		{
+			return nullptr;
+		}
+
+		auto const& slot = it->second;
+		auto cache = std::make_shared<EntityDataCache>(*slot->load());
+		if (!handler(*cache))
+		{
+			return nullptr;
+		}
+
+		slot->store(cache);
+		return cache;
+	}
+
+	void notifyClearedCounters(la::avdecc::UniqueIdentifier const entityID, EntityDataCache::ClearedCounters const& clearedCounters) noexcept
+	{
+		if (clearedCounters.statistics)
+		{
+			emit statisticsErrorCounterChanged(entityID, {});
+		}
+		for (auto const streamIndex : clearedCounters.streamInputs)
+		{
+			emit streamInputErrorCounterChanged(entityID, streamIndex, {});
+		}
+	}
+
+	virtual StreamInputErrorCounters getStreamInputErrorCounters(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex) const noexcept override
+	{
+		if (auto const entityCache = entityCachedData(entityID))
+		{
+			return entityCache->getStreamInputErrorCounters(streamIndex);
+		}
+		return {};
+	}
+
+	virtual void clearStreamInputCounterValidFlags(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::StreamInputCounterValidFlag const flag) noexcept override
+	{
+		auto const entityCache = updateEntityCachedData(entityID,
+			[streamIndex, flag](EntityDataCache& cache)
+			{
+				return cache.clearStreamInputCounter(streamIndex, flag);
+			});
+		if (entityCache)
+		{
+			emit streamInputErrorCounterChanged(entityID, streamIndex, entityCache->getStreamInputErrorCounters(streamIndex));
+		}
+	}
+
+	virtual void clearAllStreamInputCounterValidFlags(la::avdecc::UniqueIdentifier const entityID) noexcept override
+	{
+		// Lock the entity before _lock is taken by updateEntityCachedData, the same order as controller notifications
+		auto const controlledEntity = getControlledEntity(entityID);
+		if (!controlledEntity)
+		{
+			return;
+		}
+
+		auto clearedCounters = EntityDataCache::ClearedCounters{};
+		updateEntityCachedData(entityID,
+			[&controlledEntity, &clearedCounters](EntityDataCache& cache)
+			{
+				clearedCounters = cache.clearAllStreamInputCounters(*controlledEntity);
+				return true;
+			});
+		notifyClearedCounters(entityID, clearedCounters);
+	}
+
+	virtual StatisticsErrorCounters getStatisticsCounters(la::avdecc::UniqueIdentifier const entityID) const noexcept override
+	{
+		if (auto const entityCache = entityCachedData(entityID))
+		{
+			return entityCache->getStatisticsErrorCounters();
+		}
+		return {};
+	}
+
+	virtual void clearStatisticsCounterValidFlags(la::avdecc::UniqueIdentifier const entityID, StatisticsErrorCounterFlag const flag) noexcept override
+	{
+		auto const entityCache = updateEntityCachedData(entityID,
+			[flag](EntityDataCache& cache)
+			{
+				return cache.clearStatisticsCounter(flag);
+			});
+		if (entityCache)
+		{
+			emit statisticsErrorCounterChanged(entityID, entityCache->getStatisticsErrorCounters());
+		}
+	}
+
+	virtual void clearAllStatisticsCounterValidFlags(la::avdecc::UniqueIdentifier const entityID) noexcept override
+	{
+		// Lock the entity before _lock is taken by updateEntityCachedData, the same order as controller notifications
+		auto const controlledEntity = getControlledEntity(entityID);
+		if (!controlledEntity)
+		{
+			return;
+		}
+
+		auto clearedCounters = EntityDataCache::ClearedCounters{};
+		updateEntityCachedData(entityID,
+			[&controlledEntity, &clearedCounters](EntityDataCache& cache)
+			{
+				clearedCounters = cache.clearAllStatisticsCounters(*controlledEntity);
+				return true;
+			});
+		notifyClearedCounters(entityID, clearedCounters);
+	}
+
+	virtual la::avdecc::controller::ControlledEntity::Diagnostics getDiagnostics(la::avdecc::UniqueIdentifier const entityID) const noexcept override
+	{
+		if (auto const entityCache = entityCachedData(entityID))
+		{
+			return entityCache->getDiagnostics();
+		}
+		return {};
+	}
+
+	virtual bool isRedundancyWarning(la::avdecc::UniqueIdentifier const entityID) const noexcept override
+	{
+		if (auto const entityCache = entityCachedData(entityID))
+		{
+			return entityCache->getDiagnostics().redundancyWarning;
+		}
+		return {};
+	}
+
+	virtual bool getStreamInputLatencyError(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex) const noexcept override
+	{
+		if (auto const entityCache = entityCachedData(entityID))
+		{
+			return entityCache->getStreamInputLatencyError(streamIndex);
+		}
+		return {};
+	}
+
+	virtual bool getControlValueOutOfBounds(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ControlIndex const controlIndex) const noexcept override
+	{
+		if (auto const entityCache = entityCachedData(entityID))
+		{
+			return entityCache->getControlValueOutOfBounds(controlIndex);
+		}
+		return {};
+	}
+
+	/* Discovery Protocol (ADP) */
+	virtual bool enableEntityAdvertising(std::uint32_t const availableDuration, std::optional<la::avdecc::entity::model::AvbInterfaceIndex> const interfaceIndex) noexcept
+	{
+		auto controller = getController();
+		if (controller)
+		{
+			try
 			{
 				controller->enableEntityAdvertising(availableDuration, interfaceIndex);
 				return true;
@@ -2679,6 +3299,24 @@ private:
 		}
 	}
 
+	virtual SharedDescriptorSignaler getDescriptorSignaler(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::DescriptorType const descriptorType, la::avdecc::entity::model::DescriptorIndex const descriptorIndex) noexcept override
+	{
+		auto& weakSignaler = _descriptorSignalers[DescriptorKey{ entityID, descriptorType, descriptorIndex }];
+		if (auto signaler = weakSignaler.lock())
+		{
+			return signaler;
+		}
+
+		// Create a new signaler, deleted in a deferred manner in case the last reference is released during a signal emission
+		auto signaler = SharedDescriptorSignaler{ new DescriptorSignaler{},
+			[](DescriptorSignaler* const signaler)
+			{
+				signaler->deleteLater();
+			} };
+		weakSignaler = signaler;
+		return signaler;
+	}
+
 	virtual void foreachEntity(ControlledEntityCallback const& callback) noexcept override
 	{
 		auto controller = getController();
@@ -2707,6 +3345,641 @@ private:
 	}
 
 	// Private methods
+	template<typename Signal, typename... Args>
+	void dispatchToDescriptorSignaler(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::DescriptorType const descriptorType, la::avdecc::entity::model::DescriptorIndex const descriptorIndex, Signal const signal, Args const&... args) noexcept
+	{
+		auto const it = _descriptorSignalers.find(DescriptorKey{ entityID, descriptorType, descriptorIndex });
+		if (it != std::end(_descriptorSignalers))
+		{
+			// Keep a strong reference during the emission, in case a slot releases the last one
+			if (auto const signaler = it->second.lock())
+			{
+				emit(signaler.get()->*signal)(args...);
+			}
+			else
+			{
+				// Nobody holds this signaler anymore
+				_descriptorSignalers.erase(it);
+			}
+		}
+	}
+
+	void connectDescriptorSignalers() noexcept
+	{
+		using DescriptorType = la::avdecc::entity::model::DescriptorType;
+
+		// Entity level
+		connect(this, &ControllerManager::entityCountersChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::EntityCounters const& counters)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::entityCountersChanged, counters);
+			});
+		connect(this, &ControllerManager::aecpRetryCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::aecpRetryCounterChanged, value);
+			});
+		connect(this, &ControllerManager::aecpTimeoutCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::aecpTimeoutCounterChanged, value);
+			});
+		connect(this, &ControllerManager::aecpUnexpectedResponseCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::aecpUnexpectedResponseCounterChanged, value);
+			});
+		connect(this, &ControllerManager::aecpResponseAverageTimeChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::chrono::milliseconds const& value)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::aecpResponseAverageTimeChanged, value);
+			});
+		connect(this, &ControllerManager::aemAecpUnsolicitedCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::aemAecpUnsolicitedCounterChanged, value);
+			});
+		connect(this, &ControllerManager::aemAecpUnsolicitedLossCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::aemAecpUnsolicitedLossCounterChanged, value);
+			});
+		connect(this, &ControllerManager::mvuAecpUnsolicitedCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::mvuAecpUnsolicitedCounterChanged, value);
+			});
+		connect(this, &ControllerManager::mvuAecpUnsolicitedLossCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::mvuAecpUnsolicitedLossCounterChanged, value);
+			});
+		connect(this, &ControllerManager::statisticsErrorCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, StatisticsErrorCounters const& errorCounters)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::statisticsErrorCounterChanged, errorCounters);
+			});
+		connect(this, &ControllerManager::diagnosticsChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Entity, EntityDescriptorIndex, &DescriptorSignaler::diagnosticsChanged, diagnostics);
+			});
+
+		// AvbInterface
+		connect(this, &ControllerManager::avbInterfaceCountersChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AvbInterfaceCounters const& counters)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::AvbInterface, avbInterfaceIndex, &DescriptorSignaler::avbInterfaceCountersChanged, counters);
+			});
+
+		// ClockDomain
+		connect(this, &ControllerManager::clockDomainCountersChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::ClockDomainCounters const& counters)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::ClockDomain, clockDomainIndex, &DescriptorSignaler::clockDomainCountersChanged, counters);
+			});
+
+		// StreamInput
+		connect(this, &ControllerManager::streamInputCountersChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamInputCounters const& counters)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::StreamInput, streamIndex, &DescriptorSignaler::streamInputCountersChanged, counters);
+			});
+		connect(this, &ControllerManager::streamInputErrorCounterChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::DescriptorIndex const descriptorIndex, StreamInputErrorCounters const& errorCounters)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::StreamInput, descriptorIndex, &DescriptorSignaler::streamInputErrorCounterChanged, errorCounters);
+			});
+		connect(this, &ControllerManager::streamInputConnectionChanged, this,
+			[this](la::avdecc::entity::model::StreamIdentification const& stream, la::avdecc::entity::model::StreamInputConnectionInfo const& info)
+			{
+				dispatchToDescriptorSignaler(stream.entityID, DescriptorType::StreamInput, stream.streamIndex, &DescriptorSignaler::streamInputConnectionChanged, info);
+			});
+		connect(this, &ControllerManager::streamInputLatencyErrorChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex, bool const isLatencyError)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::StreamInput, streamIndex, &DescriptorSignaler::streamInputLatencyErrorChanged, isLatencyError);
+			});
+
+		// StreamOutput
+		connect(this, &ControllerManager::streamOutputCountersChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamOutputCounters const& counters)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::StreamOutput, streamIndex, &DescriptorSignaler::streamOutputCountersChanged, counters);
+			});
+
+		// Control
+		connect(this, &ControllerManager::controlCurrentValueOutOfBoundsChanged, this,
+			[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ControlIndex const controlIndex, bool const isValueOutOfBounds)
+			{
+				dispatchToDescriptorSignaler(entityID, DescriptorType::Control, controlIndex, &DescriptorSignaler::controlCurrentValueOutOfBoundsChanged, isValueOutOfBounds);
+			});
+	}
+
+	/** Called by all notifications but discovery ones, before posting their signals */
+	void monitorEvent(char const* const eventName) noexcept
+	{
+		// Discovery events queued so far must be delivered before the signals of this notification
+		_isDiscoveryBatchOpen.store(false, std::memory_order_release);
+
+		monitorDiscoveryEvent(eventName);
+	}
+
+	/** Called by discovery notifications, which are batched by queueDiscoveryEvent */
+	void monitorDiscoveryEvent(char const* const eventName) noexcept
+	{
+		if (!_eventPipelineMonitor.isEnabled())
+		{
+			return;
+		}
+
+		auto const queuedTime = _eventPipelineMonitor.eventQueued(eventName);
+
+		// Posted in the manager's thread event queue, along with the queued signals of the notification (delivered directly if already in the manager's thread)
+		QMetaObject::invokeMethod(this,
+			[this, eventName, queuedTime]()
+			{
+				_eventPipelineMonitor.eventDelivered(eventName, queuedTime);
+			});
+	}
+
+	void markEntityDirty(la::avdecc::UniqueIdentifier const entityID, EntityChangeFlag const flag) noexcept
+	{
+		if (!_coalescedNotificationsEnabled)
+		{
+			return;
+		}
+
+		auto const lg = std::lock_guard{ _coalescedLock };
+		_pendingChanges[entityID].set(flag);
+	}
+
+	// Events recording/replay
+	static la::avdecc::entity::model::jsonSerializer::Flags getEventsLogDumpFlags() noexcept
+	{
+		return la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDiagnostics, la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat };
+	}
+
+	/** The controller only serializes to files, go through a temporary one */
+	template<typename SerializeFunction>
+	static std::optional<QByteArray> serializeThroughFile(SerializeFunction&& serialize) noexcept
+	{
+		auto file = QTemporaryFile{ QDir::temp().filePath("hive_XXXXXX.ans") };
+		if (!file.open())
+		{
+			return std::nullopt;
+		}
+		file.close();
+
+		auto const [error, message] = serialize(file.fileName());
+		// An incomplete dump is still usable
+		if (!!error && error != la::avdecc::jsonSerializer::SerializationError::Incomplete)
+		{
+			return std::nullopt;
+		}
+
+		if (!file.open())
+		{
+			return std::nullopt;
+		}
+		return file.readAll();
+	}
+
+	/** The controller only deserializes from files, go through a temporary one */
+	template<typename LoadFunction>
+	static std::tuple<la::avdecc::jsonSerializer::DeserializationError, std::string> loadThroughFile(QByteArray const& content, LoadFunction&& load) noexcept
+	{
+		auto file = QTemporaryFile{ QDir::temp().filePath("hive_XXXXXX.ans") };
+		if (!file.open() || file.write(content) != content.size())
+		{
+			return { la::avdecc::jsonSerializer::DeserializationError::InternalError, "Cannot write temporary file: " + file.errorString().toStdString() };
+		}
+		file.close();
+
+		return load(file.fileName());
+	}
+
+	/** Signals recorded and replayed as-is, along with the change flag to mark during replay (what the matching Observer callback marks) */
+	template<typename Visitor>
+	static void forEachRecordedSignal(Visitor&& visitor) noexcept
+	{
+		using EventType = eventLog::EventType;
+		auto const None = std::optional<EntityChangeFlag>{};
+
+		visitor(EventType::TransportError, &ControllerManager::transportError, None);
+		visitor(EventType::EntityQueryError, &ControllerManager::entityQueryError, None);
+		visitor(EventType::EntityOffline, &ControllerManager::entityOffline, None);
+		visitor(EventType::EntityRedundantInterfaceOnline, &ControllerManager::entityRedundantInterfaceOnline, EntityChangeFlag::AvbInterface);
+		visitor(EventType::EntityRedundantInterfaceOffline, &ControllerManager::entityRedundantInterfaceOffline, EntityChangeFlag::AvbInterface);
+		visitor(EventType::UnsolicitedRegistrationChanged, &ControllerManager::unsolicitedRegistrationChanged, EntityChangeFlag::EntityInfo);
+		visitor(EventType::CompatibilityChanged, &ControllerManager::compatibilityChanged, EntityChangeFlag::EntityInfo);
+		visitor(EventType::EntityCapabilitiesChanged, &ControllerManager::entityCapabilitiesChanged, EntityChangeFlag::EntityInfo);
+		visitor(EventType::AssociationIDChanged, &ControllerManager::associationIDChanged, EntityChangeFlag::EntityInfo);
+		visitor(EventType::IdentificationStarted, &ControllerManager::identificationStarted, EntityChangeFlag::EntityInfo);
+		visitor(EventType::IdentificationStopped, &ControllerManager::identificationStopped, EntityChangeFlag::EntityInfo);
+		visitor(EventType::GptpChanged, &ControllerManager::gptpChanged, EntityChangeFlag::Gptp);
+		visitor(EventType::AcquireStateChanged, &ControllerManager::acquireStateChanged, EntityChangeFlag::AccessState);
+		visitor(EventType::LockStateChanged, &ControllerManager::lockStateChanged, EntityChangeFlag::AccessState);
+		visitor(EventType::StreamFormatChanged, &ControllerManager::streamFormatChanged, EntityChangeFlag::StreamFormat);
+		visitor(EventType::StreamDynamicInfoChanged, &ControllerManager::streamDynamicInfoChanged, EntityChangeFlag::StreamInfo);
+		visitor(EventType::EntityNameChanged, &ControllerManager::entityNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::EntityGroupNameChanged, &ControllerManager::entityGroupNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::ConfigurationNameChanged, &ControllerManager::configurationNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::AudioUnitNameChanged, &ControllerManager::audioUnitNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::StreamNameChanged, &ControllerManager::streamNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::JackNameChanged, &ControllerManager::jackNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::AvbInterfaceNameChanged, &ControllerManager::avbInterfaceNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::ClockSourceNameChanged, &ControllerManager::clockSourceNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::MemoryObjectNameChanged, &ControllerManager::memoryObjectNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::AudioClusterNameChanged, &ControllerManager::audioClusterNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::ControlNameChanged, &ControllerManager::controlNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::ClockDomainNameChanged, &ControllerManager::clockDomainNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::TimingNameChanged, &ControllerManager::timingNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::PtpInstanceNameChanged, &ControllerManager::ptpInstanceNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::PtpPortNameChanged, &ControllerManager::ptpPortNameChanged, EntityChangeFlag::Names);
+		visitor(EventType::AudioUnitSamplingRateChanged, &ControllerManager::audioUnitSamplingRateChanged, EntityChangeFlag::Configuration);
+		visitor(EventType::ClockSourceChanged, &ControllerManager::clockSourceChanged, EntityChangeFlag::Configuration);
+		visitor(EventType::StreamRunningChanged, &ControllerManager::streamRunningChanged, EntityChangeFlag::StreamInfo);
+		visitor(EventType::AvbInterfaceInfoChanged, &ControllerManager::avbInterfaceInfoChanged, EntityChangeFlag::AvbInterface);
+		visitor(EventType::AsPathChanged, &ControllerManager::asPathChanged, EntityChangeFlag::AvbInterface);
+		visitor(EventType::AvbInterfaceLinkStatusChanged, &ControllerManager::avbInterfaceLinkStatusChanged, EntityChangeFlag::AvbInterface);
+		visitor(EventType::EntityCountersChanged, &ControllerManager::entityCountersChanged, EntityChangeFlag::Counters);
+		visitor(EventType::AvbInterfaceCountersChanged, &ControllerManager::avbInterfaceCountersChanged, EntityChangeFlag::Counters);
+		visitor(EventType::ClockDomainCountersChanged, &ControllerManager::clockDomainCountersChanged, EntityChangeFlag::Counters);
+		visitor(EventType::StreamInputCountersChanged, &ControllerManager::streamInputCountersChanged, EntityChangeFlag::Counters);
+		visitor(EventType::StreamOutputCountersChanged, &ControllerManager::streamOutputCountersChanged, EntityChangeFlag::Counters);
+		visitor(EventType::MemoryObjectLengthChanged, &ControllerManager::memoryObjectLengthChanged, EntityChangeFlag::Operations);
+		visitor(EventType::StreamPortAudioMappingsChanged, &ControllerManager::streamPortAudioMappingsChanged, EntityChangeFlag::AudioMappings);
+		visitor(EventType::OperationProgress, &ControllerManager::operationProgress, EntityChangeFlag::Operations);
+		visitor(EventType::OperationCompleted, &ControllerManager::operationCompleted, EntityChangeFlag::Operations);
+		visitor(EventType::MaxTransitTimeChanged, &ControllerManager::maxTransitTimeChanged, EntityChangeFlag::Configuration);
+		visitor(EventType::SystemUniqueIDChanged, &ControllerManager::systemUniqueIDChanged, EntityChangeFlag::Configuration);
+		visitor(EventType::MediaClockReferenceInfoChanged, &ControllerManager::mediaClockReferenceInfoChanged, EntityChangeFlag::Configuration);
+		visitor(EventType::StreamInputConnectionChanged, &ControllerManager::streamInputConnectionChanged, EntityChangeFlag::Connections);
+		visitor(EventType::StreamOutputConnectionsChanged, &ControllerManager::streamOutputConnectionsChanged, EntityChangeFlag::Connections);
+		visitor(EventType::BeginAecpCommand, &ControllerManager::beginAecpCommand, None);
+		visitor(EventType::EndAecpCommand, &ControllerManager::endAecpCommand, None);
+		visitor(EventType::BeginMilanCommand, &ControllerManager::beginMilanCommand, None);
+		visitor(EventType::EndMilanCommand, &ControllerManager::endMilanCommand, None);
+		visitor(EventType::BeginAcmpCommand, &ControllerManager::beginAcmpCommand, None);
+		visitor(EventType::EndAcmpCommand, &ControllerManager::endAcmpCommand, None);
+		visitor(EventType::StreamInputErrorCounterChanged, &ControllerManager::streamInputErrorCounterChanged, EntityChangeFlag::Counters);
+		visitor(EventType::AecpRetryCounterChanged, &ControllerManager::aecpRetryCounterChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::AecpTimeoutCounterChanged, &ControllerManager::aecpTimeoutCounterChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::AecpUnexpectedResponseCounterChanged, &ControllerManager::aecpUnexpectedResponseCounterChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::AecpResponseAverageTimeChanged, &ControllerManager::aecpResponseAverageTimeChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::AemAecpUnsolicitedCounterChanged, &ControllerManager::aemAecpUnsolicitedCounterChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::AemAecpUnsolicitedLossCounterChanged, &ControllerManager::aemAecpUnsolicitedLossCounterChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::MvuAecpUnsolicitedCounterChanged, &ControllerManager::mvuAecpUnsolicitedCounterChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::MvuAecpUnsolicitedLossCounterChanged, &ControllerManager::mvuAecpUnsolicitedLossCounterChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::StatisticsErrorCounterChanged, &ControllerManager::statisticsErrorCounterChanged, EntityChangeFlag::Statistics);
+		visitor(EventType::RedundancyWarningChanged, &ControllerManager::redundancyWarningChanged, EntityChangeFlag::Diagnostics);
+		visitor(EventType::StreamInputLatencyErrorChanged, &ControllerManager::streamInputLatencyErrorChanged, EntityChangeFlag::Diagnostics);
+		visitor(EventType::ControlCurrentValueOutOfBoundsChanged, &ControllerManager::controlCurrentValueOutOfBoundsChanged, EntityChangeFlag::Diagnostics);
+	}
+
+	template<typename... Args>
+	void connectEventRecorder(eventLog::EventType const type, void (ControllerManager::*signal)(Args...)) noexcept
+	{
+		_eventsRecorderConnections.push_back(connect(
+			this, signal, this,
+			[this, type](Args... args)
+			{
+				recordEvent(type, args...);
+			},
+			Qt::DirectConnection));
+	}
+
+	template<typename... Args>
+	void recordEvent(eventLog::EventType const type, Args const&... args) noexcept
+	{
+		// Arguments might not outlive the signal, serialize them right away
+		auto payload = eventLog::Buffer{};
+		(eventLog::serialize(payload, args), ...);
+		queueRecord(type,
+			[payload = std::move(payload)]() -> std::optional<eventLog::Buffer>
+			{
+				return payload;
+			});
+	}
+
+	/** Queues an event to the recorder thread, its payload is built by makePayload in that thread (event is dropped if it returns std::nullopt). Events are written in the order they are queued, timestamped when queued */
+	void queueRecord(eventLog::EventType const type, std::function<std::optional<eventLog::Buffer>()>&& makePayload) noexcept
+	{
+		auto const lg = std::lock_guard{ _eventsRecorderLock };
+		if (!_eventsRecorder)
+		{
+			return;
+		}
+
+		_eventsRecorderPool.start(
+			[this, type, timestamp = _eventsRecorder->getTimestamp(), makePayload = std::move(makePayload)]()
+			{
+				auto const payload = makePayload();
+				if (!payload)
+				{
+					return;
+				}
+
+				auto const lg = std::lock_guard{ _eventsRecorderLock };
+				if (_eventsRecorder)
+				{
+					_eventsRecorder->writeRecord(type, timestamp, *payload);
+				}
+			});
+	}
+
+	static la::avdecc::UniqueIdentifier getEventEntityID(la::avdecc::UniqueIdentifier const entityID) noexcept
+	{
+		return entityID;
+	}
+
+	static la::avdecc::UniqueIdentifier getEventEntityID(la::avdecc::entity::model::StreamIdentification const& stream) noexcept
+	{
+		return stream.entityID;
+	}
+
+	/** Deserializes the arguments of the signal from the payload and emits it. Returns false if the payload does not match the signal */
+	template<typename... Args>
+	bool replaySignal(void (ControllerManager::*signal)(Args...), std::optional<EntityChangeFlag> const flag, eventLog::Reader& reader) noexcept
+	{
+		auto args = std::tuple<std::decay_t<Args>...>{};
+		std::apply(
+			[&reader](auto&... a)
+			{
+				(eventLog::deserialize(reader, a), ...);
+			},
+			args);
+		if (!reader.isValid())
+		{
+			return false;
+		}
+
+		if constexpr (sizeof...(Args) > 0)
+		{
+			if (flag)
+			{
+				markEntityDirty(getEventEntityID(std::get<0>(args)), *flag);
+			}
+		}
+
+		std::apply(
+			[this, signal](auto const&... a)
+			{
+				emit(this->*signal)(a...);
+			},
+			args);
+		return true;
+	}
+
+	/** Replays a single event. Returns true if the event is announced asynchronously (entity loaded or unloaded), meaning the replay should yield to the event loop */
+	bool replayEvent(eventLog::Event const& event) noexcept
+	{
+		using EventType = eventLog::EventType;
+		auto reader = eventLog::Reader{ event.payload.data(), event.payload.size() };
+
+		switch (event.type)
+		{
+			case EventType::EntityOnline:
+			{
+				auto entityID = la::avdecc::UniqueIdentifier{};
+				auto enumerationTime = std::chrono::milliseconds{};
+				auto entity = QByteArray{};
+				eventLog::deserialize(reader, entityID);
+				eventLog::deserialize(reader, enumerationTime);
+				eventLog::deserialize(reader, entity);
+				if (reader.isValid())
+				{
+					// Going through the controller so the entity is available to consumers, entityOnline will be emitted by the controller
+					loadThroughFile(entity,
+						[this](QString const& path)
+						{
+							return loadVirtualEntityFromJson(path, getEventsLogDumpFlags());
+						});
+				}
+				return true;
+			}
+			case EventType::EntityOffline:
+			{
+				auto entityID = la::avdecc::UniqueIdentifier{};
+				eventLog::deserialize(reader, entityID);
+				if (reader.isValid())
+				{
+					unloadVirtualEntity(entityID);
+				}
+				return true;
+			}
+			case EventType::ControlValuesChanged:
+			{
+				auto entityID = la::avdecc::UniqueIdentifier{};
+				auto controlIndex = la::avdecc::entity::model::ControlIndex{};
+				eventLog::deserialize(reader, entityID);
+				eventLog::deserialize(reader, controlIndex);
+				if (auto const controlledEntity = getControlledEntity(entityID))
+				{
+					try
+					{
+						auto const values = controlledEntity->getControlNode(controlledEntity->getCurrentConfigurationIndex(), controlIndex).dynamicModel.values;
+						markEntityDirty(entityID, EntityChangeFlag::Configuration);
+						emit controlValuesChanged(entityID, controlIndex, values);
+					}
+					catch (...)
+					{
+					}
+				}
+				return false;
+			}
+			case EventType::MediaClockChainChanged:
+			{
+				auto entityID = la::avdecc::UniqueIdentifier{};
+				auto clockDomainIndex = la::avdecc::entity::model::ClockDomainIndex{};
+				eventLog::deserialize(reader, entityID);
+				eventLog::deserialize(reader, clockDomainIndex);
+				if (auto const controlledEntity = getControlledEntity(entityID))
+				{
+					try
+					{
+						auto const mcChain = controlledEntity->getClockDomainNode(controlledEntity->getCurrentConfigurationIndex(), clockDomainIndex).mediaClockChain;
+						markEntityDirty(entityID, EntityChangeFlag::Configuration);
+						emit mediaClockChainChanged(entityID, clockDomainIndex, mcChain);
+					}
+					catch (...)
+					{
+					}
+				}
+				return false;
+			}
+			case EventType::DiagnosticsChanged:
+			{
+				auto entityID = la::avdecc::UniqueIdentifier{};
+				eventLog::deserialize(reader, entityID);
+				if (auto const controlledEntity = getControlledEntity(entityID))
+				{
+					auto const diagnostics = controlledEntity->getDiagnostics();
+					markEntityDirty(entityID, EntityChangeFlag::Diagnostics);
+					emit diagnosticsChanged(entityID, diagnostics);
+				}
+				return false;
+			}
+			default:
+			{
+				auto found = false;
+				forEachRecordedSignal(
+					[this, &event, &reader, &found](EventType const type, auto const signal, std::optional<EntityChangeFlag> const flag)
+					{
+						if (!found && type == event.type)
+						{
+							found = true;
+							replaySignal(signal, flag, reader);
+						}
+					});
+				return false;
+			}
+		}
+	}
+
+	void processEventsReplay() noexcept
+	{
+		if (!_eventsReplay)
+		{
+			return;
+		}
+
+		auto& replay = *_eventsReplay;
+		// Never block the event loop for too long, so consumers (and the UI) get a chance to process what has been replayed
+		auto const sliceEnd = std::chrono::steady_clock::now() + std::chrono::milliseconds{ 10 };
+
+		while (replay.nextEvent < replay.events.size())
+		{
+			auto const& event = replay.events[replay.nextEvent];
+			auto const now = std::chrono::steady_clock::now();
+
+			if (replay.speed == ReplaySpeed::RealTime)
+			{
+				auto const eventTime = replay.startTime + event.timestamp;
+				if (eventTime > now)
+				{
+					_eventsReplayTimer.start(std::chrono::duration_cast<std::chrono::milliseconds>(eventTime - now).count());
+					return;
+				}
+			}
+			if (now >= sliceEnd)
+			{
+				_eventsReplayTimer.start(0);
+				return;
+			}
+
+			++replay.nextEvent;
+			if (replayEvent(event))
+			{
+				// Let the controller announce the entity before replaying its events
+				_eventsReplayTimer.start(0);
+				return;
+			}
+		}
+
+		auto const eventsCount = static_cast<std::uint64_t>(replay.events.size());
+		_eventsReplay.reset();
+		emit eventsReplayFinished(eventsCount);
+	}
+
+	/**
+	* Queues an entity online/offline event. Consecutive events queued before the main thread processes them are handled as a single batch.
+	* Any other notification closes the current batch (see monitorEvent), so its signals are never overtaken by discovery events that happened after it.
+	*/
+	void queueDiscoveryEvent(DiscoveryEvent&& event) noexcept
+	{
+		auto mustSchedule = false;
+		{
+			auto const lg = std::lock_guard{ _discoveryEventsLock };
+			if (_pendingDiscoveryBatches.empty() || !_isDiscoveryBatchOpen.exchange(true, std::memory_order_acq_rel))
+			{
+				// Start a new batch, posted after the signals already queued
+				_pendingDiscoveryBatches.emplace_back();
+				mustSchedule = true;
+			}
+			_pendingDiscoveryBatches.back().push_back(std::move(event));
+		}
+
+		if (mustSchedule)
+		{
+			QMetaObject::invokeMethod(this,
+				[this]()
+				{
+					flushDiscoveryEvents();
+				});
+		}
+	}
+
+	void flushDiscoveryEvents() noexcept
+	{
+		auto events = std::vector<DiscoveryEvent>{};
+		{
+			auto const lg = std::lock_guard{ _discoveryEventsLock };
+			// Batches are flushed in the order they were scheduled (might be empty if the controller was destroyed in the meantime)
+			if (!_pendingDiscoveryBatches.empty())
+			{
+				events.swap(_pendingDiscoveryBatches.front());
+				_pendingDiscoveryBatches.pop_front();
+			}
+		}
+
+		if (events.empty())
+		{
+			return;
+		}
+
+		// Publish a single new map for the whole batch (instead of copying it for each entity, which is quadratic when loading a large network)
+		{
+			auto const lg = std::lock_guard{ _lock };
+			auto caches = std::make_shared<EntityDataCaches>(*loadEntityDataCaches());
+			for (auto& event : events)
+			{
+				if (event.tracker)
+				{
+					_entities.insert(event.entityID);
+					(*caches)[event.entityID] = std::make_shared<EntityDataCacheSlot>(event.tracker);
+				}
+				else
+				{
+					_entities.erase(event.entityID);
+					// Readers still holding the previous snapshot are not affected
+					caches->erase(event.entityID);
+				}
+			}
+			storeEntityDataCaches(std::move(caches));
+		}
+
+		// Then announce all events, in the order they happened
+		for (auto const& event : events)
+		{
+			if (event.tracker)
+			{
+				markEntityDirty(event.entityID, EntityChangeFlag::Online);
+				emit entityOnline(event.entityID, event.enumerationTime);
+			}
+			else
+			{
+				markEntityDirty(event.entityID, EntityChangeFlag::Offline);
+				emit entityOffline(event.entityID);
+			}
+		}
+	}
+
+	void flushCoalescedNotifications() noexcept
+	{
+		auto changes = EntitiesChangedBatch{};
+		{
+			auto const lg = std::lock_guard{ _coalescedLock };
+			changes.swap(_pendingChanges);
+		}
+
+		if (!changes.empty())
+		{
+			emit entitiesChangedBatch(changes);
+		}
+	}
+
 	SharedController getController() noexcept
 	{
 #if HAVE_ATOMIC_SMART_POINTERS
@@ -2725,6 +3998,30 @@ private:
 #endif // HAVE_ATOMIC_SMART_POINTERS
 	}
 
+	// Private types
+	static constexpr auto EntityDescriptorIndex = la::avdecc::entity::model::DescriptorIndex{ 0u };
+
+	struct DescriptorKey
+	{
+		la::avdecc::UniqueIdentifier entityID{};
+		la::avdecc::entity::model::DescriptorType descriptorType{ la::avdecc::entity::model::DescriptorType::Entity };
+		la::avdecc::entity::model::DescriptorIndex descriptorIndex{ 0u };
+
+		bool operator==(DescriptorKey const& other) const noexcept
+		{
+			return entityID == other.entityID && descriptorType == other.descriptorType && descriptorIndex == other.descriptorIndex;
+		}
+
+		struct hash
+		{
+			std::size_t operator()(DescriptorKey const& key) const noexcept
+			{
+				auto const descriptor = (static_cast<std::size_t>(la::avdecc::utils::to_integral(key.descriptorType)) << 16) | static_cast<std::size_t>(key.descriptorIndex);
+				return la::avdecc::UniqueIdentifier::hash{}(key.entityID) ^ (descriptor * 0x9E3779B97F4A7C15ull);
+			}
+		};
+	};
+
 	// Private members
 #if HAVE_ATOMIC_SMART_POINTERS
 	std::atomic_shared_ptr<la::avdecc::controller::Controller> _controller{ nullptr };
@@ -2732,15 +4029,36 @@ private:
 	SharedController _controller{ nullptr };
 #endif // HAVE_ATOMIC_SMART_POINTERS
 
+#if HAVE_ATOMIC_SMART_POINTERS
+	std::atomic_shared_ptr<EntityDataCaches const> _entityDataCaches{ std::make_shared<EntityDataCaches const>() }; // Entities cached data (readers never lock, writers hold _lock)
+#else // !HAVE_ATOMIC_SMART_POINTERS
+	SharedEntityDataCaches _entityDataCaches{ std::make_shared<EntityDataCaches const>() }; // Entities cached data (readers never lock, writers hold _lock)
+#endif // HAVE_ATOMIC_SMART_POINTERS
+
 	mutable std::mutex _lock{}; // Data members exclusive access
 	std::set<la::avdecc::UniqueIdentifier> _entities; // Online entities
-	std::unordered_map<la::avdecc::UniqueIdentifier, EntityDataCache, la::avdecc::UniqueIdentifier::hash> _entityDataCache; // Entities cached data
 	std::unordered_map<CommandsExecutorImpl const*, std::unique_ptr<CommandsExecutorImpl>> _commandsExecutors{};
 	std::chrono::milliseconds _discoveryDelay{};
 	bool _enableAemCache{ false };
 	bool _enableFastEnumeration{ false };
 	bool _fullAemEnumeration{ false };
 	VirtualController _virtualController{ nullptr };
+	std::atomic_bool _coalescedNotificationsEnabled{ false };
+	std::mutex _coalescedLock{}; // Pending coalesced changes exclusive access
+	EntitiesChangedBatch _pendingChanges{}; // Changes accumulated (from any thread) since last flush
+	QTimer _coalescedFlushTimer{}; // Flush timer, running in the manager's thread
+	std::mutex _discoveryEventsLock{}; // Pending discovery events exclusive access
+	std::deque<std::vector<DiscoveryEvent>> _pendingDiscoveryBatches{}; // Online/Offline events (from any thread) not yet processed in the manager's thread, one flush is scheduled for each batch
+	std::atomic_bool _isDiscoveryBatchOpen{ false }; // Whether discovery events can still be appended to the last pending batch
+	EventPipelineMonitor _eventPipelineMonitor{}; // Controller notifications delivery statistics
+	std::unordered_map<DescriptorKey, std::weak_ptr<DescriptorSignaler>, DescriptorKey::hash> _descriptorSignalers{}; // Registered DescriptorSignalers (only accessed from the manager's thread)
+	std::atomic_bool _isRecordingEvents{ false };
+	std::mutex _eventsRecorderLock{}; // Events recorder exclusive access (events are recorded from any thread)
+	std::unique_ptr<eventLog::Writer> _eventsRecorder{};
+	QThreadPool _eventsRecorderPool{}; // Single thread writing recorded events, in the order they were queued
+	std::vector<QMetaObject::Connection> _eventsRecorderConnections{};
+	std::optional<EventsReplay> _eventsReplay{}; // Replay in progress (only accessed from the manager's thread)
+	QTimer _eventsReplayTimer{};
 };
 
 QString ControllerManager::typeToString(AecpCommandType const type) noexcept
@@ -2859,6 +4177,27 @@ QString ControllerManager::typeToString(AcmpCommandType const type) noexcept
 	}
 }
 
+QByteArray ControllerManager::eventPipelineStatisticsToJson(EventPipelineStatistics const& statistics) noexcept
+{
+	auto events = QJsonArray{};
+	for (auto const& [name, stat] : statistics)
+	{
+		auto event = QJsonObject{};
+		event["name"] = QString::fromStdString(name);
+		event["queued"] = static_cast<qint64>(stat.queuedCount);
+		event["delivered"] = static_cast<qint64>(stat.deliveredCount);
+		event["pending"] = static_cast<qint64>(stat.queuedCount - std::min(stat.queuedCount, stat.deliveredCount));
+		event["p50_us"] = static_cast<qint64>(stat.p50Latency.count());
+		event["p99_us"] = static_cast<qint64>(stat.p99Latency.count());
+		event["max_us"] = static_cast<qint64>(stat.maxLatency.count());
+		events.append(event);
+	}
+
+	auto root = QJsonObject{};
+	root["events"] = events;
+	return QJsonDocument{ root }.toJson();
+}
+
 ControllerManager& ControllerManager::getInstance() noexcept
 {
 	static ControllerManagerImpl s_manager{};
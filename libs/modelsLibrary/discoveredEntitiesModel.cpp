@@ -991,5 +991,25 @@ std::size_t DiscoveredEntitiesModel::entitiesCount() const noexcept
 	return _pImpl->entitiesCount();
 }
 
+DiscoveredEntitiesModel const& HeadlessDiscoveredEntitiesModel::model() const noexcept
+{
+	return _model;
+}
+
+int HeadlessDiscoveredEntitiesModel::rowCount(QModelIndex const& /*parent*/) const
+{
+	return static_cast<int>(_model.entitiesCount());
+}
+
+int HeadlessDiscoveredEntitiesModel::columnCount(QModelIndex const& /*parent*/) const
+{
+	return 0;
+}
+
+QVariant HeadlessDiscoveredEntitiesModel::data(QModelIndex const& /*index*/, int /*role*/) const
+{
+	return {};
+}
+
 } // namespace modelsLibrary
 } // namespace hive
@@ -0,0 +1,340 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "eventLog.hpp"
+
+namespace hive
+{
+namespace modelsLibrary
+{
+namespace eventLog
+{
+namespace
+{
+constexpr std::array<char, 8> Magic = { 'H', 'I', 'V', 'E', 'E', 'V', 'L', 'G' };
+constexpr std::uint32_t Version = 1u;
+constexpr std::size_t RecordHeaderSize = sizeof(std::uint16_t) + sizeof(std::uint64_t) + sizeof(std::uint32_t);
+
+} // namespace
+
+/* ************************************************************ */
+/* Serialization                                                */
+/* ************************************************************ */
+void serialize(Buffer& buffer, QByteArray const& value) noexcept
+{
+	detail::writeSize(buffer, static_cast<std::size_t>(value.size()));
+	detail::writeRaw(buffer, value.constData(), static_cast<std::size_t>(value.size()));
+}
+
+void deserialize(Reader& reader, QByteArray& value) noexcept
+{
+	auto const size = detail::readBytesSize(reader, static_cast<std::size_t>(std::numeric_limits<int>::max()));
+	value.resize(static_cast<int>(size));
+	if (!reader.read(value.data(), size))
+	{
+		value.clear();
+	}
+}
+
+void serialize(Buffer& buffer, QString const& value) noexcept
+{
+	serialize(buffer, value.toUtf8());
+}
+
+void deserialize(Reader& reader, QString& value) noexcept
+{
+	auto utf8 = QByteArray{};
+	deserialize(reader, utf8);
+	value = QString::fromUtf8(utf8);
+}
+
+void serialize(Buffer& buffer, std::string const& value) noexcept
+{
+	detail::writeSize(buffer, value.size());
+	detail::writeRaw(buffer, value.data(), value.size());
+}
+
+void deserialize(Reader& reader, std::string& value) noexcept
+{
+	auto const size = detail::readBytesSize(reader, value.max_size());
+	value.resize(size);
+	if (!reader.read(value.data(), size))
+	{
+		value.clear();
+	}
+}
+
+void serialize(Buffer& buffer, la::avdecc::entity::Entity::InterfaceInformation const& value) noexcept
+{
+	serialize(buffer, value.macAddress);
+	serialize(buffer, value.validTime);
+	serialize(buffer, value.gptpGrandmasterID);
+	serialize(buffer, value.gptpDomainNumber);
+}
+
+void deserialize(Reader& reader, la::avdecc::entity::Entity::InterfaceInformation& value) noexcept
+{
+	deserialize(reader, value.macAddress);
+	deserialize(reader, value.validTime);
+	deserialize(reader, value.gptpGrandmasterID);
+	deserialize(reader, value.gptpDomainNumber);
+}
+
+void serialize(Buffer& buffer, la::avdecc::entity::model::StreamIdentification const& value) noexcept
+{
+	serialize(buffer, value.entityID);
+	serialize(buffer, value.streamIndex);
+}
+
+void deserialize(Reader& reader, la::avdecc::entity::model::StreamIdentification& value) noexcept
+{
+	deserialize(reader, value.entityID);
+	deserialize(reader, value.streamIndex);
+}
+
+void serialize(Buffer& buffer, la::avdecc::entity::model::StreamInputConnectionInfo const& value) noexcept
+{
+	serialize(buffer, value.talkerStream);
+	serialize(buffer, value.state);
+}
+
+void deserialize(Reader& reader, la::avdecc::entity::model::StreamInputConnectionInfo& value) noexcept
+{
+	deserialize(reader, value.talkerStream);
+	deserialize(reader, value.state);
+}
+
+void serialize(Buffer& buffer, la::avdecc::entity::model::StreamDynamicInfo const& value) noexcept
+{
+	serialize(buffer, value.isClassB);
+	serialize(buffer, value.hasSavedState);
+	serialize(buffer, value.doesSupportEncrypted);
+	serialize(buffer, value.arePdusEncrypted);
+	serialize(buffer, value.hasTalkerFailed);
+	serialize(buffer, value._streamInfoFlags);
+	serialize(buffer, value.streamID);
+	serialize(buffer, value.msrpAccumulatedLatency);
+	serialize(buffer, value.streamDestMac);
+	serialize(buffer, value.msrpFailureCode);
+	serialize(buffer, value.msrpFailureBridgeID);
+	serialize(buffer, value.streamVlanID);
+	serialize(buffer, value.streamInfoFlagsEx);
+	serialize(buffer, value.probingStatus);
+	serialize(buffer, value.acmpStatus);
+}
+
+void deserialize(Reader& reader, la::avdecc::entity::model::StreamDynamicInfo& value) noexcept
+{
+	deserialize(reader, value.isClassB);
+	deserialize(reader, value.hasSavedState);
+	deserialize(reader, value.doesSupportEncrypted);
+	deserialize(reader, value.arePdusEncrypted);
+	deserialize(reader, value.hasTalkerFailed);
+	deserialize(reader, value._streamInfoFlags);
+	deserialize(reader, value.streamID);
+	deserialize(reader, value.msrpAccumulatedLatency);
+	deserialize(reader, value.streamDestMac);
+	deserialize(reader, value.msrpFailureCode);
+	deserialize(reader, value.msrpFailureBridgeID);
+	deserialize(reader, value.streamVlanID);
+	deserialize(reader, value.streamInfoFlagsEx);
+	deserialize(reader, value.probingStatus);
+	deserialize(reader, value.acmpStatus);
+}
+
+void serialize(Buffer& buffer, la::avdecc::entity::model::MsrpMapping const& value) noexcept
+{
+	serialize(buffer, value.trafficClass);
+	serialize(buffer, value.priority);
+	serialize(buffer, value.vlanID);
+}
+
+void deserialize(Reader& reader, la::avdecc::entity::model::MsrpMapping& value) noexcept
+{
+	deserialize(reader, value.trafficClass);
+	deserialize(reader, value.priority);
+	deserialize(reader, value.vlanID);
+}
+
+void serialize(Buffer& buffer, la::avdecc::entity::model::AvbInterfaceInfo const& value) noexcept
+{
+	serialize(buffer, value.propagationDelay);
+	serialize(buffer, value.flags);
+	serialize(buffer, value.mappings);
+}
+
+void deserialize(Reader& reader, la::avdecc::entity::model::AvbInterfaceInfo& value) noexcept
+{
+	deserialize(reader, value.propagationDelay);
+	deserialize(reader, value.flags);
+	deserialize(reader, value.mappings);
+}
+
+void serialize(Buffer& buffer, la::avdecc::entity::model::AsPath const& value) noexcept
+{
+	serialize(buffer, value.sequence);
+}
+
+void deserialize(Reader& reader, la::avdecc::entity::model::AsPath& value) noexcept
+{
+	deserialize(reader, value.sequence);
+}
+
+void serialize(Buffer& buffer, la::avdecc::entity::model::MediaClockReferenceInfo const& value) noexcept
+{
+	serialize(buffer, value.userMediaClockPriority);
+	// AvdeccFixedString is stored as a regular string
+	auto domainName = std::optional<std::string>{};
+	if (value.mediaClockDomainName)
+	{
+		domainName = value.mediaClockDomainName->str();
+	}
+	serialize(buffer, domainName);
+}
+
+void deserialize(Reader& reader, la::avdecc::entity::model::MediaClockReferenceInfo& value) noexcept
+{
+	deserialize(reader, value.userMediaClockPriority);
+	auto domainName = std::optional<std::string>{};
+	deserialize(reader, domainName);
+	if (domainName)
+	{
+		value.mediaClockDomainName = la::avdecc::entity::model::AvdeccFixedString{ *domainName };
+	}
+	else
+	{
+		value.mediaClockDomainName = std::nullopt;
+	}
+}
+
+/* ************************************************************ */
+/* Writer                                                       */
+/* ************************************************************ */
+std::unique_ptr<Writer> Writer::create(QString const& filePath, QByteArray const& networkState) noexcept
+{
+	auto writer = std::unique_ptr<Writer>{ new Writer{ filePath } };
+	if (!writer->_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		return nullptr;
+	}
+
+	auto header = Buffer{};
+	detail::writeRaw(header, Magic.data(), Magic.size());
+	serialize(header, Version);
+	serialize(header, networkState);
+	if (writer->_file.write(reinterpret_cast<char const*>(header.data()), static_cast<qint64>(header.size())) != static_cast<qint64>(header.size()))
+	{
+		return nullptr;
+	}
+
+	// Timestamps are relative to the end of the snapshot
+	writer->_startTime = std::chrono::steady_clock::now();
+
+	return writer;
+}
+
+Writer::Writer(QString const& filePath) noexcept
+	: _file{ filePath }
+{
+}
+
+Writer::~Writer() noexcept
+{
+	_file.close();
+}
+
+std::chrono::microseconds Writer::getTimestamp() const noexcept
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _startTime);
+}
+
+void Writer::writeRecord(EventType const type, std::chrono::microseconds const timestamp, Buffer const& payload) noexcept
+{
+	_record.clear();
+	_record.reserve(RecordHeaderSize + payload.size());
+	serialize(_record, type);
+	serialize(_record, static_cast<std::uint64_t>(timestamp.count()));
+	detail::writeSize(_record, payload.size());
+	_record.insert(_record.end(), payload.begin(), payload.end());
+
+	_file.write(reinterpret_cast<char const*>(_record.data()), static_cast<qint64>(_record.size()));
+	++_eventsCount;
+}
+
+/* ************************************************************ */
+/* Reader                                                       */
+/* ************************************************************ */
+std::optional<EventLog> readEventLog(QString const& filePath, QString& errorMessage) noexcept
+{
+	auto file = QFile{ filePath };
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		errorMessage = file.errorString();
+		return std::nullopt;
+	}
+
+	auto const content = file.readAll();
+	auto reader = Reader{ reinterpret_cast<std::uint8_t const*>(content.constData()), static_cast<std::size_t>(content.size()) };
+
+	auto magic = decltype(Magic){};
+	auto version = std::uint32_t{ 0u };
+	reader.read(magic.data(), magic.size());
+	deserialize(reader, version);
+	if (!reader.isValid() || magic != Magic)
+	{
+		errorMessage = "Not an event log file";
+		return std::nullopt;
+	}
+	if (version != Version)
+	{
+		errorMessage = QString{ "Unsupported event log version: %1" }.arg(version);
+		return std::nullopt;
+	}
+
+	auto log = EventLog{};
+	deserialize(reader, log.networkState);
+	if (!reader.isValid())
+	{
+		errorMessage = "Truncated network state";
+		return std::nullopt;
+	}
+
+	while (true)
+	{
+		auto type = EventType{};
+		auto timestamp = std::uint64_t{ 0u };
+		deserialize(reader, type);
+		deserialize(reader, timestamp);
+		auto const size = detail::readSize(reader);
+		// End of file (or truncated last record, if recording was interrupted)
+		if (!reader.isValid() || size > reader.remaining())
+		{
+			break;
+		}
+		auto event = Event{ type, std::chrono::microseconds{ timestamp }, Buffer(size) };
+		reader.read(event.payload.data(), size);
+		log.events.push_back(std::move(event));
+	}
+
+	return log;
+}
+
+} // namespace eventLog
+} // namespace modelsLibrary
+} // namespace hive
@@ -0,0 +1,561 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <la/avdecc/controller/avdeccController.hpp>
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hive
+{
+namespace modelsLibrary
+{
+namespace eventLog
+{
+/**
+* @brief Type of a recorded event.
+* @details Values are stored in the event log files, never change an existing value (only append new ones).
+*/
+enum class EventType : std::uint16_t
+{
+	TransportError = 0,
+	EntityQueryError = 1,
+	EntityOnline = 2,
+	EntityOffline = 3,
+	EntityRedundantInterfaceOnline = 4,
+	EntityRedundantInterfaceOffline = 5,
+	UnsolicitedRegistrationChanged = 6,
+	CompatibilityChanged = 7,
+	EntityCapabilitiesChanged = 8,
+	AssociationIDChanged = 9,
+	IdentificationStarted = 10,
+	IdentificationStopped = 11,
+	GptpChanged = 12,
+	AcquireStateChanged = 13,
+	LockStateChanged = 14,
+	StreamFormatChanged = 15,
+	StreamDynamicInfoChanged = 16,
+	EntityNameChanged = 17,
+	EntityGroupNameChanged = 18,
+	ConfigurationNameChanged = 19,
+	AudioUnitNameChanged = 20,
+	StreamNameChanged = 21,
+	JackNameChanged = 22,
+	AvbInterfaceNameChanged = 23,
+	ClockSourceNameChanged = 24,
+	MemoryObjectNameChanged = 25,
+	AudioClusterNameChanged = 26,
+	ControlNameChanged = 27,
+	ClockDomainNameChanged = 28,
+	TimingNameChanged = 29,
+	PtpInstanceNameChanged = 30,
+	PtpPortNameChanged = 31,
+	AudioUnitSamplingRateChanged = 32,
+	ClockSourceChanged = 33,
+	ControlValuesChanged = 34,
+	StreamRunningChanged = 35,
+	AvbInterfaceInfoChanged = 36,
+	AsPathChanged = 37,
+	AvbInterfaceLinkStatusChanged = 38,
+	EntityCountersChanged = 39,
+	AvbInterfaceCountersChanged = 40,
+	ClockDomainCountersChanged = 41,
+	StreamInputCountersChanged = 42,
+	StreamOutputCountersChanged = 43,
+	MemoryObjectLengthChanged = 44,
+	StreamPortAudioMappingsChanged = 45,
+	OperationProgress = 46,
+	OperationCompleted = 47,
+	MediaClockChainChanged = 48,
+	MaxTransitTimeChanged = 49,
+	SystemUniqueIDChanged = 50,
+	MediaClockReferenceInfoChanged = 51,
+	StreamInputConnectionChanged = 52,
+	StreamOutputConnectionsChanged = 53,
+	BeginAecpCommand = 54,
+	EndAecpCommand = 55,
+	BeginMilanCommand = 56,
+	EndMilanCommand = 57,
+	BeginAcmpCommand = 58,
+	EndAcmpCommand = 59,
+	StreamInputErrorCounterChanged = 60,
+	AecpRetryCounterChanged = 61,
+	AecpTimeoutCounterChanged = 62,
+	AecpUnexpectedResponseCounterChanged = 63,
+	AecpResponseAverageTimeChanged = 64,
+	AemAecpUnsolicitedCounterChanged = 65,
+	AemAecpUnsolicitedLossCounterChanged = 66,
+	MvuAecpUnsolicitedCounterChanged = 67,
+	MvuAecpUnsolicitedLossCounterChanged = 68,
+	StatisticsErrorCounterChanged = 69,
+	DiagnosticsChanged = 70,
+	RedundancyWarningChanged = 71,
+	StreamInputLatencyErrorChanged = 72,
+	ControlCurrentValueOutOfBoundsChanged = 73,
+};
+
+using Buffer = std::vector<std::uint8_t>;
+
+/** Sequential reader over an event payload. Once a read fails (not enough data), the reader is invalid and all subsequent reads are ignored. */
+class Reader final
+{
+public:
+	Reader(std::uint8_t const* const data, std::size_t const size) noexcept
+		: _data{ data }
+		, _remaining{ size }
+	{
+	}
+
+	bool read(void* const destination, std::size_t const size) noexcept
+	{
+		if (!_isValid || size > _remaining)
+		{
+			_isValid = false;
+			return false;
+		}
+		std::memcpy(destination, _data, size);
+		_data += size;
+		_remaining -= size;
+		return true;
+	}
+
+	/** Marks the reader as invalid, when the data being read is inconsistent */
+	void invalidate() noexcept
+	{
+		_isValid = false;
+	}
+
+	bool isValid() const noexcept
+	{
+		return _isValid;
+	}
+
+	std::size_t remaining() const noexcept
+	{
+		return _remaining;
+	}
+
+private:
+	std::uint8_t const* _data{ nullptr };
+	std::size_t _remaining{ 0u };
+	bool _isValid{ true };
+};
+
+/* ************************************************************ */
+/* Serialization                                                */
+/* ************************************************************ */
+// Values are stored in native byte order, event logs are meant to be replayed on the same kind of machine they were recorded on.
+
+namespace detail
+{
+template<typename T, typename = void>
+struct HasGetValue : std::false_type
+{
+};
+template<typename T>
+struct HasGetValue<T, std::void_t<decltype(std::declval<T const&>().getValue())>> : std::true_type
+{
+};
+
+inline void writeRaw(Buffer& buffer, void const* const data, std::size_t const size) noexcept
+{
+	auto const* const ptr = static_cast<std::uint8_t const*>(data);
+	buffer.insert(buffer.end(), ptr, ptr + size);
+}
+
+inline void writeSize(Buffer& buffer, std::size_t const size) noexcept
+{
+	auto const value = static_cast<std::uint32_t>(size);
+	writeRaw(buffer, &value, sizeof(value));
+}
+
+inline std::size_t readSize(Reader& reader) noexcept
+{
+	auto value = std::uint32_t{ 0u };
+	reader.read(&value, sizeof(value));
+	return value;
+}
+
+/** Reads the size of a contiguous buffer of bytes, invalidating the reader (and returning 0) if it cannot be read entirely from the remaining data */
+inline std::size_t readBytesSize(Reader& reader, std::size_t const maximumSize) noexcept
+{
+	auto const size = readSize(reader);
+	if (!reader.isValid() || size > reader.remaining() || size > maximumSize)
+	{
+		reader.invalidate();
+		return 0u;
+	}
+	return size;
+}
+
+} // namespace detail
+
+// Declarations (so that containers of any supported type can be (de)serialized whatever the definition order)
+template<typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, int> = 0>
+void serialize(Buffer& buffer, T const value) noexcept;
+template<typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, int> = 0>
+void deserialize(Reader& reader, T& value) noexcept;
+template<typename T, std::enable_if_t<detail::HasGetValue<T>::value, int> = 0>
+void serialize(Buffer& buffer, T const& value) noexcept;
+template<typename T, std::enable_if_t<detail::HasGetValue<T>::value, int> = 0>
+void deserialize(Reader& reader, T& value) noexcept;
+template<typename EnumType>
+void serialize(Buffer& buffer, la::avdecc::utils::EnumBitfield<EnumType> const& value) noexcept;
+template<typename EnumType>
+void deserialize(Reader& reader, la::avdecc::utils::EnumBitfield<EnumType>& value) noexcept;
+template<typename Rep, typename Period>
+void serialize(Buffer& buffer, std::chrono::duration<Rep, Period> const& value) noexcept;
+template<typename Rep, typename Period>
+void deserialize(Reader& reader, std::chrono::duration<Rep, Period>& value) noexcept;
+template<typename T>
+void serialize(Buffer& buffer, std::optional<T> const& value) noexcept;
+template<typename T>
+void deserialize(Reader& reader, std::optional<T>& value) noexcept;
+template<typename T, std::size_t Size>
+void serialize(Buffer& buffer, std::array<T, Size> const& value) noexcept;
+template<typename T, std::size_t Size>
+void deserialize(Reader& reader, std::array<T, Size>& value) noexcept;
+template<typename T>
+void serialize(Buffer& buffer, std::vector<T> const& value) noexcept;
+template<typename T>
+void deserialize(Reader& reader, std::vector<T>& value) noexcept;
+template<typename T>
+void serialize(Buffer& buffer, std::set<T> const& value) noexcept;
+template<typename T>
+void deserialize(Reader& reader, std::set<T>& value) noexcept;
+template<typename Key, typename Value>
+void serialize(Buffer& buffer, std::map<Key, Value> const& value) noexcept;
+template<typename Key, typename Value>
+void deserialize(Reader& reader, std::map<Key, Value>& value) noexcept;
+template<typename Key, typename Value, typename Hash>
+void serialize(Buffer& buffer, std::unordered_map<Key, Value, Hash> const& value) noexcept;
+template<typename Key, typename Value, typename Hash>
+void deserialize(Reader& reader, std::unordered_map<Key, Value, Hash>& value) noexcept;
+
+void serialize(Buffer& buffer, QString const& value) noexcept;
+void deserialize(Reader& reader, QString& value) noexcept;
+void serialize(Buffer& buffer, QByteArray const& value) noexcept;
+void deserialize(Reader& reader, QByteArray& value) noexcept;
+void serialize(Buffer& buffer, std::string const& value) noexcept;
+void deserialize(Reader& reader, std::string& value) noexcept;
+void serialize(Buffer& buffer, la::avdecc::entity::Entity::InterfaceInformation const& value) noexcept;
+void deserialize(Reader& reader, la::avdecc::entity::Entity::InterfaceInformation& value) noexcept;
+void serialize(Buffer& buffer, la::avdecc::entity::model::StreamIdentification const& value) noexcept;
+void deserialize(Reader& reader, la::avdecc::entity::model::StreamIdentification& value) noexcept;
+void serialize(Buffer& buffer, la::avdecc::entity::model::StreamInputConnectionInfo const& value) noexcept;
+void deserialize(Reader& reader, la::avdecc::entity::model::StreamInputConnectionInfo& value) noexcept;
+void serialize(Buffer& buffer, la::avdecc::entity::model::StreamDynamicInfo const& value) noexcept;
+void deserialize(Reader& reader, la::avdecc::entity::model::StreamDynamicInfo& value) noexcept;
+void serialize(Buffer& buffer, la::avdecc::entity::model::MsrpMapping const& value) noexcept;
+void deserialize(Reader& reader, la::avdecc::entity::model::MsrpMapping& value) noexcept;
+void serialize(Buffer& buffer, la::avdecc::entity::model::AvbInterfaceInfo const& value) noexcept;
+void deserialize(Reader& reader, la::avdecc::entity::model::AvbInterfaceInfo& value) noexcept;
+void serialize(Buffer& buffer, la::avdecc::entity::model::AsPath const& value) noexcept;
+void deserialize(Reader& reader, la::avdecc::entity::model::AsPath& value) noexcept;
+void serialize(Buffer& buffer, la::avdecc::entity::model::MediaClockReferenceInfo const& value) noexcept;
+void deserialize(Reader& reader, la::avdecc::entity::model::MediaClockReferenceInfo& value) noexcept;
+
+// Definitions
+template<typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, int>>
+void serialize(Buffer& buffer, T const value) noexcept
+{
+	detail::writeRaw(buffer, &value, sizeof(value));
+}
+
+template<typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, int>>
+void deserialize(Reader& reader, T& value) noexcept
+{
+	reader.read(&value, sizeof(value));
+}
+
+template<typename T, std::enable_if_t<detail::HasGetValue<T>::value, int>>
+void serialize(Buffer& buffer, T const& value) noexcept
+{
+	serialize(buffer, value.getValue());
+}
+
+template<typename T, std::enable_if_t<detail::HasGetValue<T>::value, int>>
+void deserialize(Reader& reader, T& value) noexcept
+{
+	auto v = std::decay_t<decltype(value.getValue())>{};
+	deserialize(reader, v);
+	value = T{ v };
+}
+
+template<typename EnumType>
+void serialize(Buffer& buffer, la::avdecc::utils::EnumBitfield<EnumType> const& value) noexcept
+{
+	serialize(buffer, value.value());
+}
+
+template<typename EnumType>
+void deserialize(Reader& reader, la::avdecc::utils::EnumBitfield<EnumType>& value) noexcept
+{
+	auto v = typename la::avdecc::utils::EnumBitfield<EnumType>::value_type{};
+	deserialize(reader, v);
+	value.assign(v);
+}
+
+template<typename Rep, typename Period>
+void serialize(Buffer& buffer, std::chrono::duration<Rep, Period> const& value) noexcept
+{
+	serialize(buffer, value.count());
+}
+
+template<typename Rep, typename Period>
+void deserialize(Reader& reader, std::chrono::duration<Rep, Period>& value) noexcept
+{
+	auto count = Rep{};
+	deserialize(reader, count);
+	value = std::chrono::duration<Rep, Period>{ count };
+}
+
+template<typename T>
+void serialize(Buffer& buffer, std::optional<T> const& value) noexcept
+{
+	serialize(buffer, value.has_value());
+	if (value)
+	{
+		serialize(buffer, *value);
+	}
+}
+
+template<typename T>
+void deserialize(Reader& reader, std::optional<T>& value) noexcept
+{
+	auto hasValue = false;
+	deserialize(reader, hasValue);
+	if (hasValue)
+	{
+		auto v = T{};
+		deserialize(reader, v);
+		value = std::move(v);
+	}
+	else
+	{
+		value = std::nullopt;
+	}
+}
+
+template<typename T, std::size_t Size>
+void serialize(Buffer& buffer, std::array<T, Size> const& value) noexcept
+{
+	for (auto const& v : value)
+	{
+		serialize(buffer, v);
+	}
+}
+
+template<typename T, std::size_t Size>
+void deserialize(Reader& reader, std::array<T, Size>& value) noexcept
+{
+	for (auto& v : value)
+	{
+		deserialize(reader, v);
+	}
+}
+
+template<typename T>
+void serialize(Buffer& buffer, std::vector<T> const& value) noexcept
+{
+	detail::writeSize(buffer, value.size());
+	for (auto const& v : value)
+	{
+		serialize(buffer, v);
+	}
+}
+
+template<typename T>
+void deserialize(Reader& reader, std::vector<T>& value) noexcept
+{
+	auto const size = detail::readSize(reader);
+	value.clear();
+	for (auto i = std::size_t{ 0u }; i < size && reader.isValid(); ++i)
+	{
+		auto v = T{};
+		deserialize(reader, v);
+		value.push_back(std::move(v));
+	}
+}
+
+template<typename T>
+void serialize(Buffer& buffer, std::set<T> const& value) noexcept
+{
+	detail::writeSize(buffer, value.size());
+	for (auto const& v : value)
+	{
+		serialize(buffer, v);
+	}
+}
+
+template<typename T>
+void deserialize(Reader& reader, std::set<T>& value) noexcept
+{
+	auto const size = detail::readSize(reader);
+	value.clear();
+	for (auto i = std::size_t{ 0u }; i < size && reader.isValid(); ++i)
+	{
+		auto v = T{};
+		deserialize(reader, v);
+		value.insert(std::move(v));
+	}
+}
+
+template<typename Key, typename Value>
+void serialize(Buffer& buffer, std::map<Key, Value> const& value) noexcept
+{
+	detail::writeSize(buffer, value.size());
+	for (auto const& [k, v] : value)
+	{
+		serialize(buffer, k);
+		serialize(buffer, v);
+	}
+}
+
+template<typename Key, typename Value>
+void deserialize(Reader& reader, std::map<Key, Value>& value) noexcept
+{
+	auto const size = detail::readSize(reader);
+	value.clear();
+	for (auto i = std::size_t{ 0u }; i < size && reader.isValid(); ++i)
+	{
+		auto k = Key{};
+		auto v = Value{};
+		deserialize(reader, k);
+		deserialize(reader, v);
+		value.emplace(std::move(k), std::move(v));
+	}
+}
+
+template<typename Key, typename Value, typename Hash>
+void serialize(Buffer& buffer, std::unordered_map<Key, Value, Hash> const& value) noexcept
+{
+	detail::writeSize(buffer, value.size());
+	for (auto const& [k, v] : value)
+	{
+		serialize(buffer, k);
+		serialize(buffer, v);
+	}
+}
+
+template<typename Key, typename Value, typename Hash>
+void deserialize(Reader& reader, std::unordered_map<Key, Value, Hash>& value) noexcept
+{
+	auto const size = detail::readSize(reader);
+	value.clear();
+	for (auto i = std::size_t{ 0u }; i < size && reader.isValid(); ++i)
+	{
+		auto k = Key{};
+		auto v = Value{};
+		deserialize(reader, k);
+		deserialize(reader, v);
+		value.emplace(std::move(k), std::move(v));
+	}
+}
+
+/* ************************************************************ */
+/* Event log file                                               */
+/* ************************************************************ */
+/**
+* @brief Event log file writer.
+* @details File layout: magic, version, network state snapshot (binary .ans), then a sequence of records (type, timestamp relative to the creation of the writer, payload).
+*          Not thread-safe, the caller is responsible for serializing calls to writeEvent and writeRecord (getTimestamp can be called from any thread).
+*/
+class Writer final
+{
+public:
+	/** Creates the event log file and writes its header. Returns nullptr if the file cannot be created. */
+	static std::unique_ptr<Writer> create(QString const& filePath, QByteArray const& networkState) noexcept;
+
+	~Writer() noexcept;
+
+	template<typename... Args>
+	void writeEvent(EventType const type, Args const&... args) noexcept
+	{
+		_payload.clear();
+		(serialize(_payload, args), ...);
+		writeRecord(type, getTimestamp(), _payload);
+	}
+
+	/** Returns the timestamp of an event happening now, for events written later using writeRecord */
+	std::chrono::microseconds getTimestamp() const noexcept;
+
+	/** Writes an event whose payload has already been serialized */
+	void writeRecord(EventType const type, std::chrono::microseconds const timestamp, Buffer const& payload) noexcept;
+
+	std::uint64_t getEventsCount() const noexcept
+	{
+		return _eventsCount;
+	}
+
+	// Deleted compiler auto-generated methods
+	Writer(Writer const&) = delete;
+	Writer(Writer&&) = delete;
+	Writer& operator=(Writer const&) = delete;
+	Writer& operator=(Writer&&) = delete;
+
+private:
+	Writer(QString const& filePath) noexcept;
+
+	QFile _file{};
+	std::chrono::steady_clock::time_point _startTime{};
+	Buffer _payload{};
+	Buffer _record{};
+	std::uint64_t _eventsCount{ 0u };
+};
+
+struct Event
+{
+	EventType type{ EventType::TransportError };
+	std::chrono::microseconds timestamp{};
+	Buffer payload{};
+};
+
+struct EventLog
+{
+	QByteArray networkState{};
+	std::vector<Event> events{};
+};
+
+/** Reads a whole event log file. Returns std::nullopt and sets errorMessage if the file cannot be read or is not a valid event log (a truncated last record is ignored). */
+std::optional<EventLog> readEventLog(QString const& filePath, QString& errorMessage) noexcept;
+
+} // namespace eventLog
+} // namespace modelsLibrary
+} // namespace hive
@@ -0,0 +1,166 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "eventPipelineMonitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace hive
+{
+namespace modelsLibrary
+{
+/* ************************************************************ */
+/* LatencyHistogram                                             */
+/* ************************************************************ */
+void EventPipelineMonitor::LatencyHistogram::add(std::uint64_t const value) noexcept
+{
+	++_buckets[getBucketIndex(value)];
+	++_count;
+	_max = std::max(_max, value);
+}
+
+std::uint64_t EventPipelineMonitor::LatencyHistogram::getPercentile(double const percentile) const noexcept
+{
+	if (_count == 0u)
+	{
+		return 0u;
+	}
+
+	// Rank of the requested value (1-based)
+	auto const rank = std::max(std::uint64_t{ 1u }, static_cast<std::uint64_t>(std::ceil(percentile * static_cast<double>(_count))));
+
+	auto cumulated = std::uint64_t{ 0u };
+	for (auto index = std::size_t{ 0u }; index < _buckets.size(); ++index)
+	{
+		cumulated += _buckets[index];
+		if (cumulated >= rank)
+		{
+			// Never report more than the exact max
+			return std::min(getBucketHighestValue(index), _max);
+		}
+	}
+
+	return _max;
+}
+
+std::uint64_t EventPipelineMonitor::LatencyHistogram::getMax() const noexcept
+{
+	return _max;
+}
+
+std::size_t EventPipelineMonitor::LatencyHistogram::getBucketIndex(std::uint64_t const value) noexcept
+{
+	// Small values have their own bucket
+	if (value < SubBucketsCount)
+	{
+		return static_cast<std::size_t>(value);
+	}
+
+	auto const v = std::min(value, (std::uint64_t{ 1u } << MaxExponent) - 1u);
+
+	// Compute floor(log2(v))
+	auto exponent = 0u;
+	for (auto remaining = v >> 1; remaining != 0u; remaining >>= 1)
+	{
+		++exponent;
+	}
+
+	// Split each power of 2 in SubBucketsCount linear buckets
+	auto const subBucket = static_cast<std::size_t>((v >> (exponent - SubBucketsBits)) & (SubBucketsCount - 1u));
+	return SubBucketsCount + (exponent - SubBucketsBits) * SubBucketsCount + subBucket;
+}
+
+std::uint64_t EventPipelineMonitor::LatencyHistogram::getBucketHighestValue(std::size_t const index) noexcept
+{
+	if (index < SubBucketsCount)
+	{
+		return static_cast<std::uint64_t>(index);
+	}
+
+	auto const exponent = static_cast<unsigned int>((index - SubBucketsCount) / SubBucketsCount) + SubBucketsBits;
+	auto const subBucket = static_cast<std::uint64_t>((index - SubBucketsCount) % SubBucketsCount);
+	return ((SubBucketsCount + subBucket + 1u) << (exponent - SubBucketsBits)) - 1u;
+}
+
+/* ************************************************************ */
+/* EventPipelineMonitor                                         */
+/* ************************************************************ */
+void EventPipelineMonitor::setEnabled(bool const enabled) noexcept
+{
+	_enabled = enabled;
+}
+
+bool EventPipelineMonitor::isEnabled() const noexcept
+{
+	return _enabled;
+}
+
+EventPipelineMonitor::Clock::time_point EventPipelineMonitor::eventQueued(char const* const eventName) noexcept
+{
+	auto const now = Clock::now();
+
+	auto const lg = std::lock_guard{ _lock };
+	++_events[eventName].queuedCount;
+
+	return now;
+}
+
+void EventPipelineMonitor::eventDelivered(char const* const eventName, Clock::time_point const queuedTime) noexcept
+{
+	auto const latency = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - queuedTime);
+
+	auto const lg = std::lock_guard{ _lock };
+	auto& info = _events[eventName];
+	++info.deliveredCount;
+	info.latency.add(static_cast<std::uint64_t>(std::max(latency.count(), decltype(latency.count()){ 0 })));
+}
+
+ControllerManager::EventPipelineStatistics EventPipelineMonitor::getStatistics() const noexcept
+{
+	auto statistics = ControllerManager::EventPipelineStatistics{};
+
+	auto const lg = std::lock_guard{ _lock };
+	for (auto const& [name, info] : _events)
+	{
+		auto& stat = statistics[name];
+		stat.queuedCount = info.queuedCount;
+		stat.deliveredCount = info.deliveredCount;
+		stat.p50Latency = std::chrono::microseconds{ static_cast<std::chrono::microseconds::rep>(info.latency.getPercentile(0.50)) };
+		stat.p99Latency = std::chrono::microseconds{ static_cast<std::chrono::microseconds::rep>(info.latency.getPercentile(0.99)) };
+		stat.maxLatency = std::chrono::microseconds{ static_cast<std::chrono::microseconds::rep>(info.latency.getMax()) };
+	}
+
+	return statistics;
+}
+
+void EventPipelineMonitor::reset() noexcept
+{
+	auto const lg = std::lock_guard{ _lock };
+	for (auto& [name, info] : _events)
+	{
+		// Keep the events still in the queue, so the queue depth remains valid
+		info.queuedCount -= info.deliveredCount;
+		info.deliveredCount = 0u;
+		info.latency = {};
+	}
+}
+
+} // namespace modelsLibrary
+} // namespace hive
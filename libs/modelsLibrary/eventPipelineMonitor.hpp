@@ -0,0 +1,90 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "hive/modelsLibrary/controllerManager.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace hive
+{
+namespace modelsLibrary
+{
+/** Thread-safe counters and latency histograms of the events flowing from the network thread to the manager's thread */
+class EventPipelineMonitor final
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	void setEnabled(bool const enabled) noexcept;
+	bool isEnabled() const noexcept;
+
+	/** Records an event leaving its originating thread, returns the timestamp to pass to eventDelivered */
+	Clock::time_point eventQueued(char const* const eventName) noexcept;
+
+	/** Records the delivery of an event previously queued at queuedTime */
+	void eventDelivered(char const* const eventName, Clock::time_point const queuedTime) noexcept;
+
+	ControllerManager::EventPipelineStatistics getStatistics() const noexcept;
+	void reset() noexcept;
+
+private:
+	/** Log-linear histogram of latencies in microseconds (8 buckets per power of 2, ~12% precision) */
+	class LatencyHistogram
+	{
+	public:
+		void add(std::uint64_t const value) noexcept;
+		std::uint64_t getPercentile(double const percentile) const noexcept;
+		std::uint64_t getMax() const noexcept;
+
+	private:
+		static constexpr auto SubBucketsBits = 3u;
+		static constexpr auto SubBucketsCount = 1u << SubBucketsBits;
+		static constexpr auto MaxExponent = 40u; // Values are clamped to 2^40 usec (~12 days)
+		static constexpr auto BucketsCount = SubBucketsCount + (MaxExponent - SubBucketsBits) * SubBucketsCount;
+
+		static std::size_t getBucketIndex(std::uint64_t const value) noexcept;
+		static std::uint64_t getBucketHighestValue(std::size_t const index) noexcept;
+
+		std::array<std::uint64_t, BucketsCount> _buckets{};
+		std::uint64_t _count{ 0u };
+		std::uint64_t _max{ 0u };
+	};
+
+	struct EventInfo
+	{
+		std::uint64_t queuedCount{ 0u };
+		std::uint64_t deliveredCount{ 0u };
+		LatencyHistogram latency{};
+	};
+
+	std::atomic_bool _enabled{ false };
+	mutable std::mutex _lock{};
+	std::unordered_map<std::string, EventInfo> _events{};
+};
+
+} // namespace modelsLibrary
+} // namespace hive
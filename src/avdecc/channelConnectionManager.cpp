@@ -18,7 +18,6 @@
 */
 
 #include "channelConnectionManager.hpp"
-#include "helper.hpp"
 #include "hiveLogItems.hpp"
 
 #include <la/avdecc/avdecc.hpp>
@@ -2532,30 +2531,7 @@ private:
 	std::vector<StreamIdentificationPair> getStreamIndexPairUsedByAudioChannelConnection(la::avdecc::UniqueIdentifier const& talkerEntityId, avdecc::ChannelIdentification const& talkerChannelIdentification, la::avdecc::UniqueIdentifier const& listenerEntityId, avdecc::ChannelIdentification const& listenerChannelIdentification) noexcept
 	{
 		auto connections = getChannelConnectionsReverse(listenerEntityId, listenerChannelIdentification);
-		for (auto const& deviceConnection : connections->targets)
-		{
-			if (deviceConnection->targetEntityId == talkerEntityId)
-			{
-				for (auto const& targetClusterKV : deviceConnection->targetClusterChannels)
-				{
-					if (deviceConnection->targetAudioUnitIndex == *listenerChannelIdentification.audioUnitIndex && deviceConnection->targetStreamPortIndex == *talkerChannelIdentification.streamPortIndex && targetClusterKV.first == talkerChannelIdentification.clusterIndex - *talkerChannelIdentification.baseCluster && targetClusterKV.second == talkerChannelIdentification.clusterChannel)
-					{
-						std::vector<StreamIdentificationPair> result;
-						for (auto const& [talkerStreamIndex, listenerStreamIndex] : deviceConnection->streamPairs)
-						{
-							la::avdecc::entity::model::StreamIdentification streamTalker{ talkerEntityId, talkerStreamIndex };
-							la::avdecc::entity::model::StreamIdentification streamListener{ listenerEntityId, listenerStreamIndex };
-
-							result.push_back(std::make_pair(streamTalker, streamListener));
-						}
-
-						return result;
-					}
-				}
-			}
-		}
-
-		return {};
+		return avdecc::getStreamIndexPairUsedByAudioChannelConnection(*connections, talkerEntityId, talkerChannelIdentification, listenerEntityId, listenerChannelIdentification);
 	}
 
 	/**
@@ -3665,6 +3641,34 @@ private:
 	}
 };
 
+std::vector<StreamIdentificationPair> getStreamIndexPairUsedByAudioChannelConnection(TargetConnectionInformations const& listenerChannelConnections, la::avdecc::UniqueIdentifier const& talkerEntityId, ChannelIdentification const& talkerChannelIdentification, la::avdecc::UniqueIdentifier const& listenerEntityId, ChannelIdentification const& listenerChannelIdentification) noexcept
+{
+	for (auto const& deviceConnection : listenerChannelConnections.targets)
+	{
+		if (deviceConnection->targetEntityId == talkerEntityId)
+		{
+			for (auto const& targetClusterKV : deviceConnection->targetClusterChannels)
+			{
+				if (deviceConnection->targetAudioUnitIndex == *listenerChannelIdentification.audioUnitIndex && deviceConnection->targetStreamPortIndex == *talkerChannelIdentification.streamPortIndex && targetClusterKV.first == talkerChannelIdentification.clusterIndex - *talkerChannelIdentification.baseCluster && targetClusterKV.second == talkerChannelIdentification.clusterChannel)
+				{
+					std::vector<StreamIdentificationPair> result;
+					for (auto const& [talkerStreamIndex, listenerStreamIndex] : deviceConnection->streamPairs)
+					{
+						la::avdecc::entity::model::StreamIdentification streamTalker{ talkerEntityId, talkerStreamIndex };
+						la::avdecc::entity::model::StreamIdentification streamListener{ listenerEntityId, listenerStreamIndex };
+
+						result.push_back(std::make_pair(streamTalker, streamListener));
+					}
+
+					return result;
+				}
+			}
+		}
+	}
+
+	return {};
+}
+
 /**
 * Singleton implementation. Gets the instance.
 * @return The channel connection manager instance.
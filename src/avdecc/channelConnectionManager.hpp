@@ -146,6 +146,12 @@ struct TargetConnectionInformations
 	}
 };
 
+/**
+* Returns the stream pairs used by the connection of a talker channel to a listener channel, or an empty list if they are not connected.
+* Thread safe, as it only reads listenerChannelConnections (the connections of the listener channel, as returned by ChannelConnectionManager::getChannelConnectionsReverse).
+*/
+std::vector<StreamIdentificationPair> getStreamIndexPairUsedByAudioChannelConnection(TargetConnectionInformations const& listenerChannelConnections, la::avdecc::UniqueIdentifier const& talkerEntityId, ChannelIdentification const& talkerChannelIdentification, la::avdecc::UniqueIdentifier const& listenerEntityId, ChannelIdentification const& listenerChannelIdentification) noexcept;
+
 struct SourceChannelConnections
 {
 	std::map<ChannelIdentification, std::shared_ptr<TargetConnectionInformations>> channelMappings;
@@ -18,7 +18,6 @@
 */
 
 #include "commandChain.hpp"
-#include "helper.hpp"
 
 #include <la/avdecc/internals/streamFormatInfo.hpp>
 #include <hive/modelsLibrary/controllerManager.hpp>
@@ -18,7 +18,6 @@
 */
 
 #include "mcDomainManager.hpp"
-#include "helper.hpp"
 
 #include <hive/modelsLibrary/helper.hpp>
 #include <hive/modelsLibrary/controllerManager.hpp>
@@ -26,6 +25,7 @@
 
 #include <atomic>
 #include <optional>
+#include <set>
 #include <unordered_set>
 #include <math.h>
 
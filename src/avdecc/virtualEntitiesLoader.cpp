@@ -0,0 +1,280 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "virtualEntitiesLoader.hpp"
+
+#include <hive/modelsLibrary/controllerManager.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryFile>
+#include <QThread>
+
+#include <tuple>
+
+namespace avdecc
+{
+namespace
+{
+auto constexpr NetworkStateEntitiesKey = "entities";
+
+} // namespace
+
+VirtualEntitiesLoader::VirtualEntitiesLoader(QObject* parent)
+	: QObject{ parent }
+{
+	qRegisterMetaType<FileType>("avdecc::VirtualEntitiesLoader::FileType");
+	qRegisterMetaType<la::avdecc::jsonSerializer::DeserializationError>("la::avdecc::jsonSerializer::DeserializationError");
+}
+
+VirtualEntitiesLoader::~VirtualEntitiesLoader() noexcept
+{
+	cancelAndWait();
+}
+
+bool VirtualEntitiesLoader::load(QString const& filePath, FileType const fileType, la::avdecc::entity::model::jsonSerializer::Flags const flags) noexcept
+{
+	if (isLoading())
+	{
+		return false;
+	}
+
+	// Previous worker is over (loadFinished already emitted), it's only returning from its thread function
+	if (_thread)
+	{
+		_thread->wait();
+		delete _thread;
+		_thread = nullptr;
+	}
+
+	_cancelRequested = false;
+	_isLoading = true;
+	auto const runID = ++_runID;
+	_thread = QThread::create(
+		[this, runID, filePath, fileType, flags]()
+		{
+			run(runID, filePath, fileType, flags);
+		});
+	_thread->start();
+
+	return true;
+}
+
+void VirtualEntitiesLoader::cancel() noexcept
+{
+	_cancelRequested = true;
+}
+
+void VirtualEntitiesLoader::cancelAndWait() noexcept
+{
+	if (_thread)
+	{
+		_cancelRequested = true;
+		_thread->wait();
+		delete _thread;
+		_thread = nullptr;
+	}
+	_isLoading = false;
+
+	// Notifications of the previous run still queued in the event loop will be ignored
+	++_runID;
+}
+
+bool VirtualEntitiesLoader::isLoading() const noexcept
+{
+	return _isLoading;
+}
+
+void VirtualEntitiesLoader::run(std::uint32_t const runID, QString const& filePath, FileType const fileType, la::avdecc::entity::model::jsonSerializer::Flags const flags) noexcept
+{
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+
+	// Single entity, nothing to split
+	if (fileType == FileType::VirtualEntity)
+	{
+		notifyProgress(runID, filePath, 0, 1);
+		auto const [error, message] = manager.loadVirtualEntityFromJson(filePath, flags);
+		notifyProgress(runID, filePath, 1, 1);
+		finish(runID, filePath, FileType::VirtualEntity, error, message);
+		return;
+	}
+
+	auto const isBinary = flags.test(la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat);
+
+	// Read and parse the whole file
+	auto document = nlohmann::json{};
+	{
+		auto file = QFile{ filePath };
+		if (!file.open(QIODevice::ReadOnly))
+		{
+			finish(runID, filePath, fileType, file.error() == QFileDevice::PermissionsError ? la::avdecc::jsonSerializer::DeserializationError::AccessDenied : la::avdecc::jsonSerializer::DeserializationError::FileReadError, file.errorString().toStdString());
+			return;
+		}
+
+		auto const content = file.readAll();
+		try
+		{
+			if (isBinary)
+			{
+				document = nlohmann::json::from_msgpack(content.constData(), content.constData() + content.size());
+			}
+			else
+			{
+				document = nlohmann::json::parse(content.constData(), content.constData() + content.size());
+			}
+		}
+		catch (nlohmann::json::exception const& e)
+		{
+			finish(runID, filePath, fileType, la::avdecc::jsonSerializer::DeserializationError::ParseError, e.what());
+			return;
+		}
+	}
+
+	// Not a network state, load it as a single entity
+	if (!document.is_object() || !document.contains(NetworkStateEntitiesKey))
+	{
+		if (fileType == FileType::NetworkState)
+		{
+			finish(runID, filePath, fileType, la::avdecc::jsonSerializer::DeserializationError::MissingKey, NetworkStateEntitiesKey);
+			return;
+		}
+
+		// Release the parsed document before loading the file again
+		document = nullptr;
+		notifyProgress(runID, filePath, 0, 1);
+		auto const [error, message] = manager.loadVirtualEntityFromJson(filePath, flags);
+		notifyProgress(runID, filePath, 1, 1);
+		finish(runID, filePath, FileType::VirtualEntity, error, message);
+		return;
+	}
+
+	auto& entities = document[NetworkStateEntitiesKey];
+	if (!entities.is_array())
+	{
+		finish(runID, filePath, FileType::NetworkState, la::avdecc::jsonSerializer::DeserializationError::InvalidValue, NetworkStateEntitiesKey);
+		return;
+	}
+
+	// Each entity of a network state has the same format as a virtual entity file, load them one by one through a temporary file
+	auto entityFile = QTemporaryFile{ QDir::temp().filePath(isBinary ? "hive_XXXXXX.ave" : "hive_XXXXXX.json") };
+	if (!entityFile.open())
+	{
+		finish(runID, filePath, FileType::NetworkState, la::avdecc::jsonSerializer::DeserializationError::InternalError, "Cannot create temporary file: " + entityFile.errorString().toStdString());
+		return;
+	}
+	entityFile.close();
+
+	auto const totalCount = static_cast<int>(entities.size());
+	auto firstError = la::avdecc::jsonSerializer::DeserializationError::NoError;
+	auto firstErrorMessage = std::string{};
+	notifyProgress(runID, filePath, 0, totalCount);
+
+	for (auto index = 0; index < totalCount; ++index)
+	{
+		if (_cancelRequested)
+		{
+			break;
+		}
+
+		auto error = la::avdecc::jsonSerializer::DeserializationError::NoError;
+		auto message = std::string{};
+
+		try
+		{
+			// Move the entity out of the document, it's no longer needed once loaded
+			auto const entity = std::move(entities[static_cast<std::size_t>(index)]);
+
+			if (!entityFile.open() || !entityFile.resize(0))
+			{
+				error = la::avdecc::jsonSerializer::DeserializationError::InternalError;
+				message = "Cannot write temporary file: " + entityFile.errorString().toStdString();
+			}
+			else
+			{
+				if (isBinary)
+				{
+					auto const binary = nlohmann::json::to_msgpack(entity);
+					entityFile.write(reinterpret_cast<char const*>(binary.data()), static_cast<qint64>(binary.size()));
+				}
+				else
+				{
+					auto const text = entity.dump();
+					entityFile.write(text.data(), static_cast<qint64>(text.size()));
+				}
+				entityFile.close();
+
+				std::tie(error, message) = manager.loadVirtualEntityFromJson(entityFile.fileName(), flags);
+			}
+		}
+		catch (nlohmann::json::exception const& e)
+		{
+			error = la::avdecc::jsonSerializer::DeserializationError::InvalidValue;
+			message = e.what();
+		}
+
+		// Continue with the next entity, but remember the first error
+		if (!!error && !firstError)
+		{
+			firstError = error;
+			firstErrorMessage = message;
+		}
+
+		notifyProgress(runID, filePath, index + 1, totalCount);
+	}
+
+	finish(runID, filePath, FileType::NetworkState, firstError, firstErrorMessage);
+}
+
+void VirtualEntitiesLoader::notifyProgress(std::uint32_t const runID, QString const& filePath, int const loadedCount, int const totalCount) noexcept
+{
+	// Always emit from the thread owning the loader, so a cancelled run can be told apart
+	QMetaObject::invokeMethod(
+		this,
+		[this, runID, filePath, loadedCount, totalCount]()
+		{
+			if (runID == _runID)
+			{
+				emit progressChanged(filePath, loadedCount, totalCount);
+			}
+		},
+		Qt::QueuedConnection);
+}
+
+void VirtualEntitiesLoader::finish(std::uint32_t const runID, QString const& filePath, FileType const fileType, la::avdecc::jsonSerializer::DeserializationError const error, std::string const& message) noexcept
+{
+	auto const cancelled = _cancelRequested.load();
+
+	// Ready for another load as soon as the result is known
+	_isLoading = false;
+
+	QMetaObject::invokeMethod(
+		this,
+		[this, runID, filePath, fileType, error, message = QString::fromStdString(message), cancelled]()
+		{
+			if (runID == _runID)
+			{
+				emit loadFinished(filePath, fileType, error, message, cancelled);
+			}
+		},
+		Qt::QueuedConnection);
+}
+
+} // namespace avdecc
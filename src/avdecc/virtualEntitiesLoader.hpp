@@ -0,0 +1,91 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <la/avdecc/controller/avdeccController.hpp>
+
+#include <QObject>
+#include <QString>
+
+#include <atomic>
+#include <cstdint>
+
+class QThread;
+
+namespace avdecc
+{
+/**
+* @brief Loads virtual entities files (.ave, .ans, .json) in a worker thread.
+* @details Network states are split into entities which are loaded one at a time, so the load can be cancelled and its progress reported.
+*          Signals are emitted from the thread owning the loader.
+*/
+class VirtualEntitiesLoader final : public QObject
+{
+	Q_OBJECT
+public:
+	enum class FileType
+	{
+		VirtualEntity = 0, /**< Single entity (.ave) */
+		NetworkState = 1, /**< Full network state (.ans) */
+		AutoDetect = 2, /**< Either one (.json) */
+	};
+
+	VirtualEntitiesLoader(QObject* parent = nullptr);
+	~VirtualEntitiesLoader() noexcept;
+
+	/** Starts loading the specified file. Returns false if a load is already in progress. */
+	bool load(QString const& filePath, FileType const fileType, la::avdecc::entity::model::jsonSerializer::Flags const flags) noexcept;
+
+	/** Requests the current load to stop (entities already loaded are kept). loadFinished will be emitted with cancelled set. */
+	void cancel() noexcept;
+
+	/** Requests the current load to stop and blocks until the worker is over. Notifications of the cancelled load still pending are dropped (loadFinished won't be emitted for it). */
+	void cancelAndWait() noexcept;
+
+	/** Returns true if a load is in progress. */
+	bool isLoading() const noexcept;
+
+	/** Emitted after each entity has been processed */
+	Q_SIGNAL void progressChanged(QString const& filePath, int const loadedCount, int const totalCount);
+
+	/** Emitted once the load is over. fileType is the detected type, error is the first error encountered (loading continues with the next entity) */
+	Q_SIGNAL void loadFinished(QString const& filePath, avdecc::VirtualEntitiesLoader::FileType const fileType, la::avdecc::jsonSerializer::DeserializationError const error, QString const& message, bool const cancelled);
+
+	// Deleted compiler auto-generated methods
+	VirtualEntitiesLoader(VirtualEntitiesLoader const&) = delete;
+	VirtualEntitiesLoader(VirtualEntitiesLoader&&) = delete;
+	VirtualEntitiesLoader& operator=(VirtualEntitiesLoader const&) = delete;
+	VirtualEntitiesLoader& operator=(VirtualEntitiesLoader&&) = delete;
+
+private:
+	void run(std::uint32_t const runID, QString const& filePath, FileType const fileType, la::avdecc::entity::model::jsonSerializer::Flags const flags) noexcept;
+	void notifyProgress(std::uint32_t const runID, QString const& filePath, int const loadedCount, int const totalCount) noexcept;
+	void finish(std::uint32_t const runID, QString const& filePath, FileType const fileType, la::avdecc::jsonSerializer::DeserializationError const error, std::string const& message) noexcept;
+
+	QThread* _thread{ nullptr };
+	std::uint32_t _runID{ 0u }; // Identifies the current load, only accessed from the thread owning the loader
+	std::atomic_bool _cancelRequested{ false };
+	std::atomic_bool _isLoading{ false };
+};
+
+} // namespace avdecc
+
+Q_DECLARE_METATYPE(avdecc::VirtualEntitiesLoader::FileType)
+Q_DECLARE_METATYPE(la::avdecc::jsonSerializer::DeserializationError)
@@ -32,6 +32,7 @@
 #include <QContextMenuEvent>
 #include <QMenu>
 
+#include <algorithm>
 #include <optional>
 
 #if ENABLE_CONNECTION_MATRIX_DEBUG
@@ -45,6 +46,38 @@
 
 namespace connectionMatrix
 {
+// Returns true if every name matching pattern is known to also match previousPattern (only detected for literal patterns)
+static bool isNarrowingPattern(QRegularExpression const& previousPattern, QRegularExpression const& pattern)
+{
+	if (!previousPattern.isValid() || !pattern.isValid() || previousPattern.patternOptions() != pattern.patternOptions() || pattern.patternOptions().testFlag(QRegularExpression::ExtendedPatternSyntaxOption))
+	{
+		return false;
+	}
+
+	auto const isLiteral = [](QString const& p)
+	{
+		static auto const MetaCharacters = QString{ "\\^$.|?*+()[]{}" };
+		for (auto const c : p)
+		{
+			if (MetaCharacters.contains(c))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	auto const previous = previousPattern.pattern();
+	auto const current = pattern.pattern();
+	if (!isLiteral(previous) || !isLiteral(current))
+	{
+		return false;
+	}
+
+	auto const caseSensitivity = pattern.patternOptions().testFlag(QRegularExpression::CaseInsensitiveOption) ? Qt::CaseInsensitive : Qt::CaseSensitive;
+	return current.contains(previous, caseSensitivity);
+}
+
 HeaderView::HeaderView(bool const isListenersHeader, Qt::Orientation const orientation, QWidget* parent)
 	: QHeaderView{ orientation, parent }
 	, _isListenersHeader(isListenersHeader)
@@ -70,17 +103,20 @@ bool HeaderView::isListenersHeader() const noexcept
 void HeaderView::setAlwaysShowArrowTip(bool const show)
 {
 	_alwaysShowArrowTip = show;
+	invalidateCachedSections();
 	update();
 }
 void HeaderView::setAlwaysShowArrowEnd(bool const show)
 {
 	_alwaysShowArrowEnd = show;
+	invalidateCachedSections();
 	update();
 }
 
 void HeaderView::setTransposed(bool const isTransposed)
 {
 	_isTransposed = isTransposed;
+	invalidateCachedSections();
 	update();
 }
 
@@ -93,6 +129,7 @@ void HeaderView::setCollapsedByDefault(bool const collapsedByDefault)
 void HeaderView::setColor(qtMate::material::color::Name const name)
 {
 	_colorName = name;
+	invalidateCachedSections();
 	update();
 }
 
@@ -119,8 +156,9 @@ void HeaderView::restoreSectionState(QVector<SectionState> const& sectionState)
 
 void HeaderView::setFilterPattern(QRegularExpression const& pattern)
 {
+	auto const isNarrowing = isNarrowingPattern(_pattern, pattern);
 	_pattern = pattern;
-	applyFilterPattern();
+	applyFilterPattern(isNarrowing);
 }
 
 void HeaderView::expandAll()
@@ -129,11 +167,10 @@ void HeaderView::expandAll()
 	{
 		_sectionState[section].expanded = true;
 		_sectionState[section].visible = true;
-
-		updateSectionVisibility(section);
 	}
 
-	applyFilterPattern();
+	// Visibility of all sections is applied at once (the pattern did not change, previous matches are still valid)
+	applyFilterPattern(true);
 }
 
 void HeaderView::collapseAll()
@@ -154,11 +191,10 @@ void HeaderView::collapseAll()
 			_sectionState[section].expanded = false;
 			_sectionState[section].visible = false;
 		}
-
-		updateSectionVisibility(section);
 	}
 
-	applyFilterPattern();
+	// Visibility of all sections is applied at once (the pattern did not change, previous matches are still valid)
+	applyFilterPattern(true);
 }
 
 bool HeaderView::isNodeAndChildrenExpanded(int logicalIndex) const
@@ -283,6 +319,10 @@ void HeaderView::handleSectionClicked(int logicalIndex)
 
 void HeaderView::handleSectionInserted(QModelIndex const& /*parent*/, int first, int last)
 {
+	// Logical indexes are shifted
+	invalidateCachedSections();
+	_filterMatches.clear();
+
 	auto const it = std::next(std::begin(_sectionState), first);
 	_sectionState.insert(it, last - first + 1, {});
 
@@ -345,14 +385,63 @@ void HeaderView::handleSectionRemoved(QModelIndex const& /*parent*/, int first,
 {
 	_sectionState.remove(first, last - first + 1);
 
+	// Logical indexes are shifted
+	invalidateCachedSections();
+	_filterMatches.clear();
+
 #if ENABLE_CONNECTION_MATRIX_DEBUG
 	qDebug() << "handleSectionRemoved" << _sectionState.count();
 #endif
 }
 
+void HeaderView::handleModelAboutToBeReset()
+{
+	_sectionStateBeforeReset.clear();
+
+	auto* model = static_cast<Model*>(this->model());
+	_modeBeforeReset = model->mode();
+
+	for (auto section = 0; section < _sectionState.count(); ++section)
+	{
+		if (auto const* const node = model->node(section, orientation()))
+		{
+			_sectionStateBeforeReset.emplace(node, _sectionState[section]);
+		}
+	}
+}
+
 void HeaderView::handleModelReset()
 {
 	_sectionState.clear();
+	invalidateCachedSections();
+	_filterMatches.clear();
+
+	// The model may be populated as part of the reset, initialize all sections as if they were just inserted
+	if (auto* const model = static_cast<Model*>(this->model()))
+	{
+		auto const sectionsCount = orientation() == Qt::Vertical ? model->rowCount() : model->columnCount();
+		if (sectionsCount > 0)
+		{
+			handleSectionInserted({}, 0, sectionsCount - 1);
+
+			// Nodes are kept when entities are inserted at once, restore the state of the sections that were already there
+			if (!_sectionStateBeforeReset.empty() && model->mode() == _modeBeforeReset)
+			{
+				for (auto section = 0; section < sectionsCount; ++section)
+				{
+					auto const it = _sectionStateBeforeReset.find(model->node(section, orientation()));
+					if (it != std::end(_sectionStateBeforeReset))
+					{
+						_sectionState[section] = it->second;
+						updateSectionVisibility(section);
+					}
+				}
+			}
+		}
+	}
+
+	// Nodes may have been destroyed during the reset, do not keep their addresses
+	_sectionStateBeforeReset.clear();
 }
 
 void HeaderView::updateSectionVisibility(int const logicalIndex)
@@ -372,30 +461,51 @@ void HeaderView::updateSectionVisibility(int const logicalIndex)
 	}
 }
 
-void HeaderView::applyFilterPattern()
+void HeaderView::applyFilterPattern(bool const isNarrowing)
 {
 	auto* model = static_cast<Model*>(this->model());
+	auto const sectionsCount = count();
+
+	if (!AVDECC_ASSERT_WITH_RET(_sectionState.count() == sectionsCount, "invalid count"))
+	{
+		return;
+	}
 
-	auto const showVisitor = [=](Node* node)
+	// Previous matches can only be reused if no section was inserted nor removed since they were computed
+	if (!isNarrowing || _filterMatches.size() != static_cast<std::size_t>(sectionsCount))
+	{
+		_filterMatches.assign(sectionsCount, true);
+	}
+
+	// First compute the visibility of all sections, sections not belonging to an entity (like the offline output streams) are not filtered
+	auto visibility = std::vector<bool>(sectionsCount, false);
+	for (auto section = 0; section < sectionsCount; ++section)
+	{
+		visibility[section] = _sectionState[section].visible;
+	}
+
+	auto const showVisitor = [&](Node* node)
 	{
 		auto const section = model->section(node, orientation());
-		updateSectionVisibility(section); // Conditional update
+		visibility[section] = _sectionState[section].visible; // Conditional update
 	};
 
-	auto const hideVisitor = [=](Node* node)
+	auto const hideVisitor = [&](Node* node)
 	{
 		auto const section = model->section(node, orientation());
-		hideSection(section); // Hide section no matter what
+		visibility[section] = false; // Hide section no matter what
 	};
 
-	for (auto section = 0; section < count(); ++section)
+	for (auto section = 0; section < sectionsCount; ++section)
 	{
 		auto* node = model->node(section, orientation());
 		if (node->type() == Node::Type::Entity)
 		{
-			auto const matches = !node->name().contains(_pattern);
+			// An entity not matching the previous pattern cannot match a narrower one
+			auto const matches = _filterMatches[section] && node->name().contains(_pattern);
+			_filterMatches[section] = matches;
 
-			if (!matches)
+			if (matches)
 			{
 				model->accept(node, showVisitor);
 			}
@@ -405,6 +515,68 @@ void HeaderView::applyFilterPattern()
 			}
 		}
 	}
+
+	// Then only change the sections that need to, without repainting between each of them
+	auto const updatesEnabled = this->updatesEnabled();
+	setUpdatesEnabled(false);
+
+	for (auto section = 0; section < sectionsCount; ++section)
+	{
+		auto const isVisible = visibility[section];
+		if (isSectionHidden(section) == isVisible)
+		{
+			setSectionHidden(section, !isVisible);
+		}
+	}
+
+	setUpdatesEnabled(updatesEnabled);
+}
+
+void HeaderView::handleHeaderDataChanged(Qt::Orientation orientation, int first, int last)
+{
+	if (orientation != this->orientation())
+	{
+		return;
+	}
+
+	// The name may have changed, the entity has to be matched again
+	for (auto section = std::max(first, 0); section <= last && section < static_cast<int>(_filterMatches.size()); ++section)
+	{
+		_filterMatches[section] = true;
+	}
+
+	if (_cachedSections.empty())
+	{
+		return;
+	}
+
+	// Only iterate the smallest of the changed range and the rendered sections
+	if (static_cast<std::size_t>(last - first + 1) < _cachedSections.size())
+	{
+		for (auto section = first; section <= last; ++section)
+		{
+			_cachedSections.erase(section);
+		}
+	}
+	else
+	{
+		for (auto it = _cachedSections.begin(); it != _cachedSections.end();)
+		{
+			if (it->first >= first && it->first <= last)
+			{
+				it = _cachedSections.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+}
+
+void HeaderView::invalidateCachedSections()
+{
+	_cachedSections.clear();
 }
 
 void HeaderView::setModel(QAbstractItemModel* model)
@@ -434,7 +606,9 @@ void HeaderView::setModel(QAbstractItemModel* model)
 			connect(model, &QAbstractItemModel::columnsRemoved, this, &HeaderView::handleSectionRemoved);
 		}
 
+		connect(model, &QAbstractItemModel::modelAboutToBeReset, this, &HeaderView::handleModelAboutToBeReset);
 		connect(model, &QAbstractItemModel::modelReset, this, &HeaderView::handleModelReset);
+		connect(model, &QAbstractItemModel::headerDataChanged, this, &HeaderView::handleHeaderDataChanged);
 	}
 }
 
@@ -453,14 +627,91 @@ QSize HeaderView::sizeHint() const
 void HeaderView::paintSection(QPainter* painter, QRect const& rect, int logicalIndex) const
 {
 	auto* model = static_cast<Model*>(this->model());
-	auto const orientation = this->orientation();
-	auto* node = model->node(logicalIndex, orientation);
+	auto* node = model->node(logicalIndex, orientation());
 
 	if (!node)
 	{
 		return;
 	}
 
+	auto isSelected = false;
+
+	if (orientation() == Qt::Horizontal)
+	{
+		isSelected = selectionModel()->isColumnSelected(logicalIndex, {});
+	}
+	else
+	{
+		isSelected = selectionModel()->isRowSelected(logicalIndex, {});
+	}
+
+	// Sections are rendered once, then only rendered again when the model signals a header data change (or the rendering parameters change)
+	auto& cachedSection = _cachedSections[logicalIndex][isSelected ? 1 : 0];
+	auto const devicePixelRatio = painter->device()->devicePixelRatioF();
+	auto const isDarkColorScheme = qtMate::material::color::isDarkColorScheme();
+
+	if (cachedSection.pixmap.isNull() || cachedSection.size != rect.size() || cachedSection.devicePixelRatio != devicePixelRatio || cachedSection.isDarkColorScheme != isDarkColorScheme)
+	{
+		cachedSection.size = rect.size();
+		cachedSection.devicePixelRatio = devicePixelRatio;
+		cachedSection.isDarkColorScheme = isDarkColorScheme;
+		cachedSection.pixmap = QPixmap{ rect.size() * devicePixelRatio };
+		cachedSection.pixmap.setDevicePixelRatio(devicePixelRatio);
+		cachedSection.pixmap.fill(Qt::transparent);
+
+		auto sectionPainter = QPainter{ &cachedSection.pixmap };
+		sectionPainter.setFont(painter->font());
+		drawSection(&sectionPainter, QRect{ QPoint{ 0, 0 }, rect.size() }, node, logicalIndex, isSelected);
+	}
+
+	painter->drawPixmap(rect.topLeft(), cachedSection.pixmap);
+}
+
+void HeaderView::paintEvent(QPaintEvent* event)
+{
+	QHeaderView::paintEvent(event);
+
+	if (_cachedSections.empty())
+	{
+		return;
+	}
+
+	// Only keep the sections of the visible area
+	auto const viewportLength = orientation() == Qt::Horizontal ? viewport()->width() : viewport()->height();
+	auto const firstVisualIndex = visualIndexAt(0);
+	auto lastVisualIndex = visualIndexAt(viewportLength - 1);
+
+	if (firstVisualIndex < 0)
+	{
+		_cachedSections.clear();
+		return;
+	}
+
+	// Last section ends before the end of the viewport
+	if (lastVisualIndex < 0)
+	{
+		lastVisualIndex = count() - 1;
+	}
+
+	for (auto it = _cachedSections.begin(); it != _cachedSections.end();)
+	{
+		auto const sectionVisualIndex = visualIndex(it->first);
+		if (sectionVisualIndex < firstVisualIndex || sectionVisualIndex > lastVisualIndex || isSectionHidden(it->first))
+		{
+			it = _cachedSections.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+void HeaderView::drawSection(QPainter* painter, QRect const& rect, Node* node, int logicalIndex, bool const isSelected) const
+{
+	auto* model = static_cast<Model*>(this->model());
+	auto const orientation = this->orientation();
+
 	auto backgroundColor = QColor{};
 	auto foregroundColor = QColor{};
 	auto foregroundErrorColor = QColor{};
@@ -555,17 +806,6 @@ void HeaderView::paintSection(QPainter* painter, QRect const& rect, int logicalI
 			break;
 	}
 
-	auto isSelected = false;
-
-	if (orientation == Qt::Horizontal)
-	{
-		isSelected = selectionModel()->isColumnSelected(logicalIndex, {});
-	}
-	else
-	{
-		isSelected = selectionModel()->isRowSelected(logicalIndex, {});
-	}
-
 	if (isSelected)
 	{
 		backgroundColor = qtMate::material::color::complementaryValue(_colorName, qtMate::material::color::Shade::Shade600);
@@ -994,6 +1234,22 @@ void HeaderView::leaveEvent(QEvent* event)
 	QHeaderView::leaveEvent(event);
 }
 
+void HeaderView::changeEvent(QEvent* event)
+{
+	switch (event->type())
+	{
+		// Rendered sections depend on the font
+		case QEvent::FontChange:
+		case QEvent::StyleChange:
+			invalidateCachedSections();
+			break;
+		default:
+			break;
+	}
+
+	QHeaderView::changeEvent(event);
+}
+
 void HeaderView::handleEditMappingsClicked(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::AudioUnitIndex const audioUnitIndex, la::avdecc::entity::model::DescriptorType const streamPortType, la::avdecc::entity::model::StreamIndex const streamIndex)
 {
 	avdecc::mappingsHelper::showMappingsEditor(this, entityID, audioUnitIndex, streamPortType, std::nullopt, streamIndex);
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include "connectionMatrix/model.hpp"
+
 #include <QtMate/material/color.hpp>
 
 #include <la/avdecc/avdecc.hpp>
@@ -26,9 +28,16 @@
 #include <QHeaderView>
 #include <QVector>
 #include <QRegularExpression>
+#include <QPixmap>
+
+#include <array>
+#include <unordered_map>
+#include <vector>
 
 namespace connectionMatrix
 {
+class Node;
+
 class HeaderView final : public QHeaderView
 {
 public:
@@ -77,30 +86,52 @@ private:
 	void handleSectionClicked(int logicalIndex);
 	void handleSectionInserted(QModelIndex const& parent, int first, int last);
 	void handleSectionRemoved(QModelIndex const& parent, int first, int last);
+	void handleModelAboutToBeReset();
 	void handleModelReset();
 	void handleEditMappingsClicked(la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::AudioUnitIndex const audioUnitIndex, la::avdecc::entity::model::DescriptorType const streamPortType, la::avdecc::entity::model::StreamIndex const streamIndex);
 	void updateSectionVisibility(int const logicalIndex);
-	void applyFilterPattern();
+	void applyFilterPattern(bool const isNarrowing);
+	void handleHeaderDataChanged(Qt::Orientation orientation, int first, int last);
+	void invalidateCachedSections();
+	void drawSection(QPainter* painter, QRect const& rect, Node* node, int logicalIndex, bool const isSelected) const;
 
 	// QHeaderView overrides
 	virtual void setModel(QAbstractItemModel* model) override;
 	virtual QSize sizeHint() const override;
 	virtual void paintSection(QPainter* painter, QRect const& rect, int logicalIndex) const override;
+	virtual void paintEvent(QPaintEvent* event) override;
 	virtual void contextMenuEvent(QContextMenuEvent* event) override;
 	virtual void mouseMoveEvent(QMouseEvent* event) override;
 	virtual void mouseDoubleClickEvent(QMouseEvent* event) override;
 	virtual void leaveEvent(QEvent* event) override;
+	virtual void changeEvent(QEvent* event) override;
 
 private:
 	bool const _isListenersHeader{ false };
 	QVector<SectionState> _sectionState;
+	// Section state of each node before the model is reset, restored for the nodes still present after the reset if the mode did not change (entities inserted at once)
+	std::unordered_map<Node const*, SectionState> _sectionStateBeforeReset{};
+	Model::Mode _modeBeforeReset{ Model::Mode::None };
 	QRegularExpression _pattern;
+	// Entities possibly matching _pattern, by section (a cleared bit means the entity is known not to match _pattern, nor any narrower pattern)
+	std::vector<bool> _filterMatches{};
 
 	bool _alwaysShowArrowTip{ false };
 	bool _alwaysShowArrowEnd{ false };
 	bool _isTransposed{ false };
 	bool _collapsedByDefault{ true };
 	qtMate::material::color::Name _colorName{ qtMate::material::color::DefaultColor };
+
+	// Rendered section, only valid for the size, device pixel ratio and color scheme it was rendered with
+	struct CachedSection
+	{
+		QSize size{};
+		qreal devicePixelRatio{ 1.0 };
+		bool isDarkColorScheme{ false };
+		QPixmap pixmap{};
+	};
+	// Rendered sections by logical index, for the not selected and selected states
+	mutable std::unordered_map<int, std::array<CachedSection, 2>> _cachedSections{};
 };
 
 } // namespace connectionMatrix
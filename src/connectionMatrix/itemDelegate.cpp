@@ -39,11 +39,13 @@ ItemDelegate::ItemDelegate(bool const drawMediaLockedDot, QObject* parent)
 void ItemDelegate::setDrawMediaLockedDot(bool const drawMediaLockedDot) noexcept
 {
 	_drawMediaLockedDot = drawMediaLockedDot;
+	clearGlyphs();
 }
 
 void ItemDelegate::setDrawCRFAudioConnections(bool const drawCRFAudioConnections) noexcept
 {
 	_drawCRFAudioConnections = drawCRFAudioConnections;
+	clearGlyphs();
 }
 
 bool ItemDelegate::getDrawCRFAudioConnections() const noexcept
@@ -54,6 +56,65 @@ bool ItemDelegate::getDrawCRFAudioConnections() const noexcept
 void ItemDelegate::setDrawEntitySummary(bool const drawSummary) noexcept
 {
 	_drawEntitySummary = drawSummary;
+	clearGlyphs();
+}
+
+bool ItemDelegate::GlyphKey::operator==(GlyphKey const& other) const noexcept
+{
+	return type == other.type && state == other.state && flags == other.flags && width == other.width && height == other.height && devicePixelRatio == other.devicePixelRatio && isDarkColorScheme == other.isDarkColorScheme;
+}
+
+std::size_t ItemDelegate::GlyphKeyHash::operator()(GlyphKey const& key) const noexcept
+{
+	auto value = std::uint64_t{ 0u };
+	value |= static_cast<std::uint64_t>(key.type);
+	value |= static_cast<std::uint64_t>(key.state) << 8;
+	value |= static_cast<std::uint64_t>(key.flags & 0xFF) << 12;
+	value |= static_cast<std::uint64_t>(key.width & 0xFFFF) << 20;
+	value |= static_cast<std::uint64_t>(key.height & 0xFFFF) << 36;
+	value |= static_cast<std::uint64_t>(key.isDarkColorScheme) << 52;
+	return std::hash<std::uint64_t>{}(value) ^ std::hash<qreal>{}(key.devicePixelRatio);
+}
+
+QPixmap const& ItemDelegate::glyph(GlyphKey const& key) const
+{
+	auto const it = _glyphsIndex.find(key);
+	if (it != std::end(_glyphsIndex))
+	{
+		// Move to front (most recently used)
+		_glyphs.splice(std::begin(_glyphs), _glyphs, it->second);
+		return it->second->second;
+	}
+
+	auto const size = QSize{ key.width, key.height };
+	auto pixmap = QPixmap{ size * key.devicePixelRatio };
+	pixmap.setDevicePixelRatio(key.devicePixelRatio);
+	pixmap.fill(Qt::transparent);
+
+	{
+		auto painter = QPainter{ &pixmap };
+		painter.setPen(qtMate::material::color::value(qtMate::material::color::Name::Gray)); // Same initial pen as paint()
+		auto flags = Model::IntersectionData::Flags{};
+		flags.assign(static_cast<Model::IntersectionData::Flags::underlying_value_type>(key.flags));
+		paintHelper::drawCapabilities(&painter, QRect{ QPoint{ 0, 0 }, size }, key.type, key.state, flags, _drawMediaLockedDot, _drawCRFAudioConnections, _drawEntitySummary);
+	}
+
+	// Evict the least recently used glyph
+	if (_glyphs.size() >= MaximumGlyphsCount)
+	{
+		_glyphsIndex.erase(_glyphs.back().first);
+		_glyphs.pop_back();
+	}
+
+	_glyphs.emplace_front(key, std::move(pixmap));
+	_glyphsIndex.emplace(key, std::begin(_glyphs));
+	return _glyphs.front().second;
+}
+
+void ItemDelegate::clearGlyphs() noexcept
+{
+	_glyphs.clear();
+	_glyphsIndex.clear();
 }
 
 void ItemDelegate::paint(QPainter* painter, QStyleOptionViewItem const& option, QModelIndex const& index) const
@@ -84,7 +145,29 @@ void ItemDelegate::paint(QPainter* painter, QStyleOptionViewItem const& option,
 
 	auto const& intersectionData = static_cast<Model const*>(index.model())->intersectionData(index);
 
-	paintHelper::drawCapabilities(painter, option.rect, intersectionData.type, intersectionData.state, intersectionData.flags, _drawMediaLockedDot, _drawCRFAudioConnections, _drawEntitySummary);
+	paintIntersection(painter, option.rect, intersectionData);
+}
+
+void ItemDelegate::paintIntersection(QPainter* painter, QRect const& rect, Model::IntersectionData const& intersectionData) const
+{
+	// The invalid pattern is aligned on the view, it cannot be pre-rendered
+	if (paintHelper::isInvalidIntersection(intersectionData.type, intersectionData.state, intersectionData.flags, _drawCRFAudioConnections))
+	{
+		paintHelper::drawInvalidIntersection(painter, rect);
+		return;
+	}
+
+	// Only a few combinations of intersection data are possible, draw pre-rendered glyphs
+	auto key = GlyphKey{};
+	key.type = intersectionData.type;
+	key.state = intersectionData.state;
+	key.flags = static_cast<std::uint32_t>(intersectionData.flags.value());
+	key.width = rect.width();
+	key.height = rect.height();
+	key.devicePixelRatio = painter->device()->devicePixelRatioF();
+	key.isDarkColorScheme = qtMate::material::color::isDarkColorScheme();
+
+	painter->drawPixmap(rect.topLeft(), glyph(key));
 }
 
 } // namespace connectionMatrix
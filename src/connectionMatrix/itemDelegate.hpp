@@ -19,7 +19,15 @@
 
 #pragma once
 
+#include "connectionMatrix/model.hpp"
+
 #include <QStyledItemDelegate>
+#include <QPixmap>
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
 
 namespace connectionMatrix
 {
@@ -32,12 +40,41 @@ public:
 	bool getDrawCRFAudioConnections() const noexcept;
 	void setDrawEntitySummary(bool const drawSummary) noexcept;
 
+	// Draws the intersection capabilities in rect, using pre-rendered glyphs when possible
+	void paintIntersection(QPainter* painter, QRect const& rect, Model::IntersectionData const& intersectionData) const;
+
 private:
+	// Pre-rendered intersection glyph, for a cell size and device pixel ratio
+	struct GlyphKey
+	{
+		Model::IntersectionData::Type type{ Model::IntersectionData::Type::None };
+		Model::IntersectionData::State state{ Model::IntersectionData::State::NotConnected };
+		std::uint32_t flags{ 0u };
+		int width{ 0 };
+		int height{ 0 };
+		qreal devicePixelRatio{ 1.0 };
+		bool isDarkColorScheme{ false };
+
+		bool operator==(GlyphKey const& other) const noexcept;
+	};
+	struct GlyphKeyHash
+	{
+		std::size_t operator()(GlyphKey const& key) const noexcept;
+	};
+
 	virtual void paint(QPainter* painter, QStyleOptionViewItem const& option, QModelIndex const& index) const override;
+	QPixmap const& glyph(GlyphKey const& key) const;
+	void clearGlyphs() noexcept;
 
 	bool _drawMediaLockedDot{ false };
 	bool _drawCRFAudioConnections{ false };
 	bool _drawEntitySummary{ false };
+	// Glyphs only depend on the intersection data and the options above, cleared when an option changes
+	// Most recently used first, least recently used glyphs are evicted past MaximumGlyphsCount (cell size and device pixel ratio are part of the key)
+	static constexpr auto MaximumGlyphsCount = std::size_t{ 256u };
+	using Glyphs = std::list<std::pair<GlyphKey, QPixmap>>;
+	mutable Glyphs _glyphs{};
+	mutable std::unordered_map<GlyphKey, Glyphs::iterator, GlyphKeyHash> _glyphsIndex{};
 };
 
 } // namespace connectionMatrix
@@ -0,0 +1,491 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "connectionMatrix/minimap.hpp"
+#include "connectionMatrix/model.hpp"
+#include "connectionMatrix/node.hpp"
+#include <QtMate/material/color.hpp>
+
+#include <QTableView>
+#include <QHeaderView>
+#include <QScrollBar>
+#include <QPainter>
+#include <QMouseEvent>
+#include <QCoreApplication>
+
+#include <algorithm>
+#include <utility>
+
+namespace connectionMatrix
+{
+// Maximum size of the overview image, in both directions
+static constexpr auto MaximumImageSize = 160;
+// Margin between the overview and the viewport borders
+static constexpr auto Margin = 8;
+// The overview is only shown when the matrix is at least that many pages long, in one of the directions
+static constexpr auto MinimumPagesCount = 3;
+
+// Returns the position of the mouse event, in the coordinates of the widget receiving it
+static QPointF localPosition(QMouseEvent const* const event)
+{
+#if QT_VERSION >= 0x060000
+	return event->position();
+#else
+	return event->localPos();
+#endif
+}
+
+// Returns the visible sections of header, in visual order, filling ordinals with their position in the returned list (-1 for hidden sections)
+static std::vector<int> visibleSections(QHeaderView const* const header, std::vector<int>& ordinals)
+{
+	auto const count = header->count();
+	auto sections = std::vector<int>{};
+
+	ordinals.assign(count, -1);
+	for (auto visualIndex = 0; visualIndex < count; ++visualIndex)
+	{
+		auto const logicalIndex = header->logicalIndex(visualIndex);
+		if (!header->isSectionHidden(logicalIndex))
+		{
+			ordinals[logicalIndex] = static_cast<int>(sections.size());
+			sections.push_back(logicalIndex);
+		}
+	}
+
+	return sections;
+}
+
+// Returns the entity of each section (an invalid entityID for the offline output streams)
+static std::vector<la::avdecc::UniqueIdentifier> sectionEntities(Model const* const model, std::vector<int> const& sections, Qt::Orientation const orientation)
+{
+	auto entities = std::vector<la::avdecc::UniqueIdentifier>{};
+	entities.reserve(sections.size());
+
+	for (auto const section : sections)
+	{
+		auto const* const node = model->node(section, orientation);
+		entities.push_back(node ? node->entityID() : la::avdecc::UniqueIdentifier{});
+	}
+
+	return entities;
+}
+
+// Returns the number of consecutive sections of the same entity, starting at first and stopping before last
+static int entitySectionsCount(std::vector<la::avdecc::UniqueIdentifier> const& entities, int const first, int const last) noexcept
+{
+	auto count = 1;
+	while (first + count < last && entities[first + count] == entities[first])
+	{
+		++count;
+	}
+	return count;
+}
+
+// Extends the range of ordinals to all the sections of the entities at both ends
+static std::pair<int, int> entitiesRange(std::vector<la::avdecc::UniqueIdentifier> const& entities, int first, int last) noexcept
+{
+	while (first > 0 && entities[first - 1] == entities[first])
+	{
+		--first;
+	}
+	while (last + 1 < static_cast<int>(entities.size()) && entities[last + 1] == entities[last])
+	{
+		++last;
+	}
+	return { first, last };
+}
+
+static bool isLargerThanPages(QScrollBar const* const scrollBar, int const pagesCount) noexcept
+{
+	auto const pageStep = std::max(1, scrollBar->pageStep());
+	return (scrollBar->maximum() - scrollBar->minimum() + pageStep) >= pagesCount * pageStep;
+}
+
+Minimap::Minimap(Model* model, QTableView* view)
+	: QWidget{ view }
+	, _model{ model }
+	, _view{ view }
+{
+	// Hovering is forwarded to the intersections under the overview (and changes the cursor over the matrix overview)
+	setMouseTracking(true);
+	hide();
+
+	// Keep the visible area up-to-date
+	auto const refresh = [this]()
+	{
+		update();
+	};
+
+	connect(_view->horizontalScrollBar(), &QScrollBar::valueChanged, this, refresh);
+	connect(_view->horizontalScrollBar(), &QScrollBar::rangeChanged, this, refresh);
+	connect(_view->verticalScrollBar(), &QScrollBar::valueChanged, this, refresh);
+	connect(_view->verticalScrollBar(), &QScrollBar::rangeChanged, this, refresh);
+}
+
+void Minimap::setAllowed(bool const isAllowed) noexcept
+{
+	_isAllowed = isAllowed;
+}
+
+void Minimap::updatePlacement(QRect const& viewportGeometry)
+{
+	if (!_isAllowed)
+	{
+		hide();
+		return;
+	}
+
+	if (!isLargerThanPages(_view->horizontalScrollBar(), MinimumPagesCount) && !isLargerThanPages(_view->verticalScrollBar(), MinimumPagesCount))
+	{
+		hide();
+		return;
+	}
+
+	// Only the visible sections are required to know the image size, blocks are computed when painting
+	if (_needsRebuild)
+	{
+		rebuild();
+	}
+
+	if (_image.isNull())
+	{
+		hide();
+		return;
+	}
+
+	// Keep the aspect ratio of the matrix, with a 1 pixel frame
+	auto const size = _image.size().scaled(MaximumImageSize, MaximumImageSize, Qt::KeepAspectRatio) + QSize{ 2, 2 };
+	if (size.width() + 2 * Margin > viewportGeometry.width() || size.height() + 2 * Margin > viewportGeometry.height())
+	{
+		hide();
+		return;
+	}
+
+	setGeometry(QRect{ viewportGeometry.right() - Margin - size.width() + 1, viewportGeometry.bottom() - Margin - size.height() + 1, size.width(), size.height() });
+	show();
+	raise();
+}
+
+void Minimap::invalidate()
+{
+	_needsRebuild = true;
+	update();
+}
+
+void Minimap::invalidate(QModelIndex const& topLeft, QModelIndex const& bottomRight)
+{
+	// Everything will be computed again
+	if (_needsRebuild)
+	{
+		return;
+	}
+
+	if (!topLeft.isValid() || !bottomRight.isValid())
+	{
+		invalidate();
+		return;
+	}
+
+	auto const ordinalsRange = [](std::vector<int> const& ordinals, int const first, int const last)
+	{
+		auto range = std::make_pair(-1, -1);
+		for (auto section = std::max(first, 0); section <= last && section < static_cast<int>(ordinals.size()); ++section)
+		{
+			if (auto const ordinal = ordinals[section]; ordinal != -1)
+			{
+				if (range.first == -1)
+				{
+					range.first = ordinal;
+				}
+				range.second = ordinal;
+			}
+		}
+		return range;
+	};
+
+	// Ignore changes of hidden sections
+	auto const [firstChangedRow, lastChangedRow] = ordinalsRange(_rowOrdinals, topLeft.row(), bottomRight.row());
+	auto const [firstChangedColumn, lastChangedColumn] = ordinalsRange(_columnOrdinals, topLeft.column(), bottomRight.column());
+	if (firstChangedRow == -1 || firstChangedColumn == -1)
+	{
+		return;
+	}
+
+	// Blocks are summarized from the connections between entities, all the blocks covering the changed entities have to be computed again
+	auto const [firstRow, lastRow] = entitiesRange(_rowEntities, firstChangedRow, lastChangedRow);
+	auto const [firstColumn, lastColumn] = entitiesRange(_columnEntities, firstChangedColumn, lastChangedColumn);
+
+	for (auto blockRow = firstRow / _blockSize; blockRow <= lastRow / _blockSize; ++blockRow)
+	{
+		for (auto blockColumn = firstColumn / _blockSize; blockColumn <= lastColumn / _blockSize; ++blockColumn)
+		{
+			_dirtyBlocks[blockRow * _image.width() + blockColumn] = true;
+		}
+	}
+	_hasDirtyBlocks = true;
+
+	update();
+}
+
+void Minimap::rebuild()
+{
+	_visibleRows = visibleSections(_view->verticalHeader(), _rowOrdinals);
+	_visibleColumns = visibleSections(_view->horizontalHeader(), _columnOrdinals);
+	_rowEntities = sectionEntities(_model, _visibleRows, Qt::Vertical);
+	_columnEntities = sectionEntities(_model, _visibleColumns, Qt::Horizontal);
+
+	auto const largestCount = static_cast<int>(std::max(_visibleRows.size(), _visibleColumns.size()));
+	_blockSize = std::max(1, (largestCount + MaximumImageSize - 1) / MaximumImageSize);
+
+	auto const blockRows = (static_cast<int>(_visibleRows.size()) + _blockSize - 1) / _blockSize;
+	auto const blockColumns = (static_cast<int>(_visibleColumns.size()) + _blockSize - 1) / _blockSize;
+
+	// Brighter colors over a dark background
+	_isDarkColorScheme = qtMate::material::color::isDarkColorScheme();
+	_connectedColor = qtMate::material::color::value(qtMate::material::color::Name::Green, _isDarkColorScheme ? qtMate::material::color::Shade::Shade300 : qtMate::material::color::Shade::Shade500);
+	_errorColor = qtMate::material::color::value(qtMate::material::color::Name::Red, _isDarkColorScheme ? qtMate::material::color::Shade::Shade400 : qtMate::material::color::Shade::Shade800);
+
+	if (blockRows > 0 && blockColumns > 0)
+	{
+		_image = QImage{ blockColumns, blockRows, QImage::Format_ARGB32_Premultiplied };
+		_dirtyBlocks.assign(static_cast<std::size_t>(blockRows) * blockColumns, true);
+		_hasDirtyBlocks = true;
+	}
+	else
+	{
+		_image = {};
+		_dirtyBlocks.clear();
+		_hasDirtyBlocks = false;
+	}
+
+	_needsRebuild = false;
+}
+
+void Minimap::updateDirtyBlocks()
+{
+	auto const blockColumns = _image.width();
+
+	for (auto index = std::size_t{ 0u }; index < _dirtyBlocks.size(); ++index)
+	{
+		if (_dirtyBlocks[index])
+		{
+			updateBlock(static_cast<int>(index) / blockColumns, static_cast<int>(index) % blockColumns);
+			_dirtyBlocks[index] = false;
+		}
+	}
+
+	_hasDirtyBlocks = false;
+}
+
+void Minimap::updateBlock(int const blockRow, int const blockColumn)
+{
+	auto const firstRow = blockRow * _blockSize;
+	auto const lastRow = std::min(firstRow + _blockSize, static_cast<int>(_visibleRows.size()));
+	auto const firstColumn = blockColumn * _blockSize;
+	auto const lastColumn = std::min(firstColumn + _blockSize, static_cast<int>(_visibleColumns.size()));
+
+	auto const isTransposed = _model->isTransposed();
+
+	auto intersectionsCount = 0;
+	auto connectedCount = 0;
+	auto hasErrors = false;
+
+	// The sections of an entity being contiguous, the block is summarized from the connections between the entities it covers, without computing any intersection
+	for (auto row = firstRow; row < lastRow;)
+	{
+		auto const& rowEntityID = _rowEntities[row];
+		auto const rowsCount = entitySectionsCount(_rowEntities, row, lastRow);
+
+		for (auto column = firstColumn; column < lastColumn;)
+		{
+			auto const& columnEntityID = _columnEntities[column];
+			auto const columnsCount = entitySectionsCount(_columnEntities, column, lastColumn);
+			auto const connections = isTransposed ? _model->entityConnections(columnEntityID, rowEntityID) : _model->entityConnections(rowEntityID, columnEntityID);
+
+			intersectionsCount += rowsCount * columnsCount;
+			if (connections.connectedCount > 0u)
+			{
+				connectedCount += rowsCount * columnsCount;
+				hasErrors |= connections.errorsCount > 0u;
+			}
+
+			column += columnsCount;
+		}
+
+		row += rowsCount;
+	}
+
+	auto color = QColor{ Qt::transparent };
+	if (connectedCount > 0)
+	{
+		// Any error in the block has priority, the opacity tells how much of the block connected entities cover (a single pair still being visible)
+		color = hasErrors ? _errorColor : _connectedColor;
+		auto const density = static_cast<double>(connectedCount) / intersectionsCount;
+		color.setAlpha(96 + static_cast<int>(159 * density));
+	}
+
+	_image.setPixelColor(blockColumn, blockRow, color);
+}
+
+QRect Minimap::imageRect() const
+{
+	return rect().adjusted(1, 1, -1, -1);
+}
+
+QRectF Minimap::contentRect() const
+{
+	// The last blocks may not be complete
+	auto const imageRect = QRectF{ this->imageRect() };
+	if (_image.isNull())
+	{
+		return imageRect;
+	}
+
+	auto const width = imageRect.width() * _visibleColumns.size() / (static_cast<qreal>(_image.width()) * _blockSize);
+	auto const height = imageRect.height() * _visibleRows.size() / (static_cast<qreal>(_image.height()) * _blockSize);
+	return QRectF{ imageRect.topLeft(), QSizeF{ width, height } };
+}
+
+void Minimap::scrollTo(QPointF const& pos)
+{
+	auto const contentRect = this->contentRect();
+	if (contentRect.isEmpty())
+	{
+		return;
+	}
+
+	// Center the view on the position
+	auto const scroll = [](QScrollBar* const scrollBar, qreal const ratio)
+	{
+		auto const range = scrollBar->maximum() - scrollBar->minimum() + scrollBar->pageStep();
+		scrollBar->setValue(scrollBar->minimum() + static_cast<int>(ratio * range - scrollBar->pageStep() / 2.0));
+	};
+
+	scroll(_view->horizontalScrollBar(), std::clamp((pos.x() - contentRect.left()) / contentRect.width(), 0.0, 1.0));
+	scroll(_view->verticalScrollBar(), std::clamp((pos.y() - contentRect.top()) / contentRect.height(), 0.0, 1.0));
+}
+
+void Minimap::updateCursor(QPointF const& pos)
+{
+	// Only the matrix overview is navigable, the margins and incomplete blocks are not
+	if (_isDragging || contentRect().contains(pos))
+	{
+		setCursor(Qt::PointingHandCursor);
+	}
+	else
+	{
+		unsetCursor();
+	}
+}
+
+void Minimap::forwardToViewport(QMouseEvent* event)
+{
+	auto* const viewport = _view->viewport();
+#if QT_VERSION >= 0x060000
+	auto const globalPosition = event->globalPosition();
+	auto forwardedEvent = QMouseEvent{ event->type(), viewport->mapFromGlobal(globalPosition), globalPosition, event->button(), event->buttons(), event->modifiers(), event->pointingDevice() };
+#else
+	auto forwardedEvent = QMouseEvent{ event->type(), viewport->mapFromGlobal(event->globalPos()), event->screenPos(), event->button(), event->buttons(), event->modifiers() };
+#endif
+	QCoreApplication::sendEvent(viewport, &forwardedEvent);
+}
+
+void Minimap::paintEvent(QPaintEvent*)
+{
+	// The color scheme changed since the image was built
+	if (_needsRebuild || _isDarkColorScheme != qtMate::material::color::isDarkColorScheme())
+	{
+		rebuild();
+	}
+	if (_hasDirtyBlocks)
+	{
+		updateDirtyBlocks();
+	}
+
+	auto painter = QPainter{ this };
+
+	auto background = palette().color(QPalette::Base);
+	background.setAlpha(224);
+	painter.fillRect(rect(), background);
+	painter.setPen(palette().color(QPalette::Mid));
+	painter.drawRect(rect().adjusted(0, 0, -1, -1));
+
+	if (_image.isNull())
+	{
+		return;
+	}
+
+	painter.drawImage(imageRect(), _image);
+
+	// Visible area of the view
+	auto const contentRect = this->contentRect();
+	auto const visibleRange = [](QScrollBar const* const scrollBar)
+	{
+		auto const range = static_cast<qreal>(scrollBar->maximum() - scrollBar->minimum() + scrollBar->pageStep());
+		return std::make_pair((scrollBar->value() - scrollBar->minimum()) / range, scrollBar->pageStep() / range);
+	};
+	auto const [x, width] = visibleRange(_view->horizontalScrollBar());
+	auto const [y, height] = visibleRange(_view->verticalScrollBar());
+
+	painter.setPen(palette().color(QPalette::Highlight));
+	painter.setBrush(Qt::NoBrush);
+	painter.drawRect(QRectF{ contentRect.left() + x * contentRect.width(), contentRect.top() + y * contentRect.height(), width * contentRect.width(), height * contentRect.height() });
+}
+
+void Minimap::mousePressEvent(QMouseEvent* event)
+{
+	// Only left clicks over the matrix overview scroll the view, other clicks are meant for the intersections under it
+	auto const pos = localPosition(event);
+	if (event->button() == Qt::LeftButton && contentRect().contains(pos))
+	{
+		_isDragging = true;
+		scrollTo(pos);
+		return;
+	}
+
+	forwardToViewport(event);
+}
+
+void Minimap::mouseMoveEvent(QMouseEvent* event)
+{
+	auto const pos = localPosition(event);
+	updateCursor(pos);
+
+	if (_isDragging)
+	{
+		scrollTo(pos);
+		return;
+	}
+
+	forwardToViewport(event);
+}
+
+void Minimap::mouseReleaseEvent(QMouseEvent* event)
+{
+	if (_isDragging && event->button() == Qt::LeftButton)
+	{
+		_isDragging = false;
+		updateCursor(localPosition(event));
+		return;
+	}
+
+	forwardToViewport(event);
+}
+
+} // namespace connectionMatrix
@@ -0,0 +1,100 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <la/avdecc/internals/uniqueIdentifier.hpp>
+
+#include <QWidget>
+#include <QImage>
+#include <QColor>
+#include <QModelIndex>
+
+#include <vector>
+
+class QTableView;
+
+namespace connectionMatrix
+{
+class Model;
+
+// Overview of the whole connection matrix, each pixel of the image summarizing the connection and error state of the entities covered by a block of visible intersections
+// Clicking or dragging in the overview scrolls the view, other mouse events are forwarded to the intersections under it
+class Minimap final : public QWidget
+{
+public:
+	Minimap(Model* model, QTableView* view);
+
+	// Allows the overview to be shown (default true), updatePlacement has to be called for the change to be applied
+	void setAllowed(bool const isAllowed) noexcept;
+
+	// Shows the overview over the bottom right corner of viewportGeometry if the matrix is large enough, hides it otherwise
+	void updatePlacement(QRect const& viewportGeometry);
+
+	// The visible sections changed, the overview has to be computed again
+	void invalidate();
+
+	// Intersections changed, only the blocks covering the range have to be computed again
+	void invalidate(QModelIndex const& topLeft, QModelIndex const& bottomRight);
+
+private:
+	void rebuild();
+	void updateDirtyBlocks();
+	void updateBlock(int const blockRow, int const blockColumn);
+	QRect imageRect() const;
+	QRectF contentRect() const;
+	void scrollTo(QPointF const& pos);
+	void updateCursor(QPointF const& pos);
+	void forwardToViewport(QMouseEvent* event);
+
+	// QWidget overrides
+	virtual void paintEvent(QPaintEvent* event) override;
+	virtual void mousePressEvent(QMouseEvent* event) override;
+	virtual void mouseMoveEvent(QMouseEvent* event) override;
+	virtual void mouseReleaseEvent(QMouseEvent* event) override;
+
+private:
+	Model* _model{ nullptr };
+	QTableView* _view{ nullptr };
+	bool _isAllowed{ true };
+	bool _isDragging{ false };
+
+	// Visible sections (logical indexes), and their position in those lists (by logical index, -1 if hidden)
+	std::vector<int> _visibleRows{};
+	std::vector<int> _visibleColumns{};
+	std::vector<int> _rowOrdinals{};
+	std::vector<int> _columnOrdinals{};
+
+	// Entity of each visible section (by position in the visible sections lists)
+	std::vector<la::avdecc::UniqueIdentifier> _rowEntities{};
+	std::vector<la::avdecc::UniqueIdentifier> _columnEntities{};
+
+	// Number of visible sections summarized by each pixel of the image, in both directions
+	int _blockSize{ 1 };
+	// Colors of the blocks, depending on the color scheme the image was built for
+	bool _isDarkColorScheme{ false };
+	QColor _connectedColor{};
+	QColor _errorColor{};
+	QImage _image{};
+	std::vector<bool> _dirtyBlocks{};
+	bool _hasDirtyBlocks{ false };
+	bool _needsRebuild{ true };
+};
+
+} // namespace connectionMatrix
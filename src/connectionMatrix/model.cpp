@@ -27,8 +27,22 @@
 #include <hive/modelsLibrary/controllerManager.hpp>
 
 #include <QDebug>
-
+#include <QRunnable>
+#include <QSemaphore>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
@@ -48,9 +62,6 @@ using Nodes = std::deque<Node*>;
 // Entity node by entity ID
 using NodeMap = std::unordered_map<la::avdecc::UniqueIdentifier, std::unique_ptr<EntityNode>, la::avdecc::UniqueIdentifier::hash>;
 
-// Entity section by entity ID
-using EntitySectionMap = std::unordered_map<la::avdecc::UniqueIdentifier, int, la::avdecc::UniqueIdentifier::hash>;
-
 // Unique stream identifier
 using StreamKey = std::pair<la::avdecc::UniqueIdentifier, la::avdecc::entity::model::StreamIndex>;
 
@@ -83,8 +94,202 @@ static auto const InvalidChannelKey = ChannelKey{};
 // ChannelNode by ChannelKey
 using ChannelNodeMap = std::unordered_map<ChannelKey, ChannelNode*, ChannelKeyHash>;
 
-// Section by Node
-using NodeSectionMap = std::unordered_map<Node const*, int>;
+// Channel nodes using a stream (according to audio mappings), by stream index
+using ChannelNodes = std::vector<ChannelNode*>;
+using StreamChannelNodes = std::unordered_map<la::avdecc::entity::model::StreamIndex, ChannelNodes>;
+
+// Channel nodes using a stream, by entityID
+using StreamChannelNodesMap = std::unordered_map<la::avdecc::UniqueIdentifier, StreamChannelNodes, la::avdecc::UniqueIdentifier::hash>;
+
+// Unique intersection identifier (talker, listener)
+using IntersectionKey = std::pair<Node const*, Node const*>;
+
+struct IntersectionKeyHash
+{
+	std::size_t operator()(IntersectionKey const& key) const
+	{
+		// Combine both hashes (boost::hash_combine), a plain xor would make the pointers of nodes allocated close to each other collide
+		auto seed = std::hash<Node const*>()(key.first);
+		seed ^= std::hash<Node const*>()(key.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		return seed;
+	}
+};
+
+// Set of intersections
+using IntersectionKeySet = std::unordered_set<IntersectionKey, IntersectionKeyHash>;
+
+// Set of nodes
+using NodeSet = std::unordered_set<Node const*>;
+
+// Connections of listener channel nodes, as returned by ChannelConnectionManager::getChannelConnectionsReverse
+using ListenerChannelConnections = std::unordered_map<Node const*, std::shared_ptr<avdecc::TargetConnectionInformations>>;
+
+// Listener stream nodes connected (or fast connecting) to a talker entity, by talker entityID
+using TalkerConnectedStreams = std::unordered_map<la::avdecc::UniqueIdentifier, std::vector<StreamNode const*>, la::avdecc::UniqueIdentifier::hash>;
+
+// Connected listener stream nodes of each listener entity, by listener entityID
+using EntityConnectedStreamsMap = std::unordered_map<la::avdecc::UniqueIdentifier, TalkerConnectedStreams, la::avdecc::UniqueIdentifier::hash>;
+
+// Lazy computation state of a node. Its intersections with the nodes inserted before its row (or column) was last resolved are computed
+struct NodeComputation
+{
+	std::uint64_t insertedGeneration{ 0u };
+	std::uint64_t resolvedGeneration{ 0u }; // 0 if the row (or column) has never been resolved
+};
+
+// Lazy computation state, by node
+using NodeComputationMap = std::unordered_map<Node const*, NodeComputation>;
+
+// Sparse values associated with intersections, stored by talker and indexed by listener
+// This way, removing a node only touches the intersections of this node
+template<typename T>
+class IntersectionMap
+{
+public:
+	// Returns the value of the intersection, nullptr if there is none
+	T* find(Node const* const talker, Node const* const listener)
+	{
+		return const_cast<T*>(static_cast<IntersectionMap const*>(this)->find(talker, listener));
+	}
+
+	T const* find(Node const* const talker, Node const* const listener) const
+	{
+		auto const rowIt = _rows.find(talker);
+		if (rowIt == std::end(_rows))
+		{
+			return nullptr;
+		}
+
+		auto const& row = rowIt->second;
+		auto const it = row.find(listener);
+		if (it == std::end(row))
+		{
+			return nullptr;
+		}
+		return &it->second;
+	}
+
+	// Returns the value of the intersection, default constructed if there was none
+	T& value(Node const* const talker, Node const* const listener)
+	{
+		_columns[listener].insert(talker);
+		return _rows[talker][listener];
+	}
+
+	// Sets the value of the intersection
+	T& assign(Node const* const talker, Node const* const listener, T&& newValue)
+	{
+		return value(talker, listener) = std::move(newValue);
+	}
+
+	void erase(Node const* const talker, Node const* const listener)
+	{
+		auto const rowIt = _rows.find(talker);
+		if (rowIt == std::end(_rows) || rowIt->second.erase(listener) == 0u)
+		{
+			return;
+		}
+		if (rowIt->second.empty())
+		{
+			_rows.erase(rowIt);
+		}
+		eraseFromColumn(listener, talker);
+	}
+
+	// Removes all values of a talker
+	void removeTalker(Node const* const talker)
+	{
+		auto const rowIt = _rows.find(talker);
+		if (rowIt == std::end(_rows))
+		{
+			return;
+		}
+
+		for (auto const& [listener, value] : rowIt->second)
+		{
+			eraseFromColumn(listener, talker);
+		}
+		_rows.erase(rowIt);
+	}
+
+	// Removes all values of a listener
+	void removeListener(Node const* const listener)
+	{
+		auto const columnIt = _columns.find(listener);
+		if (columnIt == std::end(_columns))
+		{
+			return;
+		}
+
+		for (auto const* const talker : columnIt->second)
+		{
+			auto const rowIt = _rows.find(talker);
+			if (AVDECC_ASSERT_WITH_RET(rowIt != std::end(_rows), "Talker row not found"))
+			{
+				rowIt->second.erase(listener);
+				if (rowIt->second.empty())
+				{
+					_rows.erase(rowIt);
+				}
+			}
+		}
+		_columns.erase(columnIt);
+	}
+
+	// Calls handler(talker, listener, value) for each stored value
+	template<typename Handler>
+	void forEach(Handler&& handler) const
+	{
+		for (auto const& [talker, row] : _rows)
+		{
+			for (auto const& [listener, value] : row)
+			{
+				handler(talker, listener, value);
+			}
+		}
+	}
+
+	bool empty() const
+	{
+		return _rows.empty();
+	}
+
+	// Returns the count of stored values
+	std::size_t size() const
+	{
+		auto count = std::size_t{ 0u };
+		for (auto const& [talker, row] : _rows)
+		{
+			count += row.size();
+		}
+		return count;
+	}
+
+	void clear()
+	{
+		_rows.clear();
+		_columns.clear();
+	}
+
+private:
+	void eraseFromColumn(Node const* const listener, Node const* const talker)
+	{
+		auto const columnIt = _columns.find(listener);
+		if (columnIt != std::end(_columns))
+		{
+			columnIt->second.erase(talker);
+			if (columnIt->second.empty())
+			{
+				_columns.erase(columnIt);
+			}
+		}
+	}
+
+	// Values, by talker then listener
+	std::unordered_map<Node const*, std::unordered_map<Node const*, T>> _rows{};
+	// Talkers having a value, by listener
+	std::unordered_map<Node const*, std::unordered_set<Node const*>> _columns{};
+};
 
 #if ENABLE_CONNECTION_MATRIX_TOOLTIP
 
@@ -330,6 +535,33 @@ void removeChannelNodes(ChannelNodeMap& map, Node* node)
 		});
 }
 
+// Builds the channel nodes using each stream of an entity, from its audio mappings
+template<typename ClusterOffsetGetter, typename ChannelNodeGetter>
+StreamChannelNodes buildStreamChannelNodes(std::unordered_map<la::avdecc::entity::model::StreamPortIndex, la::avdecc::entity::model::AudioMappings> const& mappings, ClusterOffsetGetter const& getClusterOffset, ChannelNodeGetter const& getChannelNode)
+{
+	auto streamChannelNodes = StreamChannelNodes{};
+
+	for (auto const& [streamPortIndex, audioUnitMappings] : mappings)
+	{
+		auto const clusterOffset = getClusterOffset(streamPortIndex);
+
+		// One stream can have multiple Channels
+		for (auto const& mapping : audioUnitMappings)
+		{
+			if (auto* channelNode = getChannelNode(clusterOffset + mapping.clusterOffset))
+			{
+				auto& channelNodes = streamChannelNodes[mapping.streamIndex];
+				if (std::find(std::begin(channelNodes), std::end(channelNodes), channelNode) == std::end(channelNodes))
+				{
+					channelNodes.push_back(channelNode);
+				}
+			}
+		}
+	}
+
+	return streamChannelNodes;
+}
+
 // Flatten node hierarchy
 Nodes flattenEntityNode(Node* node, Model::Mode const mode)
 {
@@ -388,72 +620,660 @@ void removeNodes(Nodes& list, int first, int last)
 #endif
 }
 
-// Returns the index where entity should be inserted to keep a sorted list by entityID
-int sortedIndexForEntity(Nodes const& list, la::avdecc::UniqueIdentifier const& entityID)
-{
-	auto index = 0;
-	for (auto const* node : list)
+// Order maintaining section index of flattened nodes, organized in blocks (a root node followed by its children) sorted by entityID
+// Blocks are stored in a treap ordered by entityID where each tree node also holds the sections count of its subtree, so that inserting or removing a block and looking up a section are done in O(log N), without touching the other blocks
+class SectionIndex
+{
+public:
+	// Inserts a block of nodes (root node first) at the given section, which must be its sorted section
+	void insertBlock(Nodes const& nodes, int const firstSection)
+	{
+		if (!AVDECC_ASSERT_WITH_RET(!nodes.empty(), "Block should not be empty"))
+		{
+			return;
+		}
+
+		auto const* const root = nodes.front();
+		auto const key = root->entityID().getValue();
+		if (!AVDECC_ASSERT_WITH_RET(sectionsBefore(key, false) == firstSection, "Blocks should be sorted by entityID"))
+		{
+			return;
+		}
+
+		auto treeNode = std::make_unique<TreeNode>();
+		treeNode->key = key;
+		treeNode->priority = treePriority(key);
+		treeNode->count = static_cast<int>(nodes.size());
+		treeNode->subtreeCount = treeNode->count;
+
+		auto [left, right] = split(std::move(_tree), key);
+		_tree = merge(merge(std::move(left), std::move(treeNode)), std::move(right));
+
+		if (root->type() == Node::Type::Entity)
+		{
+			_entityBlocks.insert(root->entityID());
+		}
+
+		for (auto offset = 0u; offset < nodes.size(); ++offset)
+		{
+			_nodeLocations[nodes[offset]] = NodeLocation{ key, static_cast<int>(offset) };
+		}
+	}
+
+	// Removes a block of nodes (root node first)
+	void removeBlock(Nodes const& nodes)
+	{
+		if (!AVDECC_ASSERT_WITH_RET(!nodes.empty(), "Block should not be empty"))
+		{
+			return;
+		}
+
+		auto const* const root = nodes.front();
+		if (!AVDECC_ASSERT_WITH_RET(_nodeLocations.count(root) != 0, "Block not found"))
+		{
+			return;
+		}
+
+		if (root->type() == Node::Type::Entity)
+		{
+			_entityBlocks.erase(root->entityID());
+		}
+
+		for (auto const* const node : nodes)
+		{
+			_nodeLocations.erase(node);
+		}
+
+		_tree = erase(std::move(_tree), root->entityID().getValue());
+	}
+
+	// Returns the section where a block for entityID should be inserted to keep sections sorted by entityID
+	int sortedSectionForEntity(la::avdecc::UniqueIdentifier const& entityID) const
+	{
+		return sectionsBefore(entityID.getValue(), true);
+	}
+
+	// Returns the total count of sections
+	int sectionsCount() const
+	{
+		return subtreeCount(_tree);
+	}
+
+	// Returns the section of a node, -1 if not found
+	int sectionOf(Node const* const node) const
+	{
+		auto const it = _nodeLocations.find(node);
+		if (!AVDECC_ASSERT_WITH_RET(it != std::end(_nodeLocations), "Index not found"))
+		{
+			return -1;
+		}
+
+		auto const& location = it->second;
+		return sectionsBefore(location.key, false) + location.offset;
+	}
+
+	// Returns the section of an EntityNode, -1 if not found
+	int sectionOf(la::avdecc::UniqueIdentifier const entityID) const
+	{
+		if (_entityBlocks.count(entityID) == 0)
+		{
+			return -1;
+		}
+		return sectionsBefore(entityID.getValue(), false);
+	}
+
+	void clear()
+	{
+		_tree.reset();
+		_entityBlocks.clear();
+		_nodeLocations.clear();
+	}
+
+private:
+	// A block of the treap, ordered by key (entityID of the root node) as a binary search tree, and by priority as a heap
+	struct TreeNode
+	{
+		std::uint64_t key{ 0u };
+		std::uint64_t priority{ 0u };
+		int count{ 0 }; // Sections count of the block
+		int subtreeCount{ 0 }; // Sections count of the block and all its descendants
+		std::unique_ptr<TreeNode> left{};
+		std::unique_ptr<TreeNode> right{};
+	};
+	using Tree = std::unique_ptr<TreeNode>;
+
+	struct NodeLocation
+	{
+		std::uint64_t key{ 0u };
+		int offset{ 0 };
+	};
+
+	// Pseudo random but reproducible priority (SplitMix64 finalizer), entityIDs being often close to each other
+	static std::uint64_t treePriority(std::uint64_t const key) noexcept
+	{
+		auto value = key + 0x9E3779B97F4A7C15u;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9u;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBu;
+		return value ^ (value >> 31);
+	}
+
+	static int subtreeCount(Tree const& tree) noexcept
+	{
+		return tree ? tree->subtreeCount : 0;
+	}
+
+	static void updateSubtreeCount(TreeNode& treeNode) noexcept
+	{
+		treeNode.subtreeCount = subtreeCount(treeNode.left) + treeNode.count + subtreeCount(treeNode.right);
+	}
+
+	// Splits a tree into the blocks before key, and the others
+	static std::pair<Tree, Tree> split(Tree tree, std::uint64_t const key)
+	{
+		if (!tree)
+		{
+			return {};
+		}
+
+		if (tree->key < key)
+		{
+			auto [left, right] = split(std::move(tree->right), key);
+			tree->right = std::move(left);
+			updateSubtreeCount(*tree);
+			return { std::move(tree), std::move(right) };
+		}
+
+		auto [left, right] = split(std::move(tree->left), key);
+		tree->left = std::move(right);
+		updateSubtreeCount(*tree);
+		return { std::move(left), std::move(tree) };
+	}
+
+	// Merges two trees, all the blocks of left being before the ones of right
+	static Tree merge(Tree left, Tree right)
+	{
+		if (!left)
+		{
+			return right;
+		}
+		if (!right)
+		{
+			return left;
+		}
+
+		if (left->priority > right->priority)
+		{
+			left->right = merge(std::move(left->right), std::move(right));
+			updateSubtreeCount(*left);
+			return left;
+		}
+
+		right->left = merge(std::move(left), std::move(right->left));
+		updateSubtreeCount(*right);
+		return right;
+	}
+
+	static Tree erase(Tree tree, std::uint64_t const key)
+	{
+		if (!tree)
+		{
+			return {};
+		}
+
+		if (tree->key == key)
+		{
+			return merge(std::move(tree->left), std::move(tree->right));
+		}
+
+		if (key < tree->key)
+		{
+			tree->left = erase(std::move(tree->left), key);
+		}
+		else
+		{
+			tree->right = erase(std::move(tree->right), key);
+		}
+		updateSubtreeCount(*tree);
+		return tree;
+	}
+
+	// Returns the count of sections of the blocks before key (including the block of key if inclusive is set)
+	int sectionsBefore(std::uint64_t const key, bool const inclusive) const
+	{
+		auto sections = 0;
+		auto const* treeNode = _tree.get();
+		while (treeNode)
+		{
+			if (treeNode->key < key || (inclusive && treeNode->key == key))
+			{
+				sections += subtreeCount(treeNode->left) + treeNode->count;
+				treeNode = treeNode->right.get();
+			}
+			else
+			{
+				treeNode = treeNode->left.get();
+			}
+		}
+		return sections;
+	}
+
+	Tree _tree{};
+	std::unordered_set<la::avdecc::UniqueIdentifier, la::avdecc::UniqueIdentifier::hash> _entityBlocks{}; // EntityIDs of the blocks having an EntityNode root
+	std::unordered_map<Node const*, NodeLocation> _nodeLocations{}; // Location by node
+};
+
+// Returns cluster channel name.
+// It is assumed that if channel == 0, the channel is not displayed
+QString clusterChannelName(QString const& clusterName, std::uint16_t const channel)
+{
+	if (channel > 0)
+	{
+		return QString{ "%1.%2" }.arg(clusterName).arg(channel);
+	}
+
+	return clusterName;
+}
+
+// Returns true if intersection data is in its default state (not connected, no flag, no smart connectable stream)
+bool isDefaultIntersectionData(Model::IntersectionData const& intersectionData)
+{
+#if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
+	if (intersectionData.animation)
+	{
+		return false;
+	}
+#endif
+	return intersectionData.state == Model::IntersectionData::State::NotConnected && intersectionData.flags.empty() && intersectionData.smartConnectableStreams.empty();
+}
+
+// Returns the default intersection data for the given type (talker and listener are not set)
+Model::IntersectionData const& defaultIntersectionData(Model::IntersectionData::Type const type)
+{
+	static constexpr auto TypesCount = la::avdecc::utils::to_integral(Model::IntersectionData::Type::SingleChannel_SingleChannel) + 1;
+	static auto const s_defaultData = []()
+	{
+		auto defaultData = std::array<Model::IntersectionData, TypesCount>{};
+		for (auto index = 0u; index < defaultData.size(); ++index)
+		{
+			defaultData[index].type = static_cast<Model::IntersectionData::Type>(index);
+		}
+		return defaultData;
+	}();
+
+	auto const index = la::avdecc::utils::to_integral(type);
+	if (!AVDECC_ASSERT_WITH_RET(index < TypesCount, "Invalid intersection type"))
+	{
+		return s_defaultData[0];
+	}
+	return s_defaultData[index];
+}
+
+// Compact intersection data, as stored (smart connectable streams and animation are stored aside, in IntersectionColdData)
+struct IntersectionCell
+{
+	std::uint8_t type{ 0u };
+	std::uint8_t state{ 0u };
+	std::uint8_t flags{ 0u };
+};
+static_assert(la::avdecc::utils::to_integral(Model::IntersectionData::Type::SingleChannel_SingleChannel) <= 0xFF, "IntersectionCell::type too small");
+static_assert(la::avdecc::utils::to_integral(Model::IntersectionData::State::PartiallyConnected) <= 0xFF, "IntersectionCell::state too small");
+static_assert(la::avdecc::utils::to_integral(Model::IntersectionData::Flag::LatencyError) <= 0x80, "IntersectionCell::flags too small");
+
+// Rarely used part of intersection data, only stored when not empty
+struct IntersectionColdData
+{
+	std::vector<Model::IntersectionData::SmartConnectableStream> smartConnectableStreams{};
+#if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
+	QVariantAnimation* animation{ nullptr };
+#endif
+};
+
+IntersectionCell makeIntersectionCell(Model::IntersectionData const& intersectionData)
+{
+	auto cell = IntersectionCell{};
+	cell.type = static_cast<std::uint8_t>(la::avdecc::utils::to_integral(intersectionData.type));
+	cell.state = static_cast<std::uint8_t>(la::avdecc::utils::to_integral(intersectionData.state));
+	cell.flags = static_cast<std::uint8_t>(intersectionData.flags.value());
+	return cell;
+}
+
+// Sets type, state and flags of intersectionData from a cell
+void applyIntersectionCell(IntersectionCell const& cell, Model::IntersectionData& intersectionData)
+{
+	intersectionData.type = static_cast<Model::IntersectionData::Type>(cell.type);
+	intersectionData.state = static_cast<Model::IntersectionData::State>(cell.state);
+	intersectionData.flags.assign(static_cast<Model::IntersectionData::Flags::underlying_value_type>(cell.flags));
+}
+
+// Cache of stream format compatibility verdicts (WrongFormat flags), by listener stream node then by talker and listener current formats
+// The listener supported formats never change during the life of a node, the node identifies them
+// Thread safe, as it's used by the workers of ModelPrivate::precomputeIntersectionData
+class StreamFormatCompatibilityCache
+{
+public:
+	using Verdict = Model::IntersectionData::Flags;
+
+	// Returns the verdict for the formats, calling computeVerdict if it's not cached yet
+	template<typename ComputeVerdict>
+	Verdict get(StreamNode const* const listenerStreamNode, la::avdecc::entity::model::StreamFormat const talkerStreamFormat, la::avdecc::entity::model::StreamFormat const listenerStreamFormat, ComputeVerdict&& computeVerdict)
+	{
+		auto const formats = FormatPair{ talkerStreamFormat.getValue(), listenerStreamFormat.getValue() };
+
+		{
+			auto const lg = std::shared_lock{ _lock };
+			auto const listenerIt = _verdicts.find(listenerStreamNode);
+			if (listenerIt != std::end(_verdicts))
+			{
+				auto const it = listenerIt->second.find(formats);
+				if (it != std::end(listenerIt->second))
+				{
+					return it->second;
+				}
+			}
+		}
+
+		auto const verdict = computeVerdict();
+
+		{
+			auto const lg = std::unique_lock{ _lock };
+			_verdicts[listenerStreamNode].emplace(formats, verdict);
+		}
+
+		return verdict;
+	}
+
+	// Removes all verdicts of a listener stream node (its current format changed, or it's being destroyed)
+	void invalidateListener(StreamNode const* const listenerStreamNode)
+	{
+		auto const lg = std::unique_lock{ _lock };
+		_verdicts.erase(listenerStreamNode);
+	}
+
+	void clear()
+	{
+		auto const lg = std::unique_lock{ _lock };
+		_verdicts.clear();
+	}
+
+private:
+	using FormatPair = std::pair<std::uint64_t, std::uint64_t>;
+
+	struct FormatPairHash
+	{
+		std::size_t operator()(FormatPair const& formats) const
+		{
+			auto const h1 = std::hash<std::uint64_t>{}(formats.first);
+			auto const h2 = std::hash<std::uint64_t>{}(formats.second);
+			return h1 ^ (h2 << 1);
+		}
+	};
+
+	std::shared_mutex _lock{};
+	std::unordered_map<StreamNode const*, std::unordered_map<FormatPair, Verdict, FormatPairHash>> _verdicts{};
+};
+
+// Sparse intersection data storage, keyed by talker and listener nodes.
+// Only intersections that are not in their default state are stored, the others are implicit
+// This way, inserting or removing nodes only touches the intersections of these nodes
+// Each stored intersection is a compact cell, smart connectable streams (only found on connected intersections) are kept in a side table
+class IntersectionDataStore
+{
+public:
+	// Returns stored intersection cell, nullptr if the intersection is implicit
+	IntersectionCell const* find(Node const* const talker, Node const* const listener) const
+	{
+		return _cells.find(talker, listener);
+	}
+
+	// Loads all stored intersection data (talker and listener are not set), returns false if the intersection is implicit
+	bool load(Node const* const talker, Node const* const listener, Model::IntersectionData& intersectionData) const
+	{
+		auto const* const cell = find(talker, listener);
+		if (!cell)
+		{
+			return false;
+		}
+
+		applyIntersectionCell(*cell, intersectionData);
+
+		if (auto const* const coldData = _coldData.find(talker, listener))
+		{
+			intersectionData.smartConnectableStreams = coldData->smartConnectableStreams;
+#if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
+			intersectionData.animation = coldData->animation;
+#endif
+		}
+		else
+		{
+			intersectionData.smartConnectableStreams.clear();
+#if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
+			intersectionData.animation = nullptr;
+#endif
+		}
+		return true;
+	}
+
+	// Stores intersection data if it's not in its default state, removes it otherwise
+	void update(Model::IntersectionData&& intersectionData)
+	{
+		auto const* const talker = intersectionData.talker;
+		auto const* const listener = intersectionData.listener;
+
+		if (isDefaultIntersectionData(intersectionData))
+		{
+			_cells.erase(talker, listener);
+			_coldData.erase(talker, listener);
+			return;
+		}
+
+		_cells.assign(talker, listener, makeIntersectionCell(intersectionData));
+
+		auto hasColdData = !intersectionData.smartConnectableStreams.empty();
+#if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
+		hasColdData |= intersectionData.animation != nullptr;
+#endif
+		if (hasColdData)
+		{
+			auto& coldData = _coldData.value(talker, listener);
+			coldData.smartConnectableStreams = std::move(intersectionData.smartConnectableStreams);
+#if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
+			coldData.animation = intersectionData.animation;
+#endif
+		}
+		else
+		{
+			_coldData.erase(talker, listener);
+		}
+	}
+
+	// Removes all intersections of a talker
+	void removeTalker(Node const* const talker)
+	{
+		_cells.removeTalker(talker);
+		_coldData.removeTalker(talker);
+	}
+
+	// Removes all intersections of a listener
+	void removeListener(Node const* const listener)
+	{
+		_cells.removeListener(listener);
+		_coldData.removeListener(listener);
+	}
+
+	void clear()
+	{
+		_cells.clear();
+		_coldData.clear();
+	}
+
+	// Returns the count of explicitly stored intersections
+	std::size_t size() const
+	{
+		return _cells.size();
+	}
+
+private:
+	// Stored intersections
+	IntersectionMap<IntersectionCell> _cells{};
+	// Cold data of stored intersections, only for intersections having some
+	IntersectionMap<IntersectionColdData> _coldData{};
+};
+
+// Flags of (partially) connected children reported by Entity summary intersections
+static constexpr auto SummaryAggregatedFlags = std::array<Model::IntersectionData::Flag, 6>{ Model::IntersectionData::Flag::InterfaceDown, Model::IntersectionData::Flag::WrongDomain, Model::IntersectionData::Flag::WrongFormatType, Model::IntersectionData::Flag::WrongFormatImpossible, Model::IntersectionData::Flag::WrongFormatPossible, Model::IntersectionData::Flag::LatencyError };
+
+// Aggregated state of the children of a summary intersection, so that a child change updates the summary without visiting all its children
+// Only (partially) connected children contribute to the aggregate
+class SummaryAggregate
+{
+public:
+	void add(Model::IntersectionData::State const state, Model::IntersectionData::Flags const& flags) noexcept
+	{
+		update(state, flags, true);
+	}
+
+	void remove(Model::IntersectionData::State const state, Model::IntersectionData::Flags const& flags) noexcept
+	{
+		update(state, flags, false);
+	}
+
+	bool hasConnectedChild() const noexcept
+	{
+		return _connectedCount != 0u;
+	}
+
+	bool hasPartiallyConnectedChild() const noexcept
+	{
+		return _partiallyConnectedCount != 0u;
+	}
+
+	// Returns true if all (partially) connected children are MediaLocked (also true if there is none)
+	bool areAllLocked() const noexcept
 	{
-		if (node->entityID() > entityID)
+		return _notLockedCount == 0u;
+	}
+
+	// Returns the SummaryAggregatedFlags set by at least one (partially) connected child
+	Model::IntersectionData::Flags flags() const noexcept
+	{
+		auto flags = Model::IntersectionData::Flags{};
+		for (auto i = 0u; i < SummaryAggregatedFlags.size(); ++i)
 		{
-			break;
+			if (_flagCounts[i] != 0u)
+			{
+				flags.set(SummaryAggregatedFlags[i]);
+			}
 		}
-		++index;
+		return flags;
 	}
-	return index;
-}
-
-// Build and returns a NodeSectionMap and a EntitySectionMap from nodes (quick access maps)
-std::pair<NodeSectionMap, EntitySectionMap> buildNodeSectionMaps(Nodes const& nodes)
-{
-	NodeSectionMap nodeSectionMap;
-	EntitySectionMap entitySectionMap;
 
-	for (auto section = 0u; section < nodes.size(); ++section)
+private:
+	void update(Model::IntersectionData::State const state, Model::IntersectionData::Flags const& flags, bool const isAdded) noexcept
 	{
-		auto* node = nodes[section];
-		if (node->type() == Node::Type::Entity)
+		auto const isConnected = state == Model::IntersectionData::State::Connected;
+		auto const isPartiallyConnected = state == Model::IntersectionData::State::PartiallyConnected;
+		if (!isConnected && !isPartiallyConnected)
 		{
-			entitySectionMap.insert(std::make_pair(node->entityID(), section));
+			return;
+		}
+
+		auto const updateCount = [isAdded](std::size_t& count)
+		{
+			if (isAdded)
+			{
+				++count;
+			}
+			else if (AVDECC_ASSERT_WITH_RET(count != 0u, "Removing a child that was not aggregated"))
+			{
+				--count;
+			}
+		};
+
+		updateCount(isConnected ? _connectedCount : _partiallyConnectedCount);
+		if (!flags.test(Model::IntersectionData::Flag::MediaLocked))
+		{
+			updateCount(_notLockedCount);
+		}
+		for (auto i = 0u; i < SummaryAggregatedFlags.size(); ++i)
+		{
+			if (flags.test(SummaryAggregatedFlags[i]))
+			{
+				updateCount(_flagCounts[i]);
+			}
 		}
-		nodeSectionMap.insert(std::make_pair(node, section));
 	}
 
-	return std::make_pair(nodeSectionMap, entitySectionMap);
-}
+	std::size_t _connectedCount{ 0u };
+	std::size_t _partiallyConnectedCount{ 0u };
+	std::size_t _notLockedCount{ 0u };
+	std::array<std::size_t, SummaryAggregatedFlags.size()> _flagCounts{};
+};
 
-// Return the index of a node contained in a NodeSectionMap
-int indexOf(NodeSectionMap const& map, Node const* const node)
+// Aggregated children of an Entity summary intersection: children of the talker Entity (against the listener) and children of the listener Entity (against the talker)
+struct SummaryAggregates
 {
-	auto const it = map.find(node);
-	if (!AVDECC_ASSERT_WITH_RET(it != std::end(map), "Index not found"))
-	{
-		return -1;
-	}
-	return it->second;
-}
+	SummaryAggregate talkerChildren{};
+	SummaryAggregate listenerChildren{};
+	// Children with dirty flags, to be resolved before reading the aggregates
+	IntersectionKeySet pendingChildren{};
+};
+
+// Talker and listener node hierarchies of an entity, not added to the model yet
+struct EntityNodes
+{
+	std::unique_ptr<EntityNode> talker{};
+	std::unique_ptr<EntityNode> listener{};
+};
 
-// Return the index of an EntityNode contained in a EntitySectionMap
-int indexOf(EntitySectionMap const& map, la::avdecc::UniqueIdentifier const entityID)
+// Runs tasksCount tasks on the calling thread and on idle threads of the global pool, returns once they are all done
+// The calling thread always takes part so that tasks complete even if the pool is busy, tasks must be independent from each other
+void runTasks(std::size_t const tasksCount, std::function<void(std::size_t const task)> const& runTask)
 {
-	auto const it = map.find(entityID);
-	if (it == std::end(map))
+	if (tasksCount == 0u)
 	{
-		return -1;
+		return;
 	}
-	return it->second;
-}
 
-// Returns cluster channel name.
-// It is assumed that if channel == 0, the channel is not displayed
-QString clusterChannelName(QString const& clusterName, std::uint16_t const channel)
-{
-	if (channel > 0)
+	auto nextTask = std::atomic<std::size_t>{ 0u };
+	auto const runPendingTasks = [tasksCount, &runTask, &nextTask]()
 	{
-		return QString{ "%1.%2" }.arg(clusterName).arg(channel);
+		for (auto task = nextTask++; task < tasksCount; task = nextTask++)
+		{
+			runTask(task);
+		}
+	};
+
+	// Threads of the global pool are created on demand and expire when unused, none is kept alive for the model
+	auto* const threadPool = QThreadPool::globalInstance();
+	auto const helpersCount = std::min(static_cast<std::size_t>(std::max(0, threadPool->maxThreadCount() - 1)), tasksCount - 1u);
+	auto helpersDone = QSemaphore{};
+	auto helpers = std::vector<std::unique_ptr<QRunnable>>{};
+	helpers.reserve(helpersCount);
+	for (auto i = std::size_t{ 0u }; i < helpersCount; ++i)
+	{
+		auto helper = std::unique_ptr<QRunnable>{ QRunnable::create(
+			[&runPendingTasks, &helpersDone]()
+			{
+				runPendingTasks();
+				helpersDone.release();
+			}) };
+		helper->setAutoDelete(false);
+		threadPool->start(helper.get());
+		helpers.push_back(std::move(helper));
 	}
 
-	return clusterName;
+	runPendingTasks();
+
+	// All tasks are done, helpers still queued behind other tasks of the pool are not needed anymore
+	auto startedHelpersCount = helpersCount;
+	for (auto const& helper : helpers)
+	{
+		if (threadPool->tryTake(helper.get()))
+		{
+			--startedHelpersCount;
+		}
+	}
+	helpersDone.acquire(static_cast<int>(startedHelpersCount));
 }
 
 } // namespace priv
@@ -462,6 +1282,14 @@ class ModelPrivate : public QObject
 {
 	Q_OBJECT
 public:
+	// Minimum count of entities coming online at once to rebuild the whole model instead of inserting them one by one, whatever the count of already known entities
+	// Below this count, each entity insertion shifts the following sections once, which costs less than rebuilding the whole model
+	static constexpr auto BulkInsertionMinimumEntitiesCount = std::size_t{ 16u };
+	// Minimum count of intersections in the matrix to compute them on worker threads when the whole model is rebuilt
+	static constexpr auto ParallelComputationMinimumIntersectionsCount = std::size_t{ 16384u };
+	// Count of talker sections computed at once by a worker thread
+	static constexpr auto ParallelComputationTalkersBlockSize = std::size_t{ 16u };
+
 	ModelPrivate(Model* q)
 		: q_ptr{ q }
 	{
@@ -542,15 +1370,54 @@ public:
 		return section >= 0 && section < listenerSectionCount();
 	}
 
+	// Returns intersection data at talkerSection/listenerSection, computing it first if it's dirty (sections must be valid)
+	Model::IntersectionData intersectionDataAt(int talkerSection, int listenerSection)
+	{
+		auto* const talker = _talkerNodes[talkerSection];
+		auto* const listener = _listenerNodes[listenerSection];
+
+		resolveIntersectionData(talker, listener);
+
+		auto intersectionData = Model::IntersectionData{};
+		if (!_intersectionData.load(talker, listener, intersectionData))
+		{
+			intersectionData = priv::defaultIntersectionData(determineIntersectionType(talker, listener));
+		}
+		intersectionData.talker = talker;
+		intersectionData.listener = listener;
+
+		return intersectionData;
+	}
+
+	// Returns type, state and flags of intersection data at talkerSection/listenerSection, computing it first if it's dirty (sections must be valid)
+	// Smart connectable streams are not loaded, talker and listener are not set
+	Model::IntersectionData compactIntersectionDataAt(int talkerSection, int listenerSection)
+	{
+		return compactIntersectionData(_talkerNodes[talkerSection], _listenerNodes[listenerSection]);
+	}
+
+	// Returns type, state and flags of intersection data of talker and listener nodes, computing it first if it's dirty (nodes must be in the model)
+	// Smart connectable streams are not loaded, talker and listener are not set
+	Model::IntersectionData compactIntersectionData(Node* const talker, Node* const listener)
+	{
+		resolveIntersectionData(talker, listener);
+
+		if (auto const* const cell = _intersectionData.find(talker, listener))
+		{
+			auto intersectionData = Model::IntersectionData{};
+			priv::applyIntersectionCell(*cell, intersectionData);
+			return intersectionData;
+		}
+
+		return priv::defaultIntersectionData(determineIntersectionType(talker, listener));
+	}
+
 #if ENABLE_CONNECTION_MATRIX_DEBUG
 	void dump() const
 	{
-		auto const rows = _intersectionData.size();
-		auto const columns = rows > 0 ? _intersectionData[0].size() : 0u;
-
 		qDebug() << "talkers" << _talkerNodes.size();
 		qDebug() << "listeners" << _listenerNodes.size();
-		qDebug() << "intersections" << rows << "x" << columns;
+		qDebug() << "intersections" << _talkerNodes.size() << "x" << _listenerNodes.size() << "(" << _intersectionData.size() << "stored )";
 	}
 #endif
 
@@ -562,7 +1429,7 @@ public:
 			return;
 		}
 
-		auto& intersectionData = _intersectionData[talkerSection][listenerSection];
+		auto intersectionData = intersectionDataAt(talkerSection, listenerSection);
 
 		if (!intersectionData.animation)
 		{
@@ -581,6 +1448,9 @@ public:
 				auto const index = q->index(talkerSection, listenerSection);
 				emit q->dataChanged(index, index);
 			});
+
+		// An intersection with an animation is always stored
+		_intersectionData.update(std::move(intersectionData));
 	}
 #endif
 
@@ -762,7 +1632,7 @@ public:
 	}
 
 	// Determines intersection type according to talker and listener nodes
-	Model::IntersectionData::Type determineIntersectionType(Node* talker, Node* listener) const
+	Model::IntersectionData::Type determineIntersectionType(Node const* const talker, Node const* const listener) const
 	{
 		if (!AVDECC_ASSERT_WITH_RET(talker, "Invalid talker") || !AVDECC_ASSERT_WITH_RET(listener, "Invalid listener"))
 		{
@@ -882,20 +1752,275 @@ public:
 		return Model::IntersectionData::Type::None;
 	}
 
-	// Initializes intersection data
-	void initializeIntersectionData(Node* talker, Node* listener, Model::IntersectionData& intersectionData)
+	// Returns true if the intersection has never been computed (neither the talker row was resolved after the listener was inserted, nor the listener column after the talker was inserted)
+	bool isUncomputedIntersection(Node const* const talker, Node const* const listener) const
+	{
+		auto const talkerIt = _talkerComputations.find(talker);
+		auto const listenerIt = _listenerComputations.find(listener);
+		if (talkerIt == std::end(_talkerComputations) || listenerIt == std::end(_listenerComputations))
+		{
+			return false;
+		}
+
+		auto const& talkerComputation = talkerIt->second;
+		auto const& listenerComputation = listenerIt->second;
+		if (talkerComputation.resolvedGeneration > listenerComputation.insertedGeneration || listenerComputation.resolvedGeneration > talkerComputation.insertedGeneration)
+		{
+			return false;
+		}
+		return !isPrecomputedIntersection(talker, listener);
+	}
+
+	// Returns true if the intersection type only depends on talker and listener nodes state (no summary, no channel connection), and can be computed on a worker thread
+	static bool isParallelComputableIntersectionType(Model::IntersectionData::Type const type) noexcept
+	{
+		switch (type)
+		{
+			case Model::IntersectionData::Type::OfflineOutputStream_RedundantStream:
+			case Model::IntersectionData::Type::OfflineOutputStream_SingleStream:
+			case Model::IntersectionData::Type::RedundantStream_RedundantStream:
+			case Model::IntersectionData::Type::RedundantStream_RedundantStream_Forbidden:
+			case Model::IntersectionData::Type::RedundantStream_SingleStream:
+			case Model::IntersectionData::Type::SingleStream_SingleStream:
+			case Model::IntersectionData::Type::SingleChannel_SingleChannel:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	// Returns true if the intersection was computed by precomputeIntersectionData during the last full rebuild
+	bool isPrecomputedIntersection(Node const* const talker, Node const* const listener) const
+	{
+		if (_precomputedTalkers.count(talker) == 0 || _precomputedListeners.count(listener) == 0)
+		{
+			return false;
+		}
+		return isParallelComputableIntersectionType(determineIntersectionType(talker, listener));
+	}
+
+	// Accumulates dirty flags for an intersection, it will be computed the next time it's accessed
+	void addIntersectionDirtyFlags(Node const* const talker, Node const* const listener, IntersectionDirtyFlags const dirtyFlags)
+	{
+		// Not computed yet, everything will be computed anyway
+		if (isUncomputedIntersection(talker, listener))
+		{
+			return;
+		}
+
+		_intersectionDirtyFlags.value(talker, listener) |= dirtyFlags;
+
+		// Summaries aggregating this intersection will have to resolve it first
+		forEachParentSummaryAggregates(talker, listener,
+			[talker, listener](priv::SummaryAggregates& aggregates, priv::SummaryAggregate& /*children*/)
+			{
+				aggregates.pendingChildren.insert({ talker, listener });
+			});
+	}
+
+	// Returns true if the node is aggregated by the Entity summary intersections of its parent (Entity_Entity, Entity_SingleStream and Entity_RedundantStream)
+	bool isSummaryAggregatedChild(Node const* const node) const noexcept
+	{
+		switch (_mode)
+		{
+			case Model::Mode::Stream:
+				return node->isRedundantNode() || node->isStreamNode();
+			case Model::Mode::Channel:
+				return node->isChannelNode();
+			default:
+				return false;
+		}
+	}
+
+	// Calls handler for each existing summary aggregates the intersection is a child of
+	template<typename Handler>
+	void forEachParentSummaryAggregates(Node const* const talker, Node const* const listener, Handler&& handler)
+	{
+		if (_summaryAggregates.empty())
+		{
+			return;
+		}
+
+		auto const* const talkerParent = talker->parent();
+		if (talkerParent && talkerParent->isEntityNode() && isSummaryAggregatedChild(talker))
+		{
+			if (auto* const aggregates = _summaryAggregates.find(talkerParent, listener))
+			{
+				handler(*aggregates, aggregates->talkerChildren);
+			}
+		}
+
+		auto const* const listenerParent = listener->parent();
+		if (listenerParent && listenerParent->isEntityNode() && isSummaryAggregatedChild(listener))
+		{
+			if (auto* const aggregates = _summaryAggregates.find(talker, listenerParent))
+			{
+				handler(*aggregates, aggregates->listenerChildren);
+			}
+		}
+	}
+
+	// Returns the aggregated children of an Entity summary intersection, built on first access then updated as children are computed
+	priv::SummaryAggregates resolveSummaryAggregates(Node* const talker, Node* const listener)
+	{
+		if (auto* const existingAggregates = _summaryAggregates.find(talker, listener))
+		{
+			// Compute children changed since last access, their changes are applied to the aggregates
+			auto const pendingChildren = std::move(existingAggregates->pendingChildren);
+			existingAggregates->pendingChildren.clear();
+			for (auto const& [childTalker, childListener] : pendingChildren)
+			{
+				// Nodes are owned by the model, keys only reference them as const
+				resolveIntersectionData(const_cast<Node*>(childTalker), const_cast<Node*>(childListener));
+			}
+
+			// Computing children may have built other aggregates, find them again
+			return *_summaryAggregates.find(talker, listener);
+		}
+
+		auto aggregates = priv::SummaryAggregates{};
+		if (talker->isEntityNode())
+		{
+			for (auto const& childNode : talker->children())
+			{
+				auto* const child = childNode.get();
+				if (isSummaryAggregatedChild(child))
+				{
+					auto const childIntersectionData = compactIntersectionData(child, listener);
+					aggregates.talkerChildren.add(childIntersectionData.state, childIntersectionData.flags);
+				}
+			}
+		}
+		if (listener->isEntityNode())
+		{
+			for (auto const& childNode : listener->children())
+			{
+				auto* const child = childNode.get();
+				if (isSummaryAggregatedChild(child))
+				{
+					auto const childIntersectionData = compactIntersectionData(talker, child);
+					aggregates.listenerChildren.add(childIntersectionData.state, childIntersectionData.flags);
+				}
+			}
+		}
+
+		// Only store the aggregates once all children are computed, so computing them doesn't update the aggregates being built
+		return _summaryAggregates.assign(talker, listener, std::move(aggregates));
+	}
+
+	// Computes the intersection if it has never been computed, or if it has pending dirty flags
+	void resolveIntersectionData(Node* const talker, Node* const listener)
+	{
+		if (isUncomputedIntersection(talker, listener))
+		{
+			resolveUncomputedIntersections(talker, listener);
+			return;
+		}
+
+		auto const* const dirtyFlags = _intersectionDirtyFlags.find(talker, listener);
+		if (!dirtyFlags)
+		{
+			return;
+		}
+		computeIntersection(talker, listener, *dirtyFlags);
+	}
+
+	// Computes all never computed intersections of the row of the talker, or of the column of the listener (the most recently inserted one), so the lazy computation state is only tracked by node
+	void resolveUncomputedIntersections(Node* const talker, Node* const listener)
+	{
+		auto& talkerComputation = _talkerComputations[talker];
+		auto& listenerComputation = _listenerComputations[listener];
+		auto const isRow = talkerComputation.insertedGeneration >= listenerComputation.insertedGeneration;
+
+		// Start from the end so that children are computed before the summaries of their parent
+		auto intersections = std::vector<std::pair<Node*, Node*>>{};
+		if (isRow)
+		{
+			for (auto it = _listenerNodes.rbegin(); it != _listenerNodes.rend(); ++it)
+			{
+				if (isUncomputedIntersection(talker, *it))
+				{
+					intersections.emplace_back(talker, *it);
+				}
+			}
+		}
+		else
+		{
+			for (auto it = _talkerNodes.rbegin(); it != _talkerNodes.rend(); ++it)
+			{
+				if (isUncomputedIntersection(*it, listener))
+				{
+					intersections.emplace_back(*it, listener);
+				}
+			}
+		}
+
+		// Mark as resolved before computing, summaries access (and resolve) their children
+		(isRow ? talkerComputation : listenerComputation).resolvedGeneration = ++_computationGeneration;
+
+		for (auto const& [intersectionTalker, intersectionListener] : intersections)
+		{
+			computeIntersection(intersectionTalker, intersectionListener, allIntersectionDirtyFlags());
+		}
+	}
+
+	// Computes the intersection for the given dirtyFlags, and updates the summaries aggregating it
+	void computeIntersection(Node* const talker, Node* const listener, IntersectionDirtyFlags const dirtyFlags)
 	{
-		AVDECC_ASSERT(talker, "Invalid talker");
-		AVDECC_ASSERT(listener, "Invalid listener");
+		// Remove dirty flags before computing, summaries access (and resolve) their children
+		_intersectionDirtyFlags.erase(talker, listener);
 
+		auto intersectionData = Model::IntersectionData{};
+		if (!_intersectionData.load(talker, listener, intersectionData))
+		{
+			intersectionData.type = determineIntersectionType(talker, listener);
+		}
 		intersectionData.talker = talker;
 		intersectionData.listener = listener;
 
-		intersectionData.type = determineIntersectionType(talker, listener);
-		intersectionData.flags = {};
+		auto const previousState = intersectionData.state;
+		auto const previousFlags = intersectionData.flags;
+
+		computeIntersectionData(intersectionData, dirtyFlags);
+
+		// Update the summaries aggregating this intersection
+		if (intersectionData.state != previousState || intersectionData.flags.value() != previousFlags.value())
+		{
+			forEachParentSummaryAggregates(talker, listener,
+				[&intersectionData, previousState, &previousFlags](priv::SummaryAggregates& /*aggregates*/, priv::SummaryAggregate& children)
+				{
+					children.remove(previousState, previousFlags);
+					children.add(intersectionData.state, intersectionData.flags);
+				});
+		}
+
+		_intersectionData.update(std::move(intersectionData));
+	}
+
+	// Removes all lazy computation information about talkers
+	void removeTalkersDirtyIntersections(priv::Nodes const& talkers)
+	{
+		for (auto const* const talker : talkers)
+		{
+			_talkerComputations.erase(talker);
+			_precomputedTalkers.erase(talker);
+			_intersectionDirtyFlags.removeTalker(talker);
+			_changedIntersections.removeTalker(talker);
+			_summaryAggregates.removeTalker(talker);
+		}
+	}
 
-		// Compute everything for initial state
-		computeIntersectionData(intersectionData, allIntersectionDirtyFlags());
+	// Removes all lazy computation information about listeners
+	void removeListenersDirtyIntersections(priv::Nodes const& listeners)
+	{
+		for (auto const* const listener : listeners)
+		{
+			_listenerComputations.erase(listener);
+			_precomputedListeners.erase(listener);
+			_intersectionDirtyFlags.removeListener(listener);
+			_changedIntersections.removeListener(listener);
+			_summaryAggregates.removeListener(listener);
+		}
 	}
 
 	// Updates header data for the given dirtyFlags
@@ -998,7 +2123,8 @@ public:
 	}
 
 	// Updates intersection data for the given dirtyFlags
-	void computeIntersectionData(Model::IntersectionData& intersectionData, IntersectionDirtyFlags const dirtyFlags)
+	// Channel connections are read from listenerChannelConnections if set (snapshot taken for worker threads), from ChannelConnectionManager otherwise
+	void computeIntersectionData(Model::IntersectionData& intersectionData, IntersectionDirtyFlags const dirtyFlags, priv::ListenerChannelConnections const* const listenerChannelConnections = nullptr)
 	{
 		// Helper lambdas
 		auto const setSummaryIntersectionDataFlags = [](auto const dontSetInterfaceDownAndDomain, auto const& nodeIntersectionData, auto& intersectionDataFlags)
@@ -1188,127 +2314,34 @@ public:
 
 						if (isMediaLocked)
 						{
-							intersectionData.flags.set(Model::IntersectionData::Flag::MediaLocked);
-						}
-						else
-						{
-							intersectionData.flags.reset(Model::IntersectionData::Flag::MediaLocked);
-						}
-					}
-
-					break;
-				}
-
-				case Model::IntersectionData::Type::Entity_Entity:
-				{
-					// This is a summary intersection, always update all flags
-					intersectionData.flags.clear();
-
-					auto atLeastOneConnectedTalker = false;
-					auto atLeastOnePartiallyConnectedTalker = false;
-					auto allLockedTalker = true;
-					auto atLeastOneConnectedListener = false;
-					auto atLeastOnePartiallyConnectedListener = false;
-					auto allLockedListener = true;
-
-					auto const processIntersection = [&intersectionData, &setSummaryIntersectionDataFlags](auto const& nodeIntersectionData, auto& atLeastOneConnectedNode, auto& atLeastOnePartiallyConnectedNode, auto& allLockedNode)
-					{
-						// Get connected state
-						auto const isConnected = nodeIntersectionData.state == Model::IntersectionData::State::Connected;
-						auto const isPartiallyConnected = nodeIntersectionData.state == Model::IntersectionData::State::PartiallyConnected;
-						atLeastOneConnectedNode |= isConnected;
-						atLeastOnePartiallyConnectedNode |= isPartiallyConnected;
-
-						// Summary on connected nodes only
-						if (isConnected || isPartiallyConnected)
-						{
-							// Compute summary intersection data flags based on currently processing intersection data
-							setSummaryIntersectionDataFlags(false, nodeIntersectionData, intersectionData.flags);
-						}
-						// Get MediaLocked Summary for connected and partially connected nodes
-						if (isConnected || isPartiallyConnected)
-						{
-							allLockedNode &= nodeIntersectionData.flags.test(Model::IntersectionData::Flag::MediaLocked);
-						}
-					};
-
-					auto const entityTalkerSection = priv::indexOf(_talkerNodeSectionMap, intersectionData.talker);
-					auto const entityListenerSection = priv::indexOf(_listenerNodeSectionMap, intersectionData.listener);
-					if (!AVDECC_ASSERT_WITH_RET(isValidTalkerSection(entityTalkerSection), "Invalid talker section") || !AVDECC_ASSERT_WITH_RET(isValidListenerSection(entityListenerSection), "Invalid listener section"))
-					{
-						break;
-					}
-
-					// Process all talker children (against the listener Entity)
-					for (auto const& talkerNode : intersectionData.talker->children())
-					{
-						auto const* const talker = talkerNode.get();
-
-						// Based on the mode, filter relevant nodes
-						switch (_mode)
-						{
-							case Model::Mode::Stream:
-								// Only process Redundant and Stream Nodes
-								if (!talker->isRedundantNode() && !talker->isStreamNode())
-								{
-									continue;
-								}
-								break;
-							case Model::Mode::Channel:
-								// Only process Channel Nodes
-								if (!talker->isChannelNode())
-								{
-									continue;
-								}
-								break;
-							default:
-								AVDECC_ASSERT(false, "Unhandled Mode");
-								break;
-						}
-
-						// Get the IntersectionData source node we'll get the data from
-						auto const talkerSection = priv::indexOf(_talkerNodeSectionMap, talker);
-						auto const& nodeIntersectionData = _intersectionData[talkerSection][entityListenerSection];
-
-						processIntersection(nodeIntersectionData, atLeastOneConnectedTalker, atLeastOnePartiallyConnectedTalker, allLockedTalker);
-					}
-
-					// Process all listener children (against the talker Entity)
-					for (auto const& listenerNode : intersectionData.listener->children())
-					{
-						auto const* const listener = listenerNode.get();
-
-						// Based on the mode, filter relevant nodes
-						switch (_mode)
+							intersectionData.flags.set(Model::IntersectionData::Flag::MediaLocked);
+						}
+						else
 						{
-							case Model::Mode::Stream:
-								// Only process Redundant and Stream Nodes
-								if (!listener->isRedundantNode() && !listener->isStreamNode())
-								{
-									continue;
-								}
-								break;
-							case Model::Mode::Channel:
-								// Only process Channel Nodes
-								if (!listener->isChannelNode())
-								{
-									continue;
-								}
-								break;
-							default:
-								AVDECC_ASSERT(false, "Unhandled Mode");
-								break;
+							intersectionData.flags.reset(Model::IntersectionData::Flag::MediaLocked);
 						}
+					}
 
-						// Get the IntersectionData source node we'll get the data from
-						auto const listenerSection = priv::indexOf(_listenerNodeSectionMap, listener);
-						auto const& nodeIntersectionData = _intersectionData[entityTalkerSection][listenerSection];
+					break;
+				}
 
-						processIntersection(nodeIntersectionData, atLeastOneConnectedListener, atLeastOnePartiallyConnectedListener, allLockedListener);
-					}
+				case Model::IntersectionData::Type::Entity_Entity:
+				{
+					// This is a summary intersection, always update all flags
+					intersectionData.flags.clear();
+
+					// Talker children (against the listener Entity) and listener children (against the talker Entity), based on the mode (see isSummaryAggregatedChild)
+					auto const aggregates = resolveSummaryAggregates(intersectionData.talker, intersectionData.listener);
+					auto const& talkerChildren = aggregates.talkerChildren;
+					auto const& listenerChildren = aggregates.listenerChildren;
 
 					// Update flags
-					if (allLockedTalker && allLockedListener && (atLeastOneConnectedTalker || atLeastOnePartiallyConnectedTalker) && (atLeastOneConnectedListener || atLeastOnePartiallyConnectedListener))
+					intersectionData.flags |= talkerChildren.flags();
+					intersectionData.flags |= listenerChildren.flags();
+
+					auto const atLeastOneConnectedTalker = talkerChildren.hasConnectedChild() || talkerChildren.hasPartiallyConnectedChild();
+					auto const atLeastOneConnectedListener = listenerChildren.hasConnectedChild() || listenerChildren.hasPartiallyConnectedChild();
+					if (talkerChildren.areAllLocked() && listenerChildren.areAllLocked() && atLeastOneConnectedTalker && atLeastOneConnectedListener)
 					{
 						intersectionData.flags.set(Model::IntersectionData::Flag::MediaLocked);
 					}
@@ -1316,11 +2349,11 @@ public:
 					// Update State
 					//// Note: A listener stream can only accept a single connection so if we have at least one TalkerStream connected (to this listener then), all 'possible' streams are connected
 					//if (atLeastOneConnectedTalker && allConnectedListener)
-					if (atLeastOneConnectedTalker || atLeastOneConnectedListener)
+					if (talkerChildren.hasConnectedChild() || listenerChildren.hasConnectedChild())
 					{
 						intersectionData.state = Model::IntersectionData::State::Connected;
 					}
-					else if (atLeastOnePartiallyConnectedTalker || atLeastOnePartiallyConnectedListener)
+					else if (talkerChildren.hasPartiallyConnectedChild() || listenerChildren.hasPartiallyConnectedChild())
 					{
 						intersectionData.state = Model::IntersectionData::State::PartiallyConnected;
 					}
@@ -1352,13 +2385,13 @@ public:
 					{
 						nodeToTraverse = intersectionData.listener;
 						singleNode = intersectionData.talker;
-						singleNodeSection = priv::indexOf(_talkerNodeSectionMap, singleNode);
+						singleNodeSection = _talkerSectionIndex.sectionOf(singleNode);
 					}
 					else if (listenerType == Node::Type::Entity)
 					{
 						nodeToTraverse = intersectionData.talker;
 						singleNode = intersectionData.listener;
-						singleNodeSection = priv::indexOf(_listenerNodeSectionMap, singleNode);
+						singleNodeSection = _listenerSectionIndex.sectionOf(singleNode);
 					}
 					else
 					{
@@ -1392,11 +2425,11 @@ public:
 						if (talkerType == Node::Type::Entity)
 						{
 							talkerSection = singleNodeSection;
-							listenerSection = priv::indexOf(_listenerNodeSectionMap, node);
+							listenerSection = _listenerSectionIndex.sectionOf(node);
 						}
 						else if (listenerType == Node::Type::Entity)
 						{
-							talkerSection = priv::indexOf(_talkerNodeSectionMap, node);
+							talkerSection = _talkerSectionIndex.sectionOf(node);
 							listenerSection = singleNodeSection;
 						}
 
@@ -1406,7 +2439,7 @@ public:
 						}
 
 						// Get the IntersectionData source node we'll get the data from
-						auto const& nodeIntersectionData = _intersectionData[talkerSection][listenerSection];
+						auto const nodeIntersectionData = compactIntersectionDataAt(talkerSection, listenerSection);
 
 						AVDECC_ASSERT(nodeIntersectionData.state != Model::IntersectionData::State::PartiallyConnected, "Should not be partially connected");
 						auto const isConnected = nodeIntersectionData.state == Model::IntersectionData::State::Connected;
@@ -1484,89 +2517,29 @@ public:
 					// This is a summary intersection, always update all flags
 					intersectionData.flags.clear();
 
-					auto const* nodeToTraverse = static_cast<Node const*>(nullptr);
-					auto const* singleNode = static_cast<Node const*>(nullptr);
-					auto singleNodeSection = -1;
-
-					// Determine the Entity and other nodes
-					if (talkerType == Node::Type::Entity)
-					{
-						nodeToTraverse = intersectionData.talker;
-						singleNode = intersectionData.listener;
-						singleNodeSection = priv::indexOf(_listenerNodeSectionMap, singleNode);
-					}
-					else if (listenerType == Node::Type::Entity)
-					{
-						nodeToTraverse = intersectionData.listener;
-						singleNode = intersectionData.talker;
-						singleNodeSection = priv::indexOf(_talkerNodeSectionMap, singleNode);
-					}
-					else
+					if (talkerType != Node::Type::Entity && listenerType != Node::Type::Entity)
 					{
 						AVDECC_ASSERT(false, "Unhandled");
 						break;
 					}
 
-					auto atLeastOneConnected = false;
-					auto atLeastOnePartiallyConnected = false;
-					auto allLocked = true;
-
-					for (auto const& childNode : nodeToTraverse->children())
-					{
-						auto const* const node = childNode.get();
-
-						// Only process Redundant and Stream Nodes (not channels)
-						if (!node->isRedundantNode() && !node->isStreamNode())
-						{
-							continue;
-						}
-
-						// Get the indexes for the Intersection Data
-						auto talkerSection = -1;
-						auto listenerSection = -1;
-						if (talkerType == Node::Type::Entity)
-						{
-							talkerSection = priv::indexOf(_talkerNodeSectionMap, node);
-							listenerSection = singleNodeSection;
-						}
-						else if (listenerType == Node::Type::Entity)
-						{
-							talkerSection = singleNodeSection;
-							listenerSection = priv::indexOf(_listenerNodeSectionMap, node);
-						}
-
-						if (!AVDECC_ASSERT_WITH_RET(isValidTalkerSection(talkerSection), "Invalid talker section") || !AVDECC_ASSERT_WITH_RET(isValidListenerSection(listenerSection), "Invalid listener section"))
-						{
-							break;
-						}
-
-						// Get the IntersectionData source node we'll get the data from
-						auto const& nodeIntersectionData = _intersectionData[talkerSection][listenerSection];
-
-						// Get connected state
-						auto const isConnected = nodeIntersectionData.state == Model::IntersectionData::State::Connected;
-						auto const isPartiallyConnected = nodeIntersectionData.state == Model::IntersectionData::State::PartiallyConnected;
-						atLeastOneConnected |= isConnected;
-						atLeastOnePartiallyConnected |= isPartiallyConnected;
-
-						if (isConnected || isPartiallyConnected)
-						{
-							// Compute summary intersection data flags based on currently processing intersection data
-							setSummaryIntersectionDataFlags(false, nodeIntersectionData, intersectionData.flags);
+					// Redundant and Stream children of the Entity (against the other node)
+					auto const aggregates = resolveSummaryAggregates(intersectionData.talker, intersectionData.listener);
+					auto const& children = talkerType == Node::Type::Entity ? aggregates.talkerChildren : aggregates.listenerChildren;
 
-							// MediaLocked if all connected streams are MediaLocked
-							allLocked &= nodeIntersectionData.flags.test(Model::IntersectionData::Flag::MediaLocked);
-						}
-					}
+					auto const atLeastOneConnected = children.hasConnectedChild();
+					auto const atLeastOnePartiallyConnected = children.hasPartiallyConnectedChild();
 
 					// Update flags
-					if (allLocked && (atLeastOneConnected || atLeastOnePartiallyConnected))
+					intersectionData.flags |= children.flags();
+
+					// MediaLocked if all connected streams are MediaLocked
+					if (children.areAllLocked() && (atLeastOneConnected || atLeastOnePartiallyConnected))
 					{
 						intersectionData.flags.set(Model::IntersectionData::Flag::MediaLocked);
 					}
 
 					// Update State
-					auto const isListenerNodeStream = talkerType == Node::Type::Entity && singleNode->isStreamNode();
 					if (atLeastOneConnected)
 					{
 						intersectionData.state = Model::IntersectionData::State::Connected;
@@ -2009,8 +2982,8 @@ public:
 						auto const* const otherStreamNode = redundantNode->childAt(streamNode->index());
 
 						// Get the indexes for the Intersection Data we'll copy data from (Which is a RedundantStream_RedundantStream node)
-						talkerSection = priv::indexOf(_talkerNodeSectionMap, otherStreamNode);
-						listenerSection = priv::indexOf(_listenerNodeSectionMap, streamNode);
+						talkerSection = _talkerSectionIndex.sectionOf(otherStreamNode);
+						listenerSection = _listenerSectionIndex.sectionOf(streamNode);
 					}
 					else if (listenerType == Node::Type::RedundantInput)
 					{
@@ -2021,8 +2994,8 @@ public:
 						auto const* const otherStreamNode = redundantNode->childAt(streamNode->index());
 
 						// Get the indexes for the Intersection Data we'll copy data from (Which is a RedundantStream_RedundantStream node)
-						talkerSection = priv::indexOf(_talkerNodeSectionMap, streamNode);
-						listenerSection = priv::indexOf(_listenerNodeSectionMap, otherStreamNode);
+						talkerSection = _talkerSectionIndex.sectionOf(streamNode);
+						listenerSection = _listenerSectionIndex.sectionOf(otherStreamNode);
 					}
 					else
 					{
@@ -2035,7 +3008,7 @@ public:
 					}
 
 					// Get the IntersectionData source node we'll copy the data from
-					auto const& sourceIntersectionData = _intersectionData[talkerSection][listenerSection];
+					auto const sourceIntersectionData = intersectionDataAt(talkerSection, listenerSection);
 					AVDECC_ASSERT(sourceIntersectionData.type == Model::IntersectionData::Type::RedundantStream_RedundantStream, "Intersection should be RedundantStream_RedundantStream");
 
 					intersectionData.state = sourceIntersectionData.state;
@@ -2166,8 +3139,7 @@ public:
 					auto const* const listenerChannelNode = static_cast<ChannelNode*>(intersectionData.listener);
 
 					// get the stream indices
-					auto& channelConnectionManager = avdecc::ChannelConnectionManager::getInstance();
-					auto const streamConnectionIndices = channelConnectionManager.getStreamIndexPairUsedByAudioChannelConnection(talkerEntityID, talkerChannelNode->channelIdentification(), listenerEntityID, listenerChannelNode->channelIdentification());
+					auto const streamConnectionIndices = channelConnectionStreamPairs(talkerChannelNode, listenerChannelNode, listenerChannelConnections);
 
 					if (!streamConnectionIndices.empty())
 					{
@@ -2220,6 +3192,27 @@ public:
 		}
 	}
 
+	// Returns the stream pairs used by the connection of a talker channel to a listener channel
+	// Worker threads must pass the snapshot of connections they were given, as ChannelConnectionManager is not thread safe
+	static std::vector<avdecc::StreamIdentificationPair> channelConnectionStreamPairs(ChannelNode const* const talkerChannelNode, ChannelNode const* const listenerChannelNode, priv::ListenerChannelConnections const* const listenerChannelConnections)
+	{
+		auto const talkerEntityID = talkerChannelNode->entityID();
+		auto const listenerEntityID = listenerChannelNode->entityID();
+
+		if (listenerChannelConnections)
+		{
+			auto const it = listenerChannelConnections->find(listenerChannelNode);
+			if (it == std::end(*listenerChannelConnections) || !it->second)
+			{
+				return {};
+			}
+			return avdecc::getStreamIndexPairUsedByAudioChannelConnection(*it->second, talkerEntityID, talkerChannelNode->channelIdentification(), listenerEntityID, listenerChannelNode->channelIdentification());
+		}
+
+		auto& channelConnectionManager = avdecc::ChannelConnectionManager::getInstance();
+		return channelConnectionManager.getStreamIndexPairUsedByAudioChannelConnection(talkerEntityID, talkerChannelNode->channelIdentification(), listenerEntityID, listenerChannelNode->channelIdentification());
+	}
+
 	static bool isSameDomain(StreamNode const& lhs, StreamNode const& rhs) noexcept
 	{
 		return lhs.grandMasterID() == rhs.grandMasterID() && lhs.grandMasterDomain() == rhs.grandMasterDomain();
@@ -2265,20 +3258,14 @@ public:
 		}
 	}
 
-	static void updateWrongFormatFlag(Model::IntersectionData::Flags& flags, StreamNode const* const talkerStreamNode, StreamNode const* const listenerStreamNode) noexcept
+	// Returns the WrongFormat flags for the talker and listener formats (without using the cache)
+	static Model::IntersectionData::Flags computeWrongFormatFlags(la::avdecc::entity::model::StreamFormat const talkerStreamFormat, la::avdecc::entity::model::StreamFormat const listenerStreamFormat, la::avdecc::entity::model::StreamFormats const& listenerStreamFormats) noexcept
 	{
-		auto const talkerStreamFormat = talkerStreamNode->streamFormat();
-		auto const listenerStreamFormat = listenerStreamNode->streamFormat();
+		auto flags = Model::IntersectionData::Flags{};
 
-		if (la::avdecc::entity::model::StreamFormatInfo::isListenerFormatCompatibleWithTalkerFormat(listenerStreamFormat, talkerStreamFormat))
-		{
-			flags.reset(Model::IntersectionData::Flag::WrongFormatPossible);
-			flags.reset(Model::IntersectionData::Flag::WrongFormatImpossible);
-			flags.reset(Model::IntersectionData::Flag::WrongFormatType);
-		}
-		else
+		if (!la::avdecc::entity::model::StreamFormatInfo::isListenerFormatCompatibleWithTalkerFormat(listenerStreamFormat, talkerStreamFormat))
 		{
-			if (hasMatchingFormat(listenerStreamNode->streamFormats(), talkerStreamFormat))
+			if (hasMatchingFormat(listenerStreamFormats, talkerStreamFormat))
 			{
 				flags.set(Model::IntersectionData::Flag::WrongFormatPossible);
 			}
@@ -2291,9 +3278,28 @@ public:
 				}
 			}
 		}
+
+		return flags;
 	}
 
-	static Model::IntersectionData::Flags computeStreamIntersectionFlags(StreamNode const* const talkerStreamNode, StreamNode const* const listenerStreamNode) noexcept
+	void updateWrongFormatFlag(Model::IntersectionData::Flags& flags, StreamNode const* const talkerStreamNode, StreamNode const* const listenerStreamNode) const noexcept
+	{
+		auto const talkerStreamFormat = talkerStreamNode->streamFormat();
+		auto const listenerStreamFormat = listenerStreamNode->streamFormat();
+
+		auto const wrongFormatFlags = _streamFormatCompatibilityCache.get(listenerStreamNode, talkerStreamFormat, listenerStreamFormat,
+			[talkerStreamFormat, listenerStreamFormat, listenerStreamNode]()
+			{
+				return computeWrongFormatFlags(talkerStreamFormat, listenerStreamFormat, listenerStreamNode->streamFormats());
+			});
+
+		flags.reset(Model::IntersectionData::Flag::WrongFormatPossible);
+		flags.reset(Model::IntersectionData::Flag::WrongFormatImpossible);
+		flags.reset(Model::IntersectionData::Flag::WrongFormatType);
+		flags |= wrongFormatFlags;
+	}
+
+	Model::IntersectionData::Flags computeStreamIntersectionFlags(StreamNode const* const talkerStreamNode, StreamNode const* const listenerStreamNode) const noexcept
 	{
 		auto flags = Model::IntersectionData::Flags{};
 
@@ -2306,32 +3312,21 @@ public:
 
 	// Cache update helpers
 
-	void rebuildTalkerSectionCache()
-	{
-		Q_Q(Model);
-		emit q->indexesWillChange();
-
-		auto maps = priv::buildNodeSectionMaps(_talkerNodes);
-		_talkerNodeSectionMap = std::move(maps.first);
-		_talkerEntitySectionMap = std::move(maps.second);
-
-		emit q->indexesHaveChanged();
-	}
+	// Section index update helpers
 
-	void rebuildListenerSectionCache()
+	template<typename Updater>
+	void updateSectionIndex(Updater&& updater)
 	{
 		Q_Q(Model);
 		emit q->indexesWillChange();
 
-		auto maps = priv::buildNodeSectionMaps(_listenerNodes);
-		_listenerNodeSectionMap = std::move(maps.first);
-		_listenerEntitySectionMap = std::move(maps.second);
+		updater();
 
 		emit q->indexesHaveChanged();
 	}
 
 	// Build talker node hierarchy
-	EntityNode* buildTalkerNode(la::avdecc::controller::ControlledEntity const& controlledEntity, la::avdecc::UniqueIdentifier const& entityID, la::avdecc::controller::model::ConfigurationNode const& configurationNode)
+	EntityNode* buildTalkerNode(la::avdecc::controller::ControlledEntity const& controlledEntity, la::avdecc::UniqueIdentifier const& entityID, la::avdecc::controller::model::ConfigurationNode const& configurationNode) const
 	{
 		try
 		{
@@ -2469,7 +3464,7 @@ public:
 	}
 
 	// Build listener node hierarchy
-	EntityNode* buildListenerNode(la::avdecc::controller::ControlledEntity const& controlledEntity, la::avdecc::UniqueIdentifier const& entityID, la::avdecc::controller::model::ConfigurationNode const& configurationNode)
+	EntityNode* buildListenerNode(la::avdecc::controller::ControlledEntity const& controlledEntity, la::avdecc::UniqueIdentifier const& entityID, la::avdecc::controller::model::ConfigurationNode const& configurationNode) const
 	{
 		try
 		{
@@ -2611,79 +3606,96 @@ public:
 		}
 	}
 
-	void insertOfflineOutputStreamNode()
+	// Returns the flattened talker nodes to display for a node hierarchy, empty if it should not be displayed
+	priv::Nodes displayedTalkerNodes(Node* node) const
 	{
-		if (_mode == Model::Mode::Stream)
+		auto nodes = priv::flattenEntityNode(node, _mode);
+
+		// Do not display an EntityNode if it has no child
+		if (nodes.size() == 1u && node->type() == Node::Type::Entity)
 		{
-			insertTalkerNode(_offlineOutputStreamNode.get());
+			nodes.clear();
 		}
+
+		return nodes;
 	}
 
-	// Insert a talker node hierarchy in the model
-	template<class NodeType>
-	std::enable_if_t<std::is_same_v<NodeType, EntityNode> | std::is_same_v<NodeType, OfflineOutputStreamNode>> insertTalkerNode(NodeType* node)
+	// Returns the flattened listener nodes to display for a node hierarchy, empty if it should not be displayed
+	priv::Nodes displayedListenerNodes(Node* node) const
 	{
-		if (!AVDECC_ASSERT_WITH_RET(node, "Node should not be null"))
-		{
-			return;
-		}
+		return priv::flattenEntityNode(node, _mode);
+	}
 
-		auto const entityID = node->entityID();
-		auto const flattendedNodes = priv::flattenEntityNode(node, _mode);
-		auto const nodesCount = flattendedNodes.size();
+	// Adds talker nodes (root node first) to the cache, starting at first section. Model notifications are up to the caller
+	void addTalkerNodes(priv::Nodes const& nodes, int const first)
+	{
+		priv::insertNodes(_talkerNodes, nodes, first);
+		_talkerSectionIndex.insertBlock(nodes, first);
 
-		// Not a single node to display
-		if (nodesCount == 0)
+		if (nodes.front()->type() == Node::Type::Entity)
 		{
-			return;
+			// Compute everything for initial state (Start from the end so that children are initialized before parents)
+			for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+			{
+				computeHeaderData(*it, allHeaderDirtyFlagsTalker());
+			}
 		}
 
-		auto const childrenCount = static_cast<int>(nodesCount) - 1;
-		if constexpr (std::is_same_v<NodeType, EntityNode>)
+		// Intersections will be computed when first accessed
+		auto const generation = ++_computationGeneration;
+		for (auto const* const node : nodes)
 		{
-			// Do not display an EntityNode if it has no child
-			if (childrenCount == 0)
-			{
-				return;
-			}
+			_talkerComputations[node] = priv::NodeComputation{ generation };
 		}
+	}
 
-		auto const first = priv::sortedIndexForEntity(_talkerNodes, entityID);
-		auto const last = first + childrenCount;
+	// Adds listener nodes (root node first) to the cache, starting at first section. Model notifications are up to the caller
+	void addListenerNodes(priv::Nodes const& nodes, int const first)
+	{
+		priv::insertNodes(_listenerNodes, nodes, first);
+		_listenerSectionIndex.insertBlock(nodes, first);
 
-		beginInsertTalkerItems(first, last);
+		// Compute everything for initial state (Start from the end so that children are initialized before parents)
+		for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+		{
+			computeHeaderData(*it, allHeaderDirtyFlagsListener());
+		}
 
-		priv::insertNodes(_talkerNodes, flattendedNodes, first);
+		// Intersections will be computed when first accessed
+		auto const generation = ++_computationGeneration;
+		for (auto const* const node : nodes)
+		{
+			_listenerComputations[node] = priv::NodeComputation{ generation };
+		}
+	}
 
-		rebuildTalkerSectionCache();
+	// Insert a talker node hierarchy in the model
+	template<class NodeType>
+	std::enable_if_t<std::is_same_v<NodeType, EntityNode> | std::is_same_v<NodeType, OfflineOutputStreamNode>> insertTalkerNode(NodeType* node)
+	{
+		if (!AVDECC_ASSERT_WITH_RET(node, "Node should not be null"))
+		{
+			return;
+		}
 
-		// Insert new talker rows
-		auto const it = std::next(std::begin(_intersectionData), first);
-		_intersectionData.insert(it, childrenCount + 1, {});
+		auto const nodes = displayedTalkerNodes(node);
 
-		if constexpr (std::is_same_v<NodeType, EntityNode>)
+		// Not a single node to display
+		if (nodes.empty())
 		{
-			// Compute everything for initial state (Start from the end so that children are initialized before parents)
-			for (auto talkerSection = last; talkerSection >= first; --talkerSection)
-			{
-				auto* talker = _talkerNodes[talkerSection];
-				computeHeaderData(talker, allHeaderDirtyFlagsTalker());
-			}
+			return;
 		}
 
-		// Update intersection matrix (Start from the end so that children are initialized before parents)
-		for (auto talkerSection = last; talkerSection >= first; --talkerSection)
-		{
-			auto& row = _intersectionData[talkerSection];
-			row.resize(_listenerNodes.size());
+		auto const first = _talkerSectionIndex.sortedSectionForEntity(node->entityID());
+		auto const last = first + static_cast<int>(nodes.size()) - 1;
 
-			auto* talker = _talkerNodes[talkerSection];
-			for (auto listenerSection = _listenerNodes.size(); listenerSection > 0u; --listenerSection)
+		beginInsertTalkerItems(first, last);
+
+		updateSectionIndex(
+			[this, &nodes, first]()
 			{
-				auto* listener = _listenerNodes[listenerSection - 1];
-				initializeIntersectionData(talker, listener, row[listenerSection - 1]);
-			}
-		}
+				addTalkerNodes(nodes, first);
+			});
 
 #if ENABLE_CONNECTION_MATRIX_DEBUG
 		dump();
@@ -2700,49 +3712,24 @@ public:
 			return;
 		}
 
-		auto const entityID = node->entityID();
-		auto const flattendedNodes = priv::flattenEntityNode(node, _mode);
-		auto const nodesCount = flattendedNodes.size();
+		auto const nodes = displayedListenerNodes(node);
 
 		// Not a single node to display
-		if (nodesCount == 0)
+		if (nodes.empty())
 		{
 			return;
 		}
 
-		auto const childrenCount = static_cast<int>(nodesCount) - 1;
-		auto const first = priv::sortedIndexForEntity(_listenerNodes, entityID);
-		auto const last = first + childrenCount;
+		auto const first = _listenerSectionIndex.sortedSectionForEntity(node->entityID());
+		auto const last = first + static_cast<int>(nodes.size()) - 1;
 
 		beginInsertListenerItems(first, last);
 
-		priv::insertNodes(_listenerNodes, flattendedNodes, first);
-
-		rebuildListenerSectionCache();
-
-		// Compute everything for initial state (Start from the end so that children are initialized before parents)
-		for (auto listenerSection = last; listenerSection >= first; --listenerSection)
-		{
-			auto* listener = _listenerNodes[listenerSection];
-			computeHeaderData(listener, allHeaderDirtyFlagsListener());
-		}
-
-		// Update intersection matrix (Start from the end so that children are initialized before parents)
-		for (auto talkerSection = _talkerNodes.size(); talkerSection > 0u; --talkerSection)
-		{
-			auto& row = _intersectionData[talkerSection - 1];
-
-			// Insert new listener columns
-			auto const it = std::next(std::begin(row), first);
-			row.insert(it, childrenCount + 1, {});
-
-			auto* talker = _talkerNodes[talkerSection - 1];
-			for (auto listenerSection = last; listenerSection >= first; --listenerSection)
+		updateSectionIndex(
+			[this, &nodes, first]()
 			{
-				auto* listener = _listenerNodes[listenerSection];
-				initializeIntersectionData(talker, listener, row[listenerSection]);
-			}
-		}
+				addListenerNodes(nodes, first);
+			});
 
 #if ENABLE_CONNECTION_MATRIX_DEBUG
 		dump();
@@ -2762,16 +3749,24 @@ public:
 			return;
 		}
 
-		auto const first = priv::indexOf(_talkerNodeSectionMap, node);
+		auto const first = _talkerSectionIndex.sectionOf(node);
 		auto const last = first + childrenCount;
 
 		beginRemoveTalkerItems(first, last);
 
 		priv::removeNodes(_talkerNodes, first, last + 1 /* entity */);
 
-		rebuildTalkerSectionCache();
+		updateSectionIndex(
+			[this, &flattendedNodes]()
+			{
+				_talkerSectionIndex.removeBlock(flattendedNodes);
+			});
 
-		_intersectionData.erase(std::next(std::begin(_intersectionData), first), std::next(std::begin(_intersectionData), last + 1));
+		for (auto const* const talker : flattendedNodes)
+		{
+			_intersectionData.removeTalker(talker);
+		}
+		removeTalkersDirtyIntersections(flattendedNodes);
 
 #if ENABLE_CONNECTION_MATRIX_DEBUG
 		dump();
@@ -2791,21 +3786,24 @@ public:
 			return;
 		}
 
-		auto const first = priv::indexOf(_listenerNodeSectionMap, node);
+		auto const first = _listenerSectionIndex.sectionOf(node);
 		auto const last = first + childrenCount;
 
 		beginRemoveListenerItems(first, last);
 
 		priv::removeNodes(_listenerNodes, first, last + 1 /* entity */);
 
-		rebuildListenerSectionCache();
+		updateSectionIndex(
+			[this, &flattendedNodes]()
+			{
+				_listenerSectionIndex.removeBlock(flattendedNodes);
+			});
 
-		for (auto talkerSection = 0u; talkerSection < _talkerNodes.size(); ++talkerSection)
+		for (auto const* const listener : flattendedNodes)
 		{
-			auto& row = _intersectionData[talkerSection];
-
-			row.erase(std::next(std::begin(row), first), std::next(std::begin(row), last + 1));
+			_intersectionData.removeListener(listener);
 		}
+		removeListenersDirtyIntersections(flattendedNodes);
 
 #if ENABLE_CONNECTION_MATRIX_DEBUG
 		dump();
@@ -2843,8 +3841,11 @@ public:
 		resetModel();
 	}
 
-	void handleEntityOnline(la::avdecc::UniqueIdentifier const entityID)
+	// Builds the node hierarchies of an entity, without modifying the model (only reads the ControlledEntity, can be called from any thread)
+	priv::EntityNodes buildEntityNodes(la::avdecc::UniqueIdentifier const entityID) const
 	{
+		auto entityNodes = priv::EntityNodes{};
+
 		try
 		{
 			auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
@@ -2855,7 +3856,7 @@ public:
 
 				if (!entityCapabilities.test(la::avdecc::entity::EntityCapability::AemSupported) || !controlledEntity->hasAnyConfiguration())
 				{
-					return;
+					return entityNodes;
 				}
 
 				auto const& entityNode = controlledEntity->getEntityNode();
@@ -2864,52 +3865,153 @@ public:
 				// Talker
 				if (controlledEntity->getEntity().getTalkerCapabilities().test(la::avdecc::entity::TalkerCapability::Implemented) && !configurationNode.streamOutputs.empty())
 				{
-					if (auto* node = buildTalkerNode(*controlledEntity, entityID, configurationNode))
-					{
-						_talkerNodeMap.insert(std::make_pair(entityID, node));
-
-						priv::insertStreamNodes(_talkerStreamNodeMap, node);
-						priv::insertChannelNodes(_talkerChannelNodeMap, node);
-
-						insertTalkerNode(node);
-					}
+					entityNodes.talker.reset(buildTalkerNode(*controlledEntity, entityID, configurationNode));
 				}
 
 				// Listener
 				if (controlledEntity->getEntity().getListenerCapabilities().test(la::avdecc::entity::ListenerCapability::Implemented) && !configurationNode.streamInputs.empty())
 				{
-					if (auto* node = buildListenerNode(*controlledEntity, entityID, configurationNode))
-					{
-						// Insert nodes in cache for quick access
-						_listenerNodeMap.insert(std::make_pair(entityID, node));
+					entityNodes.listener.reset(buildListenerNode(*controlledEntity, entityID, configurationNode));
+				}
+			}
+		}
+		catch (la::avdecc::controller::ControlledEntity::Exception const&)
+		{
+			// Ignore exception
+		}
+		catch (...)
+		{
+			// Uncaught exception
+			AVDECC_ASSERT(false, "Uncaught exception");
+		}
 
-						priv::insertStreamNodes(_listenerStreamNodeMap, node);
-						priv::insertChannelNodes(_listenerChannelNodeMap, node);
+		return entityNodes;
+	}
 
-						insertListenerNode(node);
-					}
-				}
+	// Adds the node hierarchies of an entity to the persistent maps, inserting them in the model if insertInModel is set
+	void addEntityNodes(priv::EntityNodes entityNodes, bool const insertInModel)
+	{
+		// Talker
+		if (auto* node = entityNodes.talker.release())
+		{
+			_talkerNodeMap.insert(std::make_pair(node->entityID(), node));
+
+			priv::insertStreamNodes(_talkerStreamNodeMap, node);
+			priv::insertChannelNodes(_talkerChannelNodeMap, node);
+
+			if (insertInModel)
+			{
+				insertTalkerNode(node);
+			}
+		}
+
+		// Listener
+		if (auto* node = entityNodes.listener.release())
+		{
+			// Insert nodes in cache for quick access
+			_listenerNodeMap.insert(std::make_pair(node->entityID(), node));
+
+			priv::insertStreamNodes(_listenerStreamNodeMap, node);
+			priv::insertChannelNodes(_listenerChannelNodeMap, node);
+
+			node->accept<Node::StreamPolicy>(
+				[this](Node* node)
+				{
+					auto const* const streamNode = static_cast<StreamNode const*>(node);
+					updateEntityConnectedStreams(streamNode, streamNode->streamInputConnectionInformation(), true);
+				});
+
+			if (insertInModel)
+			{
+				insertListenerNode(node);
+			}
+		}
+	}
+
+	void handleEntityOnline(la::avdecc::UniqueIdentifier const entityID)
+	{
+		// Entities are inserted in batches, so that many entities coming online at the same time are inserted at once
+		if (_pendingOnlineEntities.insert(entityID).second)
+		{
+			_pendingOnlineEntitiesOrder.push_back(entityID);
+		}
+
+		if (!_isPendingOnlineEntitiesInsertionScheduled)
+		{
+			_isPendingOnlineEntitiesInsertionScheduled = true;
+			QMetaObject::invokeMethod(
+				this,
+				[this]()
+				{
+					insertPendingOnlineEntities();
+				},
+				Qt::QueuedConnection);
+		}
+	}
+
+	// Inserts all entities that came online since last call
+	// If they are numerous, their nodes are built on the global thread pool and the model is rebuilt at once instead of inserting them one by one
+	void insertPendingOnlineEntities()
+	{
+		Q_Q(Model);
+
+		_isPendingOnlineEntitiesInsertionScheduled = false;
+
+		auto const entities = std::move(_pendingOnlineEntitiesOrder);
+		_pendingOnlineEntitiesOrder.clear();
+		_pendingOnlineEntities.clear();
+
+		if (entities.empty())
+		{
+			return;
+		}
+
+		if (entities.size() >= BulkInsertionMinimumEntitiesCount)
+		{
+			// Only ControlledEntities are read while building, the model is not modified until all nodes are built
+			auto entitiesNodes = std::vector<priv::EntityNodes>(entities.size());
+			priv::runTasks(entities.size(),
+				[this, &entities, &entitiesNodes](std::size_t const entity)
+				{
+					entitiesNodes[entity] = buildEntityNodes(entities[entity]);
+				});
+
+			emit q->beginResetModel();
+			clearCachedData();
+
+			for (auto& entityNodes : entitiesNodes)
+			{
+				addEntityNodes(std::move(entityNodes), false);
 			}
 
-			// Trigger "special offline streams" intersection update
-			if (_mode == Model::Mode::Stream)
+			buildCachedData();
+			emit q->endResetModel();
+		}
+		else
+		{
+			// Few entities, sections are inserted one entity at a time
+			for (auto const& entityID : entities)
 			{
-				talkerIntersectionDataChanged(_offlineOutputStreamNode.get(), false, true, allIntersectionDirtyFlags());
+				addEntityNodes(buildEntityNodes(entityID), true);
 			}
 		}
-		catch (la::avdecc::controller::ControlledEntity::Exception const&)
-		{
-			// Ignore exception
-		}
-		catch (...)
+
+		// Trigger "special offline streams" intersection update
+		if (_mode == Model::Mode::Stream)
 		{
-			// Uncaught exception
-			AVDECC_ASSERT(false, "Uncaught exception");
+			talkerIntersectionDataChanged(_offlineOutputStreamNode.get(), false, true, allIntersectionDirtyFlags());
 		}
 	}
 
 	void handleEntityOffline(la::avdecc::UniqueIdentifier const entityID)
 	{
+		// Not inserted yet
+		if (_pendingOnlineEntities.erase(entityID) != 0u)
+		{
+			_pendingOnlineEntitiesOrder.erase(std::remove(std::begin(_pendingOnlineEntitiesOrder), std::end(_pendingOnlineEntitiesOrder), entityID), std::end(_pendingOnlineEntitiesOrder));
+			return;
+		}
+
 		if (auto* node = talkerNodeFromEntityID(entityID))
 		{
 			removeTalker(node);
@@ -2917,6 +4019,7 @@ public:
 			// Remove from cache
 			priv::removeStreamNodes(_talkerStreamNodeMap, node);
 			priv::removeChannelNodes(_talkerChannelNodeMap, node);
+			_talkerStreamChannelNodes.erase(entityID);
 			_talkerNodeMap.erase(entityID);
 		}
 
@@ -2925,8 +4028,15 @@ public:
 			removeListener(node);
 
 			// Remove from cache
+			node->accept<Node::StreamPolicy>(
+				[this](Node* node)
+				{
+					_streamFormatCompatibilityCache.invalidateListener(static_cast<StreamNode const*>(node));
+				});
 			priv::removeStreamNodes(_listenerStreamNodeMap, node);
 			priv::removeChannelNodes(_listenerChannelNodeMap, node);
+			_listenerStreamChannelNodes.erase(entityID);
+			_entityConnectedStreams.erase(entityID);
 			_listenerNodeMap.erase(entityID);
 		}
 
@@ -3110,6 +4220,7 @@ public:
 				if (auto* node = listenerStreamNode(entityID, streamIndex))
 				{
 					node->setStreamFormat(streamFormat);
+					_streamFormatCompatibilityCache.invalidateListener(node);
 
 					if (_mode == Model::Mode::Stream)
 					{
@@ -3172,7 +4283,9 @@ public:
 		{
 			if (auto* node = listenerStreamNode(entityID, stream.streamIndex))
 			{
+				updateEntityConnectedStreams(node, node->streamInputConnectionInformation(), false);
 				node->setStreamInputConnectionInformation(info);
+				updateEntityConnectedStreams(node, info, true);
 
 				// First update header data, intersection might read it
 				listenerHeaderDataChanged(node, true, HeaderDirtyFlags{ HeaderDirtyFlag::UpdateLockedState });
@@ -3430,6 +4543,7 @@ public:
 					{
 						// Save current mappings (we want all mappings, including redundant)
 						talker->setOutputAudioMappings(streamPortIndex, controlledEntity->getStreamPortOutputAudioMappings(streamPortIndex));
+						_talkerStreamChannelNodes.erase(entityID);
 						// No need to trigger a refresh here, the same event is already handled by ChannelConnectionManager
 					}
 				}
@@ -3439,6 +4553,7 @@ public:
 					{
 						// Save current mappings (we want all mappings, including redundant)
 						listener->setInputAudioMappings(streamPortIndex, controlledEntity->getStreamPortInputAudioMappings(streamPortIndex));
+						_listenerStreamChannelNodes.erase(entityID);
 						// No need to trigger a refresh here, the same event is already handled by ChannelConnectionManager
 					}
 				}
@@ -3598,65 +4713,95 @@ public:
 private:
 	void updateTalkerIntersectionChannels(la::avdecc::UniqueIdentifier const entityID, IntersectionDirtyFlags const dirtyFlags, EntityNode* const talker, StreamNode* const node)
 	{
-		auto const& mappings = talker->getOutputAudioMappings();
-		for (auto const& [streamPortIndex, audioUnitMappings] : mappings)
+		for (auto* const channelNode : talkerStreamChannelNodes(entityID, talker, node->streamIndex()))
 		{
-			auto const clusterOffset = talker->getStreamPortOutputClusterOffset(streamPortIndex);
-
-			// One stream can have multiple Channels
-			for (auto const& mapping : audioUnitMappings)
-			{
-				if (mapping.streamIndex == node->streamIndex())
-				{
-					if (auto* channelNode = talkerChannelNode(entityID, clusterOffset + mapping.clusterOffset))
-					{
-						talkerIntersectionDataChanged(channelNode, true, false, dirtyFlags);
-						qDebug() << "updateTalkerIntersectionChannels: Update Channel #" << (clusterOffset + mapping.clusterOffset);
-					}
-				}
-			}
+			talkerIntersectionDataChanged(channelNode, true, false, dirtyFlags);
+			qDebug() << "updateTalkerIntersectionChannels: Update Channel #" << channelNode->clusterIndex();
 		}
 	}
 
 	void updateListenerIntersectionChannels(la::avdecc::UniqueIdentifier const entityID, IntersectionDirtyFlags const dirtyFlags, EntityNode* const listener, StreamNode* const node)
 	{
-		auto const& mappings = listener->getInputAudioMappings();
-		for (auto const& [streamPortIndex, audioUnitMappings] : mappings)
+		for (auto* const channelNode : listenerStreamChannelNodes(entityID, listener, node->streamIndex()))
 		{
-			auto const clusterOffset = listener->getStreamPortInputClusterOffset(streamPortIndex);
+			listenerIntersectionDataChanged(channelNode, true, false, dirtyFlags);
+			qDebug() << "updateListenerIntersectionChannels: Update Channel #" << channelNode->clusterIndex();
+		}
+	}
 
-			// One stream can have multiple Channels
-			for (auto const& mapping : audioUnitMappings)
-			{
-				if (mapping.streamIndex == node->streamIndex())
+	// Returns the talker channel nodes using a stream, the index of the entity is built on first access after its audio mappings changed
+	priv::ChannelNodes const& talkerStreamChannelNodes(la::avdecc::UniqueIdentifier const entityID, EntityNode* const talker, la::avdecc::entity::model::StreamIndex const streamIndex)
+	{
+		auto entityIt = _talkerStreamChannelNodes.find(entityID);
+		if (entityIt == std::end(_talkerStreamChannelNodes))
+		{
+			auto streamChannelNodes = priv::buildStreamChannelNodes(
+				talker->getOutputAudioMappings(),
+				[talker](auto const streamPortIndex)
 				{
-					if (auto* channelNode = listenerChannelNode(entityID, clusterOffset + mapping.clusterOffset))
-					{
-						listenerIntersectionDataChanged(channelNode, true, false, dirtyFlags);
-						qDebug() << "updateListenerIntersectionChannels: Update Channel #" << (clusterOffset + mapping.clusterOffset);
-					}
-				}
-			}
+					return talker->getStreamPortOutputClusterOffset(streamPortIndex);
+				},
+				[this, entityID](auto const clusterIndex)
+				{
+					return talkerChannelNode(entityID, clusterIndex);
+				});
+			entityIt = _talkerStreamChannelNodes.emplace(entityID, std::move(streamChannelNodes)).first;
+		}
+
+		return streamChannelNodesOf(entityIt->second, streamIndex);
+	}
+
+	// Returns the listener channel nodes using a stream, the index of the entity is built on first access after its audio mappings changed
+	priv::ChannelNodes const& listenerStreamChannelNodes(la::avdecc::UniqueIdentifier const entityID, EntityNode* const listener, la::avdecc::entity::model::StreamIndex const streamIndex)
+	{
+		auto entityIt = _listenerStreamChannelNodes.find(entityID);
+		if (entityIt == std::end(_listenerStreamChannelNodes))
+		{
+			auto streamChannelNodes = priv::buildStreamChannelNodes(
+				listener->getInputAudioMappings(),
+				[listener](auto const streamPortIndex)
+				{
+					return listener->getStreamPortInputClusterOffset(streamPortIndex);
+				},
+				[this, entityID](auto const clusterIndex)
+				{
+					return listenerChannelNode(entityID, clusterIndex);
+				});
+			entityIt = _listenerStreamChannelNodes.emplace(entityID, std::move(streamChannelNodes)).first;
+		}
+
+		return streamChannelNodesOf(entityIt->second, streamIndex);
+	}
+
+	static priv::ChannelNodes const& streamChannelNodesOf(priv::StreamChannelNodes const& streamChannelNodes, la::avdecc::entity::model::StreamIndex const streamIndex)
+	{
+		static auto const s_noChannelNodes = priv::ChannelNodes{};
+
+		auto const it = streamChannelNodes.find(streamIndex);
+		if (it == std::end(streamChannelNodes))
+		{
+			return s_noChannelNodes;
 		}
+		return it->second;
 	}
 
 	// Returns talker section for node
 	int talkerNodeSection(Node* const node) const
 	{
-		return priv::indexOf(_talkerNodeSectionMap, node);
+		return _talkerSectionIndex.sectionOf(node);
 	}
 
 	// Returns listener section for node
 	int listenerNodeSection(Node* const node) const
 	{
-		return priv::indexOf(_listenerNodeSectionMap, node);
+		return _listenerSectionIndex.sectionOf(node);
 	}
 
 	// Returns ModelIndex for given entityID
 	QModelIndex indexOf(la::avdecc::UniqueIdentifier const& entityID) const noexcept
 	{
-		auto const talkerSectionIndex = priv::indexOf(_talkerEntitySectionMap, entityID);
-		auto const listenerSectionIndex = priv::indexOf(_listenerEntitySectionMap, entityID);
+		auto const talkerSectionIndex = _talkerSectionIndex.sectionOf(entityID);
+		auto const listenerSectionIndex = _listenerSectionIndex.sectionOf(entityID);
 
 		return createIndex(talkerSectionIndex, listenerSectionIndex);
 	}
@@ -3755,7 +4900,120 @@ private:
 		return it->second;
 	}
 
+	// Returns the connections between a talker and a listener entity, from the connection state of the listener streams (an invalid talkerEntityID stands for the offline talkers)
+	Model::EntityConnections entityConnections(la::avdecc::UniqueIdentifier const& talkerEntityID, la::avdecc::UniqueIdentifier const& listenerEntityID) const noexcept
+	{
+		auto connections = Model::EntityConnections{};
+
+		auto const listenerIt = _entityConnectedStreams.find(listenerEntityID);
+		if (listenerIt == std::end(_entityConnectedStreams))
+		{
+			return connections;
+		}
+
+		auto const addStreams = [this, &connections](std::vector<StreamNode const*> const& listenerStreamNodes)
+		{
+			for (auto const* const listenerStreamNode : listenerStreamNodes)
+			{
+				++connections.connectedCount;
+				if (hasConnectionError(*listenerStreamNode))
+				{
+					++connections.errorsCount;
+				}
+			}
+		};
+
+		if (talkerEntityID.isValid())
+		{
+			if (auto const talkerIt = listenerIt->second.find(talkerEntityID); talkerIt != std::end(listenerIt->second))
+			{
+				addStreams(talkerIt->second);
+			}
+		}
+		else
+		{
+			for (auto const& [connectedTalkerEntityID, listenerStreamNodes] : listenerIt->second)
+			{
+				if (_talkerNodeMap.count(connectedTalkerEntityID) == 0u)
+				{
+					addStreams(listenerStreamNodes);
+				}
+			}
+		}
+
+		return connections;
+	}
+
 private:
+	// Adds (or removes) a listener stream node to the connected streams of its entity, if info is a connection to a talker stream
+	void updateEntityConnectedStreams(StreamNode const* const listenerStreamNode, la::avdecc::entity::model::StreamInputConnectionInfo const& info, bool const isConnected)
+	{
+		if (info.state != la::avdecc::entity::model::StreamInputConnectionInfo::State::Connected && info.state != la::avdecc::entity::model::StreamInputConnectionInfo::State::FastConnecting)
+		{
+			return;
+		}
+
+		auto const& listenerEntityID = listenerStreamNode->entityID();
+		auto const& talkerEntityID = info.talkerStream.entityID;
+
+		if (isConnected)
+		{
+			_entityConnectedStreams[listenerEntityID][talkerEntityID].push_back(listenerStreamNode);
+			return;
+		}
+
+		auto const listenerIt = _entityConnectedStreams.find(listenerEntityID);
+		if (listenerIt == std::end(_entityConnectedStreams))
+		{
+			return;
+		}
+
+		auto& talkers = listenerIt->second;
+		auto const talkerIt = talkers.find(talkerEntityID);
+		if (talkerIt == std::end(talkers))
+		{
+			return;
+		}
+
+		auto& listenerStreamNodes = talkerIt->second;
+		listenerStreamNodes.erase(std::remove(std::begin(listenerStreamNodes), std::end(listenerStreamNodes), listenerStreamNode), std::end(listenerStreamNodes));
+		if (listenerStreamNodes.empty())
+		{
+			talkers.erase(talkerIt);
+			if (talkers.empty())
+			{
+				_entityConnectedStreams.erase(listenerIt);
+			}
+		}
+	}
+
+	// Returns true if the connection of the listener stream (connected or fast connecting) has an error
+	// Flags are computed by the helpers used for stream intersections, but redundant pairs are not considered (their InterfaceDown flag depends on the other stream of the pair)
+	bool hasConnectionError(StreamNode const& listenerStreamNode) const noexcept
+	{
+		auto flags = Model::IntersectionData::Flags{};
+
+		// Its stream intersection is Connected
+		if (listenerStreamNode.isLatencyError())
+		{
+			flags.set(Model::IntersectionData::Flag::LatencyError);
+		}
+
+		// Nothing to compare against if the talker is offline
+		auto const& info = listenerStreamNode.streamInputConnectionInformation();
+		auto const it = _talkerStreamNodeMap.find(std::make_pair(info.talkerStream.entityID, info.talkerStream.streamIndex));
+		if (it != std::end(_talkerStreamNodeMap))
+		{
+			flags |= computeStreamIntersectionFlags(it->second, &listenerStreamNode);
+		}
+
+		return std::any_of(std::begin(priv::SummaryAggregatedFlags), std::end(priv::SummaryAggregatedFlags),
+			[&flags](auto const flag)
+			{
+				return flags.test(flag);
+			});
+	}
+
 	// Returns intersection model index for talkerSection and listenerSection (automatically transposed if required)
 	QModelIndex createIndex(int const talkerSection, int const listenerSection) const
 	{
@@ -3771,17 +5029,107 @@ private:
 		}
 	}
 
-	// Recomputes (according to dirtyFlags) intersection data for talkerSection and listenerSection and notifies that it has changed
-	void intersectionDataChanged(int const talkerSection, int const listenerSection, IntersectionDirtyFlags const dirtyFlags)
+	// Notifies all intersections changed since last notification, coalesced into as few rectangular ranges as possible
+	void notifyChangedIntersections()
 	{
 		Q_Q(Model);
 
-		auto& data = _intersectionData[talkerSection][listenerSection];
+		_isChangedIntersectionsNotificationScheduled = false;
+
+		if (_changedIntersections.empty())
+		{
+			return;
+		}
+
+		// Group changed listener sections by talker section
+		auto changedSections = std::map<int, std::vector<int>>{};
+		_changedIntersections.forEach(
+			[this, &changedSections](Node const* const talker, Node const* const listener, bool const /*changed*/)
+			{
+				auto const talkerSection = _talkerSectionIndex.sectionOf(talker);
+				auto const listenerSection = _listenerSectionIndex.sectionOf(listener);
+				if (isValidTalkerSection(talkerSection) && isValidListenerSection(listenerSection))
+				{
+					changedSections[talkerSection].push_back(listenerSection);
+				}
+			});
+		_changedIntersections.clear();
+
+		// Contiguous listener sections ranges
+		using Ranges = std::vector<std::pair<int, int>>;
 
-		computeIntersectionData(data, dirtyFlags);
+		auto const notifyRanges = [this, q](int const firstTalkerSection, int const lastTalkerSection, Ranges const& ranges)
+		{
+			for (auto const& [firstListenerSection, lastListenerSection] : ranges)
+			{
+				emit q->dataChanged(createIndex(firstTalkerSection, firstListenerSection), createIndex(lastTalkerSection, lastListenerSection));
+			}
+		};
+
+		// Build listener ranges for each talker, merging adjacent talkers having the same ranges
+		auto firstTalkerSection = -1;
+		auto lastTalkerSection = -1;
+		auto ranges = Ranges{};
+		for (auto& [talkerSection, listenerSections] : changedSections)
+		{
+			std::sort(std::begin(listenerSections), std::end(listenerSections));
+
+			auto talkerRanges = Ranges{};
+			for (auto const listenerSection : listenerSections)
+			{
+				if (!talkerRanges.empty() && talkerRanges.back().second + 1 == listenerSection)
+				{
+					talkerRanges.back().second = listenerSection;
+				}
+				else
+				{
+					talkerRanges.emplace_back(listenerSection, listenerSection);
+				}
+			}
+
+			if (talkerSection == lastTalkerSection + 1 && talkerRanges == ranges)
+			{
+				lastTalkerSection = talkerSection;
+				continue;
+			}
+
+			if (firstTalkerSection != -1)
+			{
+				notifyRanges(firstTalkerSection, lastTalkerSection, ranges);
+			}
+			firstTalkerSection = talkerSection;
+			lastTalkerSection = talkerSection;
+			ranges = std::move(talkerRanges);
+		}
+
+		if (firstTalkerSection != -1)
+		{
+			notifyRanges(firstTalkerSection, lastTalkerSection, ranges);
+		}
+	}
+
+	// Marks intersection data for talkerSection and listenerSection as dirty (according to dirtyFlags) and notifies that it has changed
+	// Intersection data is recomputed the next time it's accessed
+	void intersectionDataChanged(int const talkerSection, int const listenerSection, IntersectionDirtyFlags const dirtyFlags)
+	{
+		auto const* const talker = _talkerNodes[talkerSection];
+		auto const* const listener = _listenerNodes[listenerSection];
 
-		auto const index = createIndex(talkerSection, listenerSection);
-		emit q->dataChanged(index, index);
+		addIntersectionDirtyFlags(talker, listener, dirtyFlags);
+
+		// Notification is delayed so that all intersections changed by the same handler are notified at once
+		_changedIntersections.value(talker, listener) = true;
+		if (!_isChangedIntersectionsNotificationScheduled)
+		{
+			_isChangedIntersectionsNotificationScheduled = true;
+			QMetaObject::invokeMethod(
+				this,
+				[this]()
+				{
+					notifyChangedIntersections();
+				},
+				Qt::QueuedConnection);
+		}
 
 #if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
 		highlightIntersection(talkerSection, listenerSection);
@@ -4047,32 +5395,155 @@ private:
 
 		_talkerNodes.clear();
 		_listenerNodes.clear();
-		_talkerNodeSectionMap.clear();
-		_listenerNodeSectionMap.clear();
+		_talkerSectionIndex.clear();
+		_listenerSectionIndex.clear();
 		_intersectionData.clear();
+		_talkerComputations.clear();
+		_listenerComputations.clear();
+		_precomputedTalkers.clear();
+		_precomputedListeners.clear();
+		_intersectionDirtyFlags.clear();
+		_summaryAggregates.clear();
+		_changedIntersections.clear();
 	}
 
+	// Builds the cache data for all known entities at once (must be called while the model is being reset)
 	void buildCachedData()
 	{
 		Q_Q(Model);
 
-		// Special Offline Output Stream node
-		insertOfflineOutputStreamNode();
+		// Entities are sorted by EntityID, the special Offline Output Stream node being sorted as any other node
+		auto const sortedNodes = [](priv::Nodes& nodes)
+		{
+			std::stable_sort(std::begin(nodes), std::end(nodes),
+				[](Node const* const lhs, Node const* const rhs)
+				{
+					return rhs->entityID() > lhs->entityID();
+				});
+		};
 
-		// Rebuild the cache data for all known entities
+		auto talkers = priv::Nodes{};
+		if (_mode == Model::Mode::Stream)
+		{
+			talkers.push_back(_offlineOutputStreamNode.get());
+		}
 		for (auto const& [entityID, entityNode] : _talkerNodeMap)
 		{
-			insertTalkerNode(entityNode.get());
+			talkers.push_back(entityNode.get());
 		}
+		sortedNodes(talkers);
 
+		for (auto* const talker : talkers)
+		{
+			auto const nodes = displayedTalkerNodes(talker);
+			if (!nodes.empty())
+			{
+				addTalkerNodes(nodes, talkerSectionCount());
+			}
+		}
+
+		auto listeners = priv::Nodes{};
 		for (auto const& [entityID, entityNode] : _listenerNodeMap)
 		{
-			insertListenerNode(entityNode.get());
+			listeners.push_back(entityNode.get());
+		}
+		sortedNodes(listeners);
+
+		for (auto* const listener : listeners)
+		{
+			auto const nodes = displayedListenerNodes(listener);
+			if (!nodes.empty())
+			{
+				addListenerNodes(nodes, listenerSectionCount());
+			}
 		}
 
+		precomputeIntersectionData();
+
+#if ENABLE_CONNECTION_MATRIX_DEBUG
+		dump();
+#endif
+
 		emit q->indexesHaveChanged();
 	}
 
+	// Computes the stream and channel intersections of the whole matrix on the calling thread and idle threads of the global pool, then stores them all at once (must be called while the model is being reset)
+	// The calling thread still waits for all of them: this only shortens the rebuild, it's not moved off the calling thread
+	// Summaries are not computed here, they are computed from their children when accessed
+	void precomputeIntersectionData()
+	{
+		auto const talkersCount = _talkerNodes.size();
+		auto const listenersCount = _listenerNodes.size();
+		if (talkersCount * listenersCount < ParallelComputationMinimumIntersectionsCount)
+		{
+			return;
+		}
+
+		// ChannelConnectionManager is not thread safe, take a snapshot of the connections of all listener channels for the workers
+		auto listenerChannelConnections = priv::ListenerChannelConnections{};
+		if (_mode == Model::Mode::Channel)
+		{
+			auto& channelConnectionManager = avdecc::ChannelConnectionManager::getInstance();
+			for (auto const* const listener : _listenerNodes)
+			{
+				if (listener->type() == Node::Type::InputChannel)
+				{
+					auto const* const listenerChannelNode = static_cast<ChannelNode const*>(listener);
+					listenerChannelConnections.emplace(listener, channelConnectionManager.getChannelConnectionsReverse(listener->entityID(), listenerChannelNode->channelIdentification()));
+				}
+			}
+		}
+
+		auto const blocksCount = (talkersCount + ParallelComputationTalkersBlockSize - 1u) / ParallelComputationTalkersBlockSize;
+		auto blocksIntersectionData = std::vector<std::vector<Model::IntersectionData>>(blocksCount);
+		auto const dirtyFlags = allIntersectionDirtyFlags();
+
+		// Workers only read nodes state and write into their own block, cached data is not modified until they are all done
+		priv::runTasks(blocksCount,
+			[this, talkersCount, listenersCount, dirtyFlags, &listenerChannelConnections, &blocksIntersectionData](std::size_t const block)
+			{
+				auto& blockIntersectionData = blocksIntersectionData[block];
+				auto const endTalkerSection = std::min(talkersCount, (block + 1u) * ParallelComputationTalkersBlockSize);
+
+				for (auto talkerSection = block * ParallelComputationTalkersBlockSize; talkerSection < endTalkerSection; ++talkerSection)
+				{
+					auto* const talker = _talkerNodes[talkerSection];
+
+					for (auto listenerSection = std::size_t{ 0u }; listenerSection < listenersCount; ++listenerSection)
+					{
+						auto* const listener = _listenerNodes[listenerSection];
+
+						auto intersectionData = Model::IntersectionData{};
+						intersectionData.type = determineIntersectionType(talker, listener);
+						if (!isParallelComputableIntersectionType(intersectionData.type))
+						{
+							continue;
+						}
+						intersectionData.talker = talker;
+						intersectionData.listener = listener;
+
+						computeIntersectionData(intersectionData, dirtyFlags, &listenerChannelConnections);
+
+						if (!priv::isDefaultIntersectionData(intersectionData))
+						{
+							blockIntersectionData.push_back(std::move(intersectionData));
+						}
+					}
+				}
+			});
+
+		// Store all computed intersections
+		for (auto& blockIntersectionData : blocksIntersectionData)
+		{
+			for (auto& intersectionData : blockIntersectionData)
+			{
+				_intersectionData.update(std::move(intersectionData));
+			}
+		}
+		_precomputedTalkers.insert(std::begin(_talkerNodes), std::end(_talkerNodes));
+		_precomputedListeners.insert(std::begin(_listenerNodes), std::end(_listenerNodes));
+	}
+
 	void resetModel()
 	{
 		Q_Q(Model);
@@ -4088,11 +5559,20 @@ private:
 		_talkerChannelNodeMap.clear();
 		_listenerChannelNodeMap.clear();
 
-		clearCachedData();
+		_talkerStreamChannelNodes.clear();
+		_listenerStreamChannelNodes.clear();
 
-		emit q->endResetModel();
+		_entityConnectedStreams.clear();
+
+		_pendingOnlineEntities.clear();
+		_pendingOnlineEntitiesOrder.clear();
+
+		_streamFormatCompatibilityCache.clear();
 
+		clearCachedData();
 		buildCachedData();
+
+		emit q->endResetModel();
 	}
 
 private:
@@ -4109,6 +5589,14 @@ private:
 	priv::NodeMap _talkerNodeMap;
 	priv::NodeMap _listenerNodeMap;
 
+	// Entities online but not inserted yet (in arrival order)
+	std::unordered_set<la::avdecc::UniqueIdentifier, la::avdecc::UniqueIdentifier::hash> _pendingOnlineEntities;
+	std::vector<la::avdecc::UniqueIdentifier> _pendingOnlineEntitiesOrder;
+	bool _isPendingOnlineEntitiesInsertionScheduled{ false };
+
+	// Format compatibility verdicts by listener stream node (persistent, thread safe)
+	mutable priv::StreamFormatCompatibilityCache _streamFormatCompatibilityCache;
+
 	// Stream nodes by StreamKey
 	priv::StreamNodeMap _talkerStreamNodeMap;
 	priv::StreamNodeMap _listenerStreamNodeMap;
@@ -4117,18 +5605,42 @@ private:
 	priv::ChannelNodeMap _talkerChannelNodeMap;
 	priv::ChannelNodeMap _listenerChannelNodeMap;
 
+	// Channel nodes using each stream, by entityID (built on first access)
+	priv::StreamChannelNodesMap _talkerStreamChannelNodes;
+	priv::StreamChannelNodesMap _listenerStreamChannelNodes;
+
+	// Connected listener stream nodes, by listener then talker entityID (persistent)
+	priv::EntityConnectedStreamsMap _entityConnectedStreams;
+
 	// Flattened nodes (cache)
 	priv::Nodes _talkerNodes;
 	priv::Nodes _listenerNodes;
 
-	// Node section quick access map (cache)
-	priv::NodeSectionMap _talkerNodeSectionMap;
-	priv::EntitySectionMap _talkerEntitySectionMap;
-	priv::NodeSectionMap _listenerNodeSectionMap;
-	priv::EntitySectionMap _listenerEntitySectionMap;
+	// Node section quick access index (cache)
+	priv::SectionIndex _talkerSectionIndex;
+	priv::SectionIndex _listenerSectionIndex;
+
+	// Sparse intersection data matrix, only intersections not in their default state are stored (cache)
+	priv::IntersectionDataStore _intersectionData;
 
-	// Talker major intersection data matrix (cache)
-	std::deque<std::deque<Model::IntersectionData>> _intersectionData;
+	// Lazy intersection computation state of displayed nodes, intersections are computed by row or column when first accessed (cache)
+	priv::NodeComputationMap _talkerComputations;
+	priv::NodeComputationMap _listenerComputations;
+	std::uint64_t _computationGeneration{ 0u };
+
+	// Nodes known during the last full rebuild, their parallel computable intersections have been computed at once (cache)
+	priv::NodeSet _precomputedTalkers;
+	priv::NodeSet _precomputedListeners;
+
+	// Dirty flags not yet applied to computed intersections (cache)
+	priv::IntersectionMap<IntersectionDirtyFlags> _intersectionDirtyFlags;
+
+	// Aggregated children of Entity summary intersections accessed at least once (cache)
+	priv::IntersectionMap<priv::SummaryAggregates> _summaryAggregates;
+
+	// Intersections changed since last dataChanged notification
+	priv::IntersectionMap<bool> _changedIntersections;
+	bool _isChangedIntersectionsNotificationScheduled{ false };
 };
 
 Model::Model(QObject* parent)
@@ -4281,27 +5793,27 @@ int Model::section(Node* node, Qt::Orientation orientation) const
 	{
 		if (orientation == Qt::Vertical)
 		{
-			return priv::indexOf(d->_talkerNodeSectionMap, node);
+			return d->_talkerSectionIndex.sectionOf(node);
 		}
 		else
 		{
-			return priv::indexOf(d->_listenerNodeSectionMap, node);
+			return d->_listenerSectionIndex.sectionOf(node);
 		}
 	}
 	else
 	{
 		if (orientation == Qt::Vertical)
 		{
-			return priv::indexOf(d->_listenerNodeSectionMap, node);
+			return d->_listenerSectionIndex.sectionOf(node);
 		}
 		else
 		{
-			return priv::indexOf(d->_talkerNodeSectionMap, node);
+			return d->_talkerSectionIndex.sectionOf(node);
 		}
 	}
 }
 
-Model::IntersectionData const& Model::intersectionData(QModelIndex const& index) const
+Model::IntersectionData Model::intersectionData(QModelIndex const& index) const
 {
 	Q_D(const Model);
 
@@ -4310,11 +5822,29 @@ Model::IntersectionData const& Model::intersectionData(QModelIndex const& index)
 
 	if (!AVDECC_ASSERT_WITH_RET(d->isValidTalkerSection(talkerSection), "invalid talker section") || !AVDECC_ASSERT_WITH_RET(d->isValidListenerSection(listenerSection), "invalid listener section"))
 	{
-		static auto const s_dummyData = Model::IntersectionData{};
-		return s_dummyData;
+		return {};
+	}
+
+	// Intersection data is lazily computed on access
+	auto* const p = const_cast<ModelPrivate*>(d);
+	return p->intersectionDataAt(talkerSection, listenerSection);
+}
+
+Model::IntersectionData Model::compactIntersectionData(int const row, int const column) const
+{
+	Q_D(const Model);
+
+	auto const talkerSection = !d->_transposed ? row : column;
+	auto const listenerSection = !d->_transposed ? column : row;
+
+	if (!AVDECC_ASSERT_WITH_RET(d->isValidTalkerSection(talkerSection), "invalid talker section") || !AVDECC_ASSERT_WITH_RET(d->isValidListenerSection(listenerSection), "invalid listener section"))
+	{
+		return {};
 	}
 
-	return d->_intersectionData[talkerSection][listenerSection];
+	// Intersection data is lazily computed on access
+	auto* const p = const_cast<ModelPrivate*>(d);
+	return p->compactIntersectionDataAt(talkerSection, listenerSection);
 }
 
 void Model::setMode(Mode const mode)
@@ -4327,10 +5857,9 @@ void Model::setMode(Mode const mode)
 
 		d->_mode = mode;
 		d->clearCachedData();
+		d->buildCachedData();
 
 		emit endResetModel();
-
-		d->buildCachedData();
 	}
 }
 
@@ -4400,6 +5929,12 @@ bool Model::hasListenerCluster(la::avdecc::UniqueIdentifier const& entityID, la:
 	return d->hasListenerCluster(entityID, audioClusterIndex);
 }
 
+Model::EntityConnections Model::entityConnections(la::avdecc::UniqueIdentifier const& talkerEntityID, la::avdecc::UniqueIdentifier const& listenerEntityID) const noexcept
+{
+	Q_D(const Model);
+	return d->entityConnections(talkerEntityID, listenerEntityID);
+}
+
 void Model::setTransposed(bool const transposed)
 {
 	Q_D(Model);
@@ -4410,10 +5945,9 @@ void Model::setTransposed(bool const transposed)
 
 		d->_transposed = transposed;
 		d->clearCachedData();
+		d->buildCachedData();
 
 		emit endResetModel();
-
-		d->buildCachedData();
 	}
 }
 
@@ -169,7 +169,7 @@ public:
 	int section(Node* node, Qt::Orientation orientation) const;
 
 	// Returns intersection data for the given index
-	IntersectionData const& intersectionData(QModelIndex const& index) const;
+	IntersectionData intersectionData(QModelIndex const& index) const;
 
 	// Set the model mode
 	void setMode(Mode const mode);
@@ -205,6 +205,16 @@ public:
 
 	bool hasListenerCluster(la::avdecc::UniqueIdentifier const& entityID, la::avdecc::entity::model::ClusterIndex const& audioClusterIndex) const noexcept;
 
+	// Connections between a talker and a listener entity, known from the listener streams (no intersection data is computed)
+	struct EntityConnections
+	{
+		std::size_t connectedCount{ 0u }; /**< Listener streams connected (or fast connecting) to a stream of the talker */
+		std::size_t errorsCount{ 0u }; /**< Connected listener streams having an interface, domain, format or latency error */
+	};
+
+	// Returns the connections between talkerEntityID and listenerEntityID (an invalid talkerEntityID returns the connections to offline talkers)
+	EntityConnections entityConnections(la::avdecc::UniqueIdentifier const& talkerEntityID, la::avdecc::UniqueIdentifier const& listenerEntityID) const noexcept;
+
 	// Set the transpose state of the model (default false, rows = talkers, columns = listeners)
 	void setTransposed(bool const transposed);
 
@@ -223,6 +233,12 @@ public:
 	Q_SIGNAL void indexesHaveChanged();
 
 private:
+	// Returns type, state and flags of intersection data at row/column (automatically transposed if required), without smart connectable streams nor talker/listener
+	// Only meant for the rendering of the view, which draws intersections without going through QModelIndex
+	IntersectionData compactIntersectionData(int const row, int const column) const;
+
+	friend class View;
+
 	QScopedPointer<ModelPrivate> d_ptr;
 	Q_DECLARE_PRIVATE(Model)
 };
@@ -289,6 +289,11 @@ QPainterPath buildHeaderArrowPath(QRect const& rect, Qt::Orientation const orien
 	return path;
 }
 
+static inline bool isIncompatibleFormatTypeHidden(Model::IntersectionData::State const state, Model::IntersectionData::Flags const& flags, bool const drawCRFAudioConnections) noexcept
+{
+	return !drawCRFAudioConnections && flags.test(Model::IntersectionData::Flag::WrongFormatType) && state == Model::IntersectionData::State::NotConnected;
+}
+
 void drawCapabilities(QPainter* painter, QRect const& rect, Model::IntersectionData::Type const type, Model::IntersectionData::State const state, Model::IntersectionData::Flags const& flags, bool const drawMediaLockedDot, bool const drawCRFAudioConnections, bool const drawEntitySummary)
 {
 	painter->setRenderHint(QPainter::Antialiasing);
@@ -299,12 +304,6 @@ void drawCapabilities(QPainter* painter, QRect const& rect, Model::IntersectionD
 	auto penWidth = qreal{ 1.5 };
 	auto wrongFormatHasPriorityOverInterfaceDown = false;
 
-	auto const drawInvalidIntersection = [painter, &rect]()
-	{
-		auto brush = qtMate::material::color::brush(qtMate::material::color::Name::Gray, qtMate::material::color::isDarkColorScheme() ? qtMate::material::color::Shade::Shade800 : qtMate::material::color::Shade::Shade300);
-		brush.setStyle(Qt::BrushStyle::BDiagPattern);
-		painter->fillRect(rect, brush);
-	};
 	auto const drawEntitySummaryIntersection = [painter, &rect, state, flags, drawMediaLockedDot](auto const brush, auto const penColor, auto const penWidth)
 	{
 		painter->setBrush(brush);
@@ -360,30 +359,22 @@ void drawCapabilities(QPainter* painter, QRect const& rect, Model::IntersectionD
 		}
 	};
 
-	// Do not draw incompatible format types if not connected
-	if (!drawCRFAudioConnections && flags.test(Model::IntersectionData::Flag::WrongFormatType) && state == Model::IntersectionData::State::NotConnected)
+	// Nothing to draw (not connected offline streams, forbidden connections, incompatible format types, ...)
+	if (isInvalidIntersection(type, state, flags, drawCRFAudioConnections))
 	{
-		drawInvalidIntersection();
+		drawInvalidIntersection(painter, rect);
 		return;
 	}
 
 	switch (type)
 	{
-		// Offline Streams
+		// Offline Streams (only connected ones are drawn)
 		case Model::IntersectionData::Type::OfflineOutputStream_RedundantStream:
 		{
-			// Only draw something if it's connected
-			if (state == Model::IntersectionData::State::Connected)
-			{
-				auto const brush = QBrush{ color::value(color::Name::Orange, color::Shade::Shade600), Qt::SolidPattern };
-				penColor = color::value(color::Name::Gray, color::Shade::Shade900);
-				penWidth = qreal{ 1.0 };
-				drawRedundantStreamIntersection(brush, penColor, penWidth);
-			}
-			else
-			{
-				drawInvalidIntersection();
-			}
+			auto const brush = QBrush{ color::value(color::Name::Orange, color::Shade::Shade600), Qt::SolidPattern };
+			penColor = color::value(color::Name::Gray, color::Shade::Shade900);
+			penWidth = qreal{ 1.0 };
+			drawRedundantStreamIntersection(brush, penColor, penWidth);
 			break;
 		}
 		case Model::IntersectionData::Type::OfflineOutputStream_Redundant:
@@ -394,17 +385,9 @@ void drawCapabilities(QPainter* painter, QRect const& rect, Model::IntersectionD
 		}
 		case Model::IntersectionData::Type::OfflineOutputStream_SingleStream:
 		{
-			// Only draw something if it's connected
-			if (state == Model::IntersectionData::State::Connected)
-			{
-				auto const brush = QBrush{ color::value(color::Name::Orange, color::Shade::Shade600), Qt::SolidPattern };
-				penColor = color::value(color::Name::Gray, color::Shade::Shade900);
-				drawSingleStreamIntersection(brush, penColor, penWidth);
-			}
-			else
-			{
-				drawInvalidIntersection();
-			}
+			auto const brush = QBrush{ color::value(color::Name::Orange, color::Shade::Shade600), Qt::SolidPattern };
+			penColor = color::value(color::Name::Gray, color::Shade::Shade900);
+			drawSingleStreamIntersection(brush, penColor, penWidth);
 			break;
 		}
 		case Model::IntersectionData::Type::Entity_Entity:
@@ -451,18 +434,10 @@ void drawCapabilities(QPainter* painter, QRect const& rect, Model::IntersectionD
 		}
 		case Model::IntersectionData::Type::RedundantStream_RedundantStream_Forbidden:
 		{
-			// Nominal case, not connected (since it's forbidden by Milan)
-			if (state == Model::IntersectionData::State::NotConnected)
-			{
-				drawInvalidIntersection();
-			}
-			else
-			{
-				// But if the connection is made using another controller, we might have a connection we want to kill
-				auto const brush = QBrush{ getConnectionBrushColor(state, flags, wrongFormatHasPriorityOverInterfaceDown) };
-				penWidth = qreal{ 1.0 };
-				drawRedundantStreamIntersection(brush, penColor, penWidth);
-			}
+			// Not connected in the nominal case (since it's forbidden by Milan), but if the connection is made using another controller, we might have a connection we want to kill
+			auto const brush = QBrush{ getConnectionBrushColor(state, flags, wrongFormatHasPriorityOverInterfaceDown) };
+			penWidth = qreal{ 1.0 };
+			drawRedundantStreamIntersection(brush, penColor, penWidth);
 			break;
 		}
 		case Model::IntersectionData::Type::Redundant_Redundant:
@@ -480,12 +455,53 @@ void drawCapabilities(QPainter* painter, QRect const& rect, Model::IntersectionD
 			drawSingleStreamIntersection(brush, penColor, penWidth);
 			break;
 		}
-		case Model::IntersectionData::Type::None:
 		default:
-			drawInvalidIntersection();
+			// Invalid intersections have been drawn above
 			break;
 	}
 }
 
+bool isInvalidIntersection(Model::IntersectionData::Type const type, Model::IntersectionData::State const state, Model::IntersectionData::Flags const& flags, bool const drawCRFAudioConnections) noexcept
+{
+	if (isIncompatibleFormatTypeHidden(state, flags, drawCRFAudioConnections))
+	{
+		return true;
+	}
+
+	// drawCapabilities relies on this to draw the invalid pattern, its switch only handles the other cases
+	switch (type)
+	{
+		case Model::IntersectionData::Type::OfflineOutputStream_RedundantStream:
+		case Model::IntersectionData::Type::OfflineOutputStream_Redundant:
+		case Model::IntersectionData::Type::OfflineOutputStream_SingleStream:
+			return state != Model::IntersectionData::State::Connected;
+		case Model::IntersectionData::Type::RedundantStream_RedundantStream_Forbidden:
+			return state == Model::IntersectionData::State::NotConnected;
+		case Model::IntersectionData::Type::Entity_Entity:
+		case Model::IntersectionData::Type::Entity_Redundant:
+		case Model::IntersectionData::Type::Entity_RedundantStream:
+		case Model::IntersectionData::Type::Entity_SingleStream:
+		case Model::IntersectionData::Type::Entity_SingleChannel:
+		case Model::IntersectionData::Type::Redundant_RedundantStream:
+		case Model::IntersectionData::Type::RedundantStream_RedundantStream:
+		case Model::IntersectionData::Type::Redundant_Redundant:
+		case Model::IntersectionData::Type::RedundantStream_SingleStream:
+		case Model::IntersectionData::Type::Redundant_SingleStream:
+		case Model::IntersectionData::Type::SingleStream_SingleStream:
+		case Model::IntersectionData::Type::SingleChannel_SingleChannel:
+			return false;
+		case Model::IntersectionData::Type::None:
+		default:
+			return true;
+	}
+}
+
+void drawInvalidIntersection(QPainter* painter, QRect const& rect)
+{
+	auto brush = qtMate::material::color::brush(qtMate::material::color::Name::Gray, qtMate::material::color::isDarkColorScheme() ? qtMate::material::color::Shade::Shade800 : qtMate::material::color::Shade::Shade300);
+	brush.setStyle(Qt::BrushStyle::BDiagPattern);
+	painter->fillRect(rect, brush);
+}
+
 } // namespace paintHelper
 } // namespace connectionMatrix
@@ -31,6 +31,9 @@ namespace paintHelper
 {
 QPainterPath buildHeaderArrowPath(QRect const& rect, Qt::Orientation const orientation, bool const isTransposed, bool const alwaysShowArrowTip, bool const alwaysShowArrowEnd, int const arrowOffset, int const arrowSize, int const width);
 void drawCapabilities(QPainter* painter, QRect const& rect, Model::IntersectionData::Type const type, Model::IntersectionData::State const state, Model::IntersectionData::Flags const& flags, bool const drawMediaLockedDot, bool const drawCRFAudioConnections, bool const drawEntitySummary);
+// Returns true if drawCapabilities only fills the rect with the invalid intersection pattern for these parameters
+bool isInvalidIntersection(Model::IntersectionData::Type const type, Model::IntersectionData::State const state, Model::IntersectionData::Flags const& flags, bool const drawCRFAudioConnections) noexcept;
+void drawInvalidIntersection(QPainter* painter, QRect const& rect);
 
 } // namespace paintHelper
 } // namespace connectionMatrix
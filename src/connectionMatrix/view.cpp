@@ -23,6 +23,7 @@
 #include "connectionMatrix/headerView.hpp"
 #include "connectionMatrix/itemDelegate.hpp"
 #include "connectionMatrix/cornerWidget.hpp"
+#include "connectionMatrix/minimap.hpp"
 #include "avdecc/helper.hpp"
 #include "avdecc/hiveLogItems.hpp"
 
@@ -33,9 +34,70 @@
 #include <QMessageBox>
 #include <QMenu>
 #include <QApplication>
+#include <QPainter>
+#include <QStyleOption>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
 
 namespace connectionMatrix
 {
+// Number of sections in each direction of a rendered intersections tile
+static constexpr auto TileSectionsCount = 32;
+// Delay without filter change before applying it
+static constexpr auto FilterDebounceDelay = std::chrono::milliseconds{ 150 };
+
+struct TileSection
+{
+	int logicalIndex{ -1 };
+	int position{ 0 };
+	int size{ 0 };
+};
+
+static inline std::uint64_t makeTileKey(int const tileRow, int const tileColumn) noexcept
+{
+	return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(tileRow)) << 32) | static_cast<std::uint32_t>(tileColumn);
+}
+
+static inline int tileRowFromKey(std::uint64_t const key) noexcept
+{
+	return static_cast<int>(static_cast<std::uint32_t>(key >> 32));
+}
+
+static inline int tileColumnFromKey(std::uint64_t const key) noexcept
+{
+	return static_cast<int>(static_cast<std::uint32_t>(key));
+}
+
+// Returns the visible sections of header overlapping the [from, to[ content range
+static std::vector<TileSection> visibleSections(QHeaderView const* const header, int const from, int const to)
+{
+	auto sections = std::vector<TileSection>{};
+
+	auto visualIndex = header->visualIndexAt(from - header->offset());
+	if (visualIndex < 0)
+	{
+		return sections;
+	}
+
+	for (auto const count = header->count(); visualIndex < count; ++visualIndex)
+	{
+		auto const logicalIndex = header->logicalIndex(visualIndex);
+		auto const position = header->sectionPosition(logicalIndex);
+		if (position >= to)
+		{
+			break;
+		}
+		if (!header->isSectionHidden(logicalIndex))
+		{
+			sections.push_back(TileSection{ logicalIndex, position, header->sectionSize(logicalIndex) });
+		}
+	}
+
+	return sections;
+}
+
 View::View(QWidget* parent)
 	: QTableView{ parent }
 	, _model{ std::make_unique<Model>() }
@@ -43,12 +105,48 @@ View::View(QWidget* parent)
 	, _verticalHeaderView{ std::make_unique<HeaderView>(false, Qt::Vertical, this) }
 	, _itemDelegate{ std::make_unique<ItemDelegate>(this) }
 	, _cornerWidget{ std::make_unique<CornerWidget>(this) }
+	, _minimap{ std::make_unique<Minimap>(_model.get(), this) }
 {
 	setModel(_model.get());
 	setHorizontalHeader(_horizontalHeaderView.get());
 	setVerticalHeader(_verticalHeaderView.get());
 	setItemDelegate(_itemDelegate.get());
 
+	// Keep rendered intersections tiles and overview up-to-date
+	auto const invalidateAllTiles = [this]()
+	{
+		invalidateTiles();
+		_minimap->invalidate();
+	};
+
+	connect(_model.get(), &QAbstractItemModel::dataChanged, this,
+		[this](QModelIndex const& topLeft, QModelIndex const& bottomRight)
+		{
+			invalidateTiles(topLeft, bottomRight);
+			_minimap->invalidate(topLeft, bottomRight);
+		});
+	connect(_model.get(), &QAbstractItemModel::modelReset, this, invalidateAllTiles);
+	connect(_model.get(), &QAbstractItemModel::layoutChanged, this, invalidateAllTiles);
+	connect(_model.get(), &QAbstractItemModel::rowsInserted, this, invalidateAllTiles);
+	connect(_model.get(), &QAbstractItemModel::rowsRemoved, this, invalidateAllTiles);
+	connect(_model.get(), &QAbstractItemModel::columnsInserted, this, invalidateAllTiles);
+	connect(_model.get(), &QAbstractItemModel::columnsRemoved, this, invalidateAllTiles);
+	// Hiding or showing a section resizes it, only the tiles from this section onwards are moved
+	connect(_verticalHeaderView.get(), &QHeaderView::sectionResized, this,
+		[this](int const logicalIndex)
+		{
+			invalidateTiles(Qt::Vertical, logicalIndex);
+			_minimap->invalidate();
+		});
+	connect(_horizontalHeaderView.get(), &QHeaderView::sectionResized, this,
+		[this](int const logicalIndex)
+		{
+			invalidateTiles(Qt::Horizontal, logicalIndex);
+			_minimap->invalidate();
+		});
+	connect(_verticalHeaderView.get(), &QHeaderView::sectionCountChanged, this, invalidateAllTiles);
+	connect(_horizontalHeaderView.get(), &QHeaderView::sectionCountChanged, this, invalidateAllTiles);
+
 	setSelectionMode(QAbstractItemView::NoSelection);
 	setEditTriggers(QAbstractItemView::NoEditTriggers);
 	setMouseTracking(true);
@@ -57,7 +155,10 @@ View::View(QWidget* parent)
 	setCornerButtonEnabled(false);
 	stackUnder(_cornerWidget.get());
 
-	// Apply filter when needed
+	// Apply filter when needed, once typing paused
+	_filterTimer.setSingleShot(true);
+	_filterTimer.setInterval(FilterDebounceDelay);
+	connect(&_filterTimer, &QTimer::timeout, this, &View::forceFilter);
 	connect(_cornerWidget.get(), &CornerWidget::filterChanged, this, &View::onFilterChanged);
 
 	connect(_cornerWidget.get(), &CornerWidget::horizontalExpandClicked, _horizontalHeaderView.get(), &HeaderView::expandAll);
@@ -92,6 +193,7 @@ View::View(QWidget* parent)
 	settings->registerSettingObserver(settings::ConnectionMatrix_AllowCRFAudioConnection.name, this);
 	settings->registerSettingObserver(settings::ConnectionMatrix_CollapsedByDefault.name, this);
 	settings->registerSettingObserver(settings::ConnectionMatrix_ShowEntitySummary.name, this);
+	settings->registerSettingObserver(settings::ConnectionMatrix_ShowOverview.name, this);
 	settings->registerSettingObserver(settings::General_ThemeColorIndex.name, this);
 
 	// react on connection completed signals to show error messages.
@@ -111,6 +213,7 @@ View::~View()
 	settings->unregisterSettingObserver(settings::ConnectionMatrix_AllowCRFAudioConnection.name, this);
 	settings->unregisterSettingObserver(settings::ConnectionMatrix_CollapsedByDefault.name, this);
 	settings->unregisterSettingObserver(settings::ConnectionMatrix_ShowEntitySummary.name, this);
+	settings->unregisterSettingObserver(settings::ConnectionMatrix_ShowOverview.name, this);
 	settings->unregisterSettingObserver(settings::General_ThemeColorIndex.name, this);
 }
 
@@ -563,9 +666,10 @@ void View::onCustomContextMenuRequested(QPoint const& pos)
 	}
 }
 
-void View::onFilterChanged(QString const& filter)
+void View::onFilterChanged(QString const& /*filter*/)
 {
-	applyFilterPattern(QRegularExpression{ filter });
+	// Restart the timer, the current filter text is applied when it fires
+	_filterTimer.start();
 }
 
 void View::applyFilterPattern(QRegularExpression const& pattern)
@@ -576,9 +680,159 @@ void View::applyFilterPattern(QRegularExpression const& pattern)
 
 void View::forceFilter()
 {
+	_filterTimer.stop();
 	applyFilterPattern(QRegularExpression{ _cornerWidget->filterText() });
 }
 
+void View::invalidateTiles()
+{
+	_tiles.clear();
+}
+
+void View::invalidateTiles(QModelIndex const& topLeft, QModelIndex const& bottomRight)
+{
+	if (_tiles.empty())
+	{
+		return;
+	}
+
+	if (!topLeft.isValid() || !bottomRight.isValid())
+	{
+		invalidateTiles();
+		return;
+	}
+
+	auto const* const horizontalHeaderView = horizontalHeader();
+	auto const* const verticalHeaderView = verticalHeader();
+	auto const tileWidth = TileSectionsCount * horizontalHeaderView->defaultSectionSize();
+	auto const tileHeight = TileSectionsCount * verticalHeaderView->defaultSectionSize();
+
+	auto const top = verticalHeaderView->sectionPosition(topLeft.row());
+	auto const bottom = std::max(top, verticalHeaderView->sectionPosition(bottomRight.row()) + verticalHeaderView->sectionSize(bottomRight.row()) - 1);
+	auto const left = horizontalHeaderView->sectionPosition(topLeft.column());
+	auto const right = std::max(left, horizontalHeaderView->sectionPosition(bottomRight.column()) + horizontalHeaderView->sectionSize(bottomRight.column()) - 1);
+	if (top < 0 || left < 0)
+	{
+		invalidateTiles();
+		return;
+	}
+
+	auto const firstTileRow = top / tileHeight;
+	auto const lastTileRow = bottom / tileHeight;
+	auto const firstTileColumn = left / tileWidth;
+	auto const lastTileColumn = right / tileWidth;
+
+	// Only the tiles of the visible area are kept, check them instead of iterating the (possibly large) changed range
+	for (auto it = _tiles.begin(); it != _tiles.end();)
+	{
+		auto const tileRow = tileRowFromKey(it->first);
+		auto const tileColumn = tileColumnFromKey(it->first);
+		if (tileRow >= firstTileRow && tileRow <= lastTileRow && tileColumn >= firstTileColumn && tileColumn <= lastTileColumn)
+		{
+			it = _tiles.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+void View::invalidateTiles(Qt::Orientation const orientation, int const logicalIndex)
+{
+	if (_tiles.empty())
+	{
+		return;
+	}
+
+	auto const* const header = orientation == Qt::Horizontal ? horizontalHeader() : verticalHeader();
+	auto const position = header->sectionPosition(logicalIndex);
+	if (position < 0)
+	{
+		invalidateTiles();
+		return;
+	}
+
+	// Sections before the resized one didn't move
+	auto const tileSize = TileSectionsCount * header->defaultSectionSize();
+	auto const firstTile = position / tileSize;
+	for (auto it = _tiles.begin(); it != _tiles.end();)
+	{
+		auto const tile = orientation == Qt::Horizontal ? tileColumnFromKey(it->first) : tileRowFromKey(it->first);
+		if (tile >= firstTile)
+		{
+			it = _tiles.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+QPixmap View::renderTile(int const tileRow, int const tileColumn, qreal const devicePixelRatio) const
+{
+	auto const* const horizontalHeaderView = horizontalHeader();
+	auto const* const verticalHeaderView = verticalHeader();
+	auto const tileWidth = TileSectionsCount * horizontalHeaderView->defaultSectionSize();
+	auto const tileHeight = TileSectionsCount * verticalHeaderView->defaultSectionSize();
+	auto const tileRect = QRect{ tileColumn * tileWidth, tileRow * tileHeight, tileWidth, tileHeight };
+
+	auto pixmap = QPixmap{ tileRect.size() * devicePixelRatio };
+	pixmap.setDevicePixelRatio(devicePixelRatio);
+	pixmap.fill(Qt::transparent);
+
+	auto const rows = visibleSections(verticalHeaderView, tileRect.top(), tileRect.top() + tileRect.height());
+	auto const columns = visibleSections(horizontalHeaderView, tileRect.left(), tileRect.left() + tileRect.width());
+	if (rows.empty() || columns.empty())
+	{
+		return pixmap;
+	}
+
+	auto painter = QPainter{ &pixmap };
+
+	// Draw using content coordinates, so the invalid intersection pattern is continuous across tiles
+	painter.translate(-tileRect.topLeft());
+
+	// Same geometry than QTableView, the grid is drawn on the bottom and right of each intersection
+	auto const gridSize = showGrid() ? 1 : 0;
+
+	for (auto const& row : rows)
+	{
+		for (auto const& column : columns)
+		{
+			auto const rect = QRect{ column.position, row.position, column.size - gridSize, row.size - gridSize };
+			_itemDelegate->paintIntersection(&painter, rect, _model->compactIntersectionData(row.logicalIndex, column.logicalIndex));
+		}
+	}
+
+	if (showGrid())
+	{
+		auto option = QStyleOption{};
+		option.initFrom(this);
+		auto const gridColor = QColor::fromRgba(static_cast<QRgb>(style()->styleHint(QStyle::SH_Table_GridLineColor, &option, this)));
+		painter.setPen(QPen{ gridColor, 0, gridStyle() });
+
+		auto const left = columns.front().position;
+		auto const right = columns.back().position + columns.back().size - 1;
+		auto const top = rows.front().position;
+		auto const bottom = rows.back().position + rows.back().size - 1;
+
+		for (auto const& row : rows)
+		{
+			auto const y = row.position + row.size - 1;
+			painter.drawLine(left, y, right, y);
+		}
+		for (auto const& column : columns)
+		{
+			auto const x = column.position + column.size - 1;
+			painter.drawLine(x, top, x, bottom);
+		}
+	}
+
+	return pixmap;
+}
+
 void View::mouseMoveEvent(QMouseEvent* event)
 {
 	auto const index = indexAt(event->pos());
@@ -586,6 +840,122 @@ void View::mouseMoveEvent(QMouseEvent* event)
 	QTableView::mouseMoveEvent(event);
 }
 
+void View::paintEvent(QPaintEvent* event)
+{
+#if ENABLE_CONNECTION_MATRIX_HIGHLIGHT_DATA_CHANGED
+	// Data changed highlighting is drawn by the item delegate, keep painting each intersection individually
+	QTableView::paintEvent(event);
+#else
+	// Intersections are drawn from cached tiles, directly reading the model, instead of calling the item delegate for each visible intersection
+	auto const* const horizontalHeaderView = horizontalHeader();
+	auto const* const verticalHeaderView = verticalHeader();
+	auto const tileWidth = TileSectionsCount * horizontalHeaderView->defaultSectionSize();
+	auto const tileHeight = TileSectionsCount * verticalHeaderView->defaultSectionSize();
+	auto const horizontalOffset = horizontalHeaderView->offset();
+	auto const verticalOffset = verticalHeaderView->offset();
+	auto const contentRect = QRect{ 0, 0, horizontalHeaderView->length(), verticalHeaderView->length() };
+
+	// Rendered tiles are only valid for a single device pixel ratio
+	auto const devicePixelRatio = viewport()->devicePixelRatioF();
+	if (devicePixelRatio != _tilesDevicePixelRatio)
+	{
+		invalidateTiles();
+		_tilesDevicePixelRatio = devicePixelRatio;
+	}
+
+	// Anything outside of the intersections is painted by QTableView (before painting the tiles, as a single painter can be active on the viewport)
+	auto const remainingRegion = event->region().subtracted(contentRect.translated(-horizontalOffset, -verticalOffset));
+	if (!remainingRegion.isEmpty())
+	{
+		auto remainingEvent = QPaintEvent{ remainingRegion };
+		QTableView::paintEvent(&remainingEvent);
+	}
+
+	auto painter = QPainter{ viewport() };
+
+	// Background highlighting of the selected rows and columns, below the intersections (as the item delegate does)
+	auto const selection = selectionModel()->selection();
+	if (!selection.isEmpty())
+	{
+		auto option = QStyleOption{};
+		option.initFrom(this);
+		for (auto const& rect : visualRegionForSelection(selection))
+		{
+			painter.fillRect(rect, option.palette.highlight());
+		}
+	}
+
+	auto const dirtyRect = event->rect().translated(horizontalOffset, verticalOffset).intersected(contentRect);
+	if (!dirtyRect.isEmpty())
+	{
+		for (auto tileRow = dirtyRect.top() / tileHeight; tileRow <= dirtyRect.bottom() / tileHeight; ++tileRow)
+		{
+			for (auto tileColumn = dirtyRect.left() / tileWidth; tileColumn <= dirtyRect.right() / tileWidth; ++tileColumn)
+			{
+				auto const key = makeTileKey(tileRow, tileColumn);
+				auto tileIt = _tiles.find(key);
+				if (tileIt == _tiles.end())
+				{
+					tileIt = _tiles.emplace(key, renderTile(tileRow, tileColumn, devicePixelRatio)).first;
+				}
+				painter.drawPixmap(QPoint{ tileColumn * tileWidth - horizontalOffset, tileRow * tileHeight - verticalOffset }, tileIt->second);
+			}
+		}
+	}
+
+	// Only keep the tiles of the visible area
+	auto const visibleRect = viewport()->rect().translated(horizontalOffset, verticalOffset).intersected(contentRect);
+	if (visibleRect.isEmpty())
+	{
+		invalidateTiles();
+	}
+	else
+	{
+		auto const firstTileRow = visibleRect.top() / tileHeight;
+		auto const lastTileRow = visibleRect.bottom() / tileHeight;
+		auto const firstTileColumn = visibleRect.left() / tileWidth;
+		auto const lastTileColumn = visibleRect.right() / tileWidth;
+		for (auto it = _tiles.begin(); it != _tiles.end();)
+		{
+			auto const tileRow = tileRowFromKey(it->first);
+			auto const tileColumn = tileColumnFromKey(it->first);
+			if (tileRow < firstTileRow || tileRow > lastTileRow || tileColumn < firstTileColumn || tileColumn > lastTileColumn)
+			{
+				it = _tiles.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+#endif
+}
+
+void View::changeEvent(QEvent* event)
+{
+	switch (event->type())
+	{
+		// Rendered tiles depend on the palette and style
+		case QEvent::PaletteChange:
+		case QEvent::StyleChange:
+			invalidateTiles();
+			break;
+		default:
+			break;
+	}
+
+	QTableView::changeEvent(event);
+}
+
+void View::updateGeometries()
+{
+	QTableView::updateGeometries();
+
+	// The overview is only shown for large matrices, and is drawn over the bottom right corner of the viewport
+	_minimap->updatePlacement(viewport()->geometry());
+}
+
 void View::onSettingChanged(settings::SettingsManager::Setting const& name, QVariant const& value) noexcept
 {
 	if (name == settings::ConnectionMatrix_AlwaysShowArrowTip.name)
@@ -636,6 +1006,7 @@ void View::onSettingChanged(settings::SettingsManager::Setting const& name, QVar
 	{
 		auto const drawDot = value.toBool();
 		_itemDelegate->setDrawMediaLockedDot(drawDot);
+		invalidateTiles();
 
 		forceFilter();
 	}
@@ -643,6 +1014,7 @@ void View::onSettingChanged(settings::SettingsManager::Setting const& name, QVar
 	{
 		auto const drawConnections = value.toBool();
 		_itemDelegate->setDrawCRFAudioConnections(drawConnections);
+		invalidateTiles();
 
 		forceFilter();
 	}
@@ -659,9 +1031,15 @@ void View::onSettingChanged(settings::SettingsManager::Setting const& name, QVar
 	{
 		auto const drawSummary = value.toBool();
 		_itemDelegate->setDrawEntitySummary(drawSummary);
+		invalidateTiles();
 
 		forceFilter();
 	}
+	else if (name == settings::ConnectionMatrix_ShowOverview.name)
+	{
+		_minimap->setAllowed(value.toBool());
+		_minimap->updatePlacement(viewport()->geometry());
+	}
 	else if (name == settings::General_ThemeColorIndex.name)
 	{
 		auto const colorName = qtMate::material::color::Palette::name(value.toInt());
@@ -21,15 +21,21 @@
 
 #include <QTableView>
 #include <QRegularExpression>
+#include <QPixmap>
+#include <QTimer>
 #include "settingsManager/settings.hpp"
 #include "avdecc/channelConnectionManager.hpp"
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace connectionMatrix
 {
 class Model;
 class HeaderView;
 class ItemDelegate;
 class CornerWidget;
+class Minimap;
 
 class View final : public QTableView, private settings::SettingsManager::Observer
 {
@@ -62,8 +68,17 @@ private:
 	void applyFilterPattern(QRegularExpression const& pattern);
 	void forceFilter();
 
+	// Intersections tiles rendering
+	void invalidateTiles();
+	void invalidateTiles(QModelIndex const& topLeft, QModelIndex const& bottomRight);
+	void invalidateTiles(Qt::Orientation const orientation, int const logicalIndex);
+	QPixmap renderTile(int const tileRow, int const tileColumn, qreal const devicePixelRatio) const;
+
 	// QTableView overrides
 	virtual void mouseMoveEvent(QMouseEvent* event) override;
+	virtual void paintEvent(QPaintEvent* event) override;
+	virtual void changeEvent(QEvent* event) override;
+	virtual void updateGeometries() override;
 
 	// settings::SettingsManager::Observer overrides
 	virtual void onSettingChanged(settings::SettingsManager::Setting const& name, QVariant const& value) noexcept override;
@@ -77,7 +92,12 @@ private:
 	std::unique_ptr<HeaderView> _verticalHeaderView;
 	std::unique_ptr<ItemDelegate> _itemDelegate;
 	std::unique_ptr<CornerWidget> _cornerWidget;
+	std::unique_ptr<Minimap> _minimap;
 	std::uint32_t _countEntitiesListAttached{ 0u };
+	// Rendered intersections, by tile (row in the high 32 bits, column in the low 32 bits)
+	std::unordered_map<std::uint64_t, QPixmap> _tiles{};
+	qreal _tilesDevicePixelRatio{ 1.0 };
+	QTimer _filterTimer{};
 };
 
 } // namespace connectionMatrix
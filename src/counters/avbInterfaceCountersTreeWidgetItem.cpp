@@ -64,14 +64,12 @@ AvbInterfaceCountersTreeWidgetItem::AvbInterfaceCountersTreeWidgetItem(la::avdec
 	// Update counters right now
 	updateCounters(counters);
 
-	// Listen for AvbInterfaceCountersChanged
-	connect(&hive::modelsLibrary::ControllerManager::getInstance(), &hive::modelsLibrary::ControllerManager::avbInterfaceCountersChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::AvbInterfaceIndex const avbInterfaceIndex, la::avdecc::entity::model::AvbInterfaceCounters const& counters)
+	// Listen for AvbInterfaceCountersChanged (targeted to this AvbInterface only)
+	_signaler = hive::modelsLibrary::ControllerManager::getInstance().getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::AvbInterface, _avbInterfaceIndex);
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::avbInterfaceCountersChanged, this,
+		[this](la::avdecc::entity::model::AvbInterfaceCounters const& counters)
 		{
-			if (entityID == _entityID && avbInterfaceIndex == _avbInterfaceIndex)
-			{
-				updateCounters(counters);
-			}
+			updateCounters(counters);
 		});
 }
 
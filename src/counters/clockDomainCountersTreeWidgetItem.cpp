@@ -60,14 +60,12 @@ ClockDomainCountersTreeWidgetItem::ClockDomainCountersTreeWidgetItem(la::avdecc:
 	// Update counters right now
 	updateCounters(counters);
 
-	// Listen for ClockDomainCountersChanged
-	connect(&hive::modelsLibrary::ControllerManager::getInstance(), &hive::modelsLibrary::ControllerManager::clockDomainCountersChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::ClockDomainIndex const clockDomainIndex, la::avdecc::entity::model::ClockDomainCounters const& counters)
+	// Listen for ClockDomainCountersChanged (targeted to this ClockDomain only)
+	_signaler = hive::modelsLibrary::ControllerManager::getInstance().getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::ClockDomain, _clockDomainIndex);
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::clockDomainCountersChanged, this,
+		[this](la::avdecc::entity::model::ClockDomainCounters const& counters)
 		{
-			if (entityID == _entityID && clockDomainIndex == _clockDomainIndex)
-			{
-				updateCounters(counters);
-			}
+			updateCounters(counters);
 		});
 }
 
@@ -41,6 +41,7 @@ private:
 
 	la::avdecc::UniqueIdentifier const _entityID{};
 	la::avdecc::entity::model::ClockDomainIndex const _clockDomainIndex{ 0u };
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _signaler{};
 
 	// Counters
 	std::map<la::avdecc::entity::ClockDomainCounterValidFlag, QTreeWidgetItem*> _counters{};
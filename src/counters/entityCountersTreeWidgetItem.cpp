@@ -57,14 +57,12 @@ EntityCountersTreeWidgetItem::EntityCountersTreeWidgetItem(la::avdecc::UniqueIde
 	// Update counters right now
 	updateCounters(counters);
 
-	// Listen for EntityCountersChanged
-	connect(&hive::modelsLibrary::ControllerManager::getInstance(), &hive::modelsLibrary::ControllerManager::entityCountersChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::EntityCounters const& counters)
+	// Listen for EntityCountersChanged (targeted to this Entity only)
+	_signaler = hive::modelsLibrary::ControllerManager::getInstance().getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::Entity, la::avdecc::entity::model::DescriptorIndex{ 0u });
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::entityCountersChanged, this,
+		[this](la::avdecc::entity::model::EntityCounters const& counters)
 		{
-			if (entityID == _entityID)
-			{
-				updateCounters(counters);
-			}
+			updateCounters(counters);
 		});
 }
 
@@ -40,6 +40,7 @@ private:
 	void updateCounters(la::avdecc::entity::model::EntityCounters const& counters);
 
 	la::avdecc::UniqueIdentifier const _entityID{};
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _signaler{};
 
 	// Counters
 	std::map<la::avdecc::entity::EntityCounterValidFlag, QTreeWidgetItem*> _counters{};
@@ -77,34 +77,26 @@ StreamInputCountersTreeWidgetItem::StreamInputCountersTreeWidgetItem(la::avdecc:
 	_errorCounters = manager.getStreamInputErrorCounters(_entityID, _streamIndex);
 	updateCounters(counters);
 
-	// Listen for StreamInputCountersChanged
-	connect(&manager, &hive::modelsLibrary::ControllerManager::streamInputCountersChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamInputCounters const& counters)
+	// Listen for StreamInput signals (targeted to this StreamInput only)
+	_signaler = manager.getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::StreamInput, _streamIndex);
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::streamInputCountersChanged, this,
+		[this](la::avdecc::entity::model::StreamInputCounters const& counters)
 		{
-			if (entityID == _entityID && streamIndex == _streamIndex)
-			{
-				updateCounters(counters);
-			}
+			updateCounters(counters);
 		});
 
-	connect(&manager, &hive::modelsLibrary::ControllerManager::streamInputErrorCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex, hive::modelsLibrary::ControllerManager::StreamInputErrorCounters const& errorCounters)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::streamInputErrorCounterChanged, this,
+		[this](hive::modelsLibrary::ControllerManager::StreamInputErrorCounters const& errorCounters)
 		{
-			if (entityID == _entityID && streamIndex == _streamIndex)
-			{
-				_errorCounters = errorCounters;
-				updateCounters(_counters);
-			}
+			_errorCounters = errorCounters;
+			updateCounters(_counters);
 		});
 
-	connect(&manager, &hive::modelsLibrary::ControllerManager::streamInputConnectionChanged, this,
-		[this](la::avdecc::entity::model::StreamIdentification const& stream, la::avdecc::entity::model::StreamInputConnectionInfo const& info)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::streamInputConnectionChanged, this,
+		[this](la::avdecc::entity::model::StreamInputConnectionInfo const& info)
 		{
-			if (stream.entityID == _entityID && stream.streamIndex == _streamIndex)
-			{
-				_isConnected = info.state == la::avdecc::entity::model::StreamInputConnectionInfo::State::Connected;
-				updateCounters(_counters);
-			}
+			_isConnected = info.state == la::avdecc::entity::model::StreamInputConnectionInfo::State::Connected;
+			updateCounters(_counters);
 		});
 }
 
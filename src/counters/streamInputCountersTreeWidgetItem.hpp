@@ -71,6 +71,7 @@ private:
 	la::avdecc::UniqueIdentifier const _entityID{};
 	la::avdecc::entity::model::StreamIndex const _streamIndex{ 0u };
 	bool _isConnected{ false };
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _signaler{};
 
 	// Counters
 	std::map<la::avdecc::entity::StreamInputCounterValidFlag, StreamInputCounterTreeWidgetItem*> _counterWidgets{};
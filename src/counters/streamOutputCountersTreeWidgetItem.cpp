@@ -57,14 +57,12 @@ StreamOutputCountersTreeWidgetItem::StreamOutputCountersTreeWidgetItem(la::avdec
 	// Update counters right now
 	updateCounters(counters);
 
-	// Listen for StreamOutputCountersChanged
-	connect(&hive::modelsLibrary::ControllerManager::getInstance(), &hive::modelsLibrary::ControllerManager::streamOutputCountersChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::entity::model::StreamIndex const streamIndex, la::avdecc::entity::model::StreamOutputCounters const& counters)
+	// Listen for StreamOutputCountersChanged (targeted to this StreamOutput only)
+	_signaler = hive::modelsLibrary::ControllerManager::getInstance().getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::StreamOutput, _streamIndex);
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::streamOutputCountersChanged, this,
+		[this](la::avdecc::entity::model::StreamOutputCounters const& counters)
 		{
-			if (entityID == _entityID && streamIndex == _streamIndex)
-			{
-				updateCounters(counters);
-			}
+			updateCounters(counters);
 		});
 }
 
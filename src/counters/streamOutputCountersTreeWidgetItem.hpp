@@ -44,6 +44,7 @@ private:
 
 	la::avdecc::UniqueIdentifier const _entityID{};
 	la::avdecc::entity::model::StreamIndex const _streamIndex{ 0u };
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _signaler{};
 
 	// Counters
 	std::map<la::avdecc::entity::StreamOutputCounterValidFlag, QTreeWidgetItem*> _counters{};
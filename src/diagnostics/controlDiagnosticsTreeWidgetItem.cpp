@@ -37,14 +37,12 @@ ControlDiagnosticsTreeWidgetItem::ControlDiagnosticsTreeWidgetItem(la::avdecc::U
 	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
 	updateDiagnostics(manager.getDiagnostics(entityID));
 
-	// Listen for diagnosticsChanged
-	connect(&manager, &hive::modelsLibrary::ControllerManager::diagnosticsChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics)
+	// Listen for diagnosticsChanged (targeted to this Entity only)
+	_entitySignaler = manager.getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::Entity, la::avdecc::entity::model::DescriptorIndex{ 0u });
+	connect(_entitySignaler.get(), &hive::modelsLibrary::DescriptorSignaler::diagnosticsChanged, this,
+		[this](la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics)
 		{
-			if (entityID == _entityID)
-			{
-				updateDiagnostics(diagnostics);
-			}
+			updateDiagnostics(diagnostics);
 		});
 }
 
@@ -45,6 +45,7 @@ private:
 
 	la::avdecc::UniqueIdentifier const _entityID{};
 	la::avdecc::entity::model::ControlIndex const _controlIndex{ 0u };
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _entitySignaler{};
 
 	// Diagnostics
 	la::avdecc::controller::ControlledEntity::Diagnostics _diagnostics{};
@@ -0,0 +1,171 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "diagnostics/controllerPerformanceDialog.hpp"
+#include "internals/config.hpp"
+
+#include <hive/modelsLibrary/controllerManager.hpp>
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileDialog>
+#include <QHeaderView>
+#include <QMessageBox>
+#include <QStandardPaths>
+
+#include <algorithm>
+
+namespace
+{
+enum class Column
+{
+	Name,
+	Queued,
+	Delivered,
+	Pending,
+	P50,
+	P99,
+	Max,
+	Count,
+};
+
+QString latencyToString(std::chrono::microseconds const& latency) noexcept
+{
+	if (latency < std::chrono::milliseconds{ 1 })
+	{
+		return QString{ "%1 us" }.arg(latency.count());
+	}
+	return QString{ "%1 ms" }.arg(static_cast<double>(latency.count()) / 1000.0, 0, 'f', 1);
+}
+
+} // namespace
+
+ControllerPerformanceDialog::ControllerPerformanceDialog(QWidget* parent)
+	: QDialog{ parent }
+{
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+
+	// Configure UI
+	setWindowTitle(hive::internals::applicationShortName + " - " + "Controller Performance");
+	setMinimumSize(640, 480);
+
+	_enableCheckBox.setChecked(manager.isEventPipelineInstrumentationEnabled());
+	_enableCheckBox.setToolTip("Measure the delay between a notification received from the network and its processing by the user interface");
+
+	_table.setColumnCount(static_cast<int>(Column::Count));
+	_table.setHorizontalHeaderLabels({ "Notification", "Queued", "Delivered", "Pending", "p50", "p99", "Max" });
+	_table.setEditTriggers(QAbstractItemView::NoEditTriggers);
+	_table.setSelectionMode(QAbstractItemView::NoSelection);
+	_table.verticalHeader()->hide();
+	_table.horizontalHeader()->setSectionResizeMode(static_cast<int>(Column::Name), QHeaderView::Stretch);
+
+	auto* buttonsLayout = new QHBoxLayout{};
+	buttonsLayout->addWidget(&_resetButton);
+	buttonsLayout->addWidget(&_saveButton);
+	buttonsLayout->addStretch();
+	buttonsLayout->addWidget(&_closeButton);
+
+	_layout.addWidget(&_enableCheckBox);
+	_layout.addWidget(&_summaryLabel);
+	_layout.addWidget(&_table);
+	_layout.addLayout(buttonsLayout);
+
+	// Connect signals
+	connect(&_enableCheckBox, &QCheckBox::toggled, this,
+		[](bool const checked)
+		{
+			hive::modelsLibrary::ControllerManager::getInstance().setEnableEventPipelineInstrumentation(checked);
+		});
+	connect(&_resetButton, &QPushButton::clicked, this,
+		[this]()
+		{
+			hive::modelsLibrary::ControllerManager::getInstance().resetEventPipelineStatistics();
+			refresh();
+		});
+	connect(&_saveButton, &QPushButton::clicked, this, &ControllerPerformanceDialog::saveAsJson);
+	connect(&_closeButton, &QPushButton::clicked, this, &QDialog::accept);
+	connect(&_refreshTimer, &QTimer::timeout, this, &ControllerPerformanceDialog::refresh);
+
+	refresh();
+	_refreshTimer.start(500);
+}
+
+void ControllerPerformanceDialog::refresh() noexcept
+{
+	auto const statistics = hive::modelsLibrary::ControllerManager::getInstance().getEventPipelineStatistics();
+
+	_table.setRowCount(static_cast<int>(statistics.size()));
+
+	auto row = 0;
+	auto totalQueued = std::uint64_t{ 0u };
+	auto totalPending = std::uint64_t{ 0u };
+	auto worstLatency = std::chrono::microseconds{};
+	auto const setCell = [this, &row](Column const column, QString const& text)
+	{
+		auto* item = _table.item(row, static_cast<int>(column));
+		if (!item)
+		{
+			item = new QTableWidgetItem{};
+			if (column != Column::Name)
+			{
+				item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+			}
+			_table.setItem(row, static_cast<int>(column), item);
+		}
+		item->setText(text);
+	};
+
+	for (auto const& [name, stat] : statistics)
+	{
+		auto const pending = stat.queuedCount - std::min(stat.queuedCount, stat.deliveredCount);
+
+		setCell(Column::Name, QString::fromStdString(name));
+		setCell(Column::Queued, QString::number(stat.queuedCount));
+		setCell(Column::Delivered, QString::number(stat.deliveredCount));
+		setCell(Column::Pending, QString::number(pending));
+		setCell(Column::P50, latencyToString(stat.p50Latency));
+		setCell(Column::P99, latencyToString(stat.p99Latency));
+		setCell(Column::Max, latencyToString(stat.maxLatency));
+
+		totalQueued += stat.queuedCount;
+		totalPending += pending;
+		worstLatency = std::max(worstLatency, stat.maxLatency);
+		++row;
+	}
+
+	_summaryLabel.setText(QString{ "Notifications: %1 - Queue depth: %2 - Worst delivery latency: %3" }.arg(totalQueued).arg(totalPending).arg(latencyToString(worstLatency)));
+}
+
+void ControllerPerformanceDialog::saveAsJson() noexcept
+{
+	auto const filename = QFileDialog::getSaveFileName(this, "Save As...", QString("%1/ControllerPerformance_%2.json").arg(QStandardPaths::writableLocation(QStandardPaths::DesktopLocation)).arg(QDateTime::currentDateTime().toString("yyyyMMdd_HHmmss")), "JSON Files (*.json)");
+	if (filename.isEmpty())
+	{
+		return;
+	}
+
+	auto file = QFile{ filename };
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		QMessageBox::warning(this, "", "Failed to save file:\n" + filename);
+		return;
+	}
+
+	file.write(hive::modelsLibrary::ControllerManager::eventPipelineStatisticsToJson(hive::modelsLibrary::ControllerManager::getInstance().getEventPipelineStatistics()));
+}
@@ -0,0 +1,49 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QCheckBox>
+#include <QDialog>
+#include <QLabel>
+#include <QLayout>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QTimer>
+
+/** Live view of the ControllerManager event pipeline statistics (per notification counters and delivery latencies) */
+class ControllerPerformanceDialog : public QDialog
+{
+	Q_OBJECT
+public:
+	ControllerPerformanceDialog(QWidget* parent = nullptr);
+
+private:
+	void refresh() noexcept;
+	void saveAsJson() noexcept;
+
+	QVBoxLayout _layout{ this };
+	QCheckBox _enableCheckBox{ "Enable instrumentation", this };
+	QLabel _summaryLabel{ this };
+	QTableWidget _table{ this };
+	QPushButton _resetButton{ "Reset", this };
+	QPushButton _saveButton{ "Save As JSON...", this };
+	QPushButton _closeButton{ "Close", this };
+	QTimer _refreshTimer{};
+};
@@ -36,14 +36,12 @@ EntityDiagnosticsTreeWidgetItem::EntityDiagnosticsTreeWidgetItem(la::avdecc::Uni
 	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
 	updateDiagnostics(manager.getDiagnostics(entityID));
 
-	// Listen for diagnosticsChanged
-	connect(&manager, &hive::modelsLibrary::ControllerManager::diagnosticsChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics)
+	// Listen for diagnosticsChanged (targeted to this Entity only)
+	_signaler = manager.getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::Entity, la::avdecc::entity::model::DescriptorIndex{ 0u });
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::diagnosticsChanged, this,
+		[this](la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics)
 		{
-			if (entityID == _entityID)
-			{
-				updateDiagnostics(diagnostics);
-			}
+			updateDiagnostics(diagnostics);
 		});
 }
 
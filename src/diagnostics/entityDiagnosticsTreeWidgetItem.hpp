@@ -44,6 +44,7 @@ private:
 	void updateDiagnostics(la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics);
 
 	la::avdecc::UniqueIdentifier const _entityID{};
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _signaler{};
 
 	// Diagnostics
 	la::avdecc::controller::ControlledEntity::Diagnostics _diagnostics{};
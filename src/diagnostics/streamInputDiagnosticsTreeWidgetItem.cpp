@@ -38,24 +38,21 @@ StreamInputDiagnosticsTreeWidgetItem::StreamInputDiagnosticsTreeWidgetItem(la::a
 	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
 	updateDiagnostics(manager.getDiagnostics(entityID));
 
-	// Listen for diagnosticsChanged
-	connect(&manager, &hive::modelsLibrary::ControllerManager::diagnosticsChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics)
+	// Listen for diagnosticsChanged (targeted to this Entity only)
+	_entitySignaler = manager.getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::Entity, la::avdecc::entity::model::DescriptorIndex{ 0u });
+	connect(_entitySignaler.get(), &hive::modelsLibrary::DescriptorSignaler::diagnosticsChanged, this,
+		[this](la::avdecc::controller::ControlledEntity::Diagnostics const& diagnostics)
 		{
-			if (entityID == _entityID)
-			{
-				updateDiagnostics(diagnostics);
-			}
+			updateDiagnostics(diagnostics);
 		});
 
-	connect(&manager, &hive::modelsLibrary::ControllerManager::streamInputConnectionChanged, this,
-		[this](la::avdecc::entity::model::StreamIdentification const& stream, la::avdecc::entity::model::StreamInputConnectionInfo const& info)
+	// Listen for streamInputConnectionChanged (targeted to this StreamInput only)
+	_streamSignaler = manager.getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::StreamInput, _streamIndex);
+	connect(_streamSignaler.get(), &hive::modelsLibrary::DescriptorSignaler::streamInputConnectionChanged, this,
+		[this](la::avdecc::entity::model::StreamInputConnectionInfo const& info)
 		{
-			if (stream.entityID == _entityID && stream.streamIndex == _streamIndex)
-			{
-				_isConnected = info.state == la::avdecc::entity::model::StreamInputConnectionInfo::State::Connected;
-				updateDiagnostics(_diagnostics);
-			}
+			_isConnected = info.state == la::avdecc::entity::model::StreamInputConnectionInfo::State::Connected;
+			updateDiagnostics(_diagnostics);
 		});
 }
 
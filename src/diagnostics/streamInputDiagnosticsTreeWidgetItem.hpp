@@ -46,6 +46,8 @@ private:
 	la::avdecc::UniqueIdentifier const _entityID{};
 	la::avdecc::entity::model::StreamIndex const _streamIndex{ 0u };
 	bool _isConnected{ false };
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _entitySignaler{};
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _streamSignaler{};
 
 	// Diagnostics
 	la::avdecc::controller::ControlledEntity::Diagnostics _diagnostics{};
@@ -45,6 +45,7 @@
 
 #include <iostream>
 #include <chrono>
+#include <memory>
 
 #ifdef DEBUG
 #	define SPLASH_DELAY 0
@@ -207,10 +208,18 @@ int main(int argc, char* argv[])
 	auto const settingsFileOption = QCommandLineOption{ "settings", "Use the specified Settings file (.ini)", "Hive Settings" };
 	auto const ansFilesOption = QCommandLineOption{ "ans", "Load the specified ATDECC Network State (.ans)", "Network State" };
 	auto const aveFilesOption = QCommandLineOption{ "ave", "Load the specified ATDECC Virtual Entity (.ave)", "Virtual Entity" };
+	auto const dumpPerformanceOption = QCommandLineOption{ "dump-controller-performance", "Enable controller event pipeline instrumentation and write its statistics (.json) when exiting", "Statistics File" };
 	parser.addOption(singleOption);
 	parser.addOption(settingsFileOption);
 	parser.addOption(ansFilesOption);
 	parser.addOption(aveFilesOption);
+	auto const recordEventsOption = QCommandLineOption{ "record-events", "Record all controller events to the specified file (control values, media clock chains and diagnostics are replayed from the recorded entity model, not with their recorded values)", "Events File" };
+	auto const replayEventsOption = QCommandLineOption{ "replay-events", "Replay the specified recorded events file (use with the Virtual interface)", "Events File" };
+	auto const replaySpeedOption = QCommandLineOption{ "replay-speed", "Speed of the events replay: realtime (default) or max", "Speed", "realtime" };
+	parser.addOption(dumpPerformanceOption);
+	parser.addOption(recordEventsOption);
+	parser.addOption(replayEventsOption);
+	parser.addOption(replaySpeedOption);
 	parser.addPositionalArgument("files", "Files to load (.ave, .ans, .json)", "[files...]");
 	parser.addHelpOption();
 	parser.addVersionOption();
@@ -279,6 +288,48 @@ int main(int argc, char* argv[])
 		return 0;
 	}
 
+	// Enable event pipeline instrumentation as soon as possible, so that the initial enumeration is measured
+	auto const dumpPerformanceFile = parser.value(dumpPerformanceOption);
+	if (!dumpPerformanceFile.isEmpty())
+	{
+		hive::modelsLibrary::ControllerManager::getInstance().setEnableEventPipelineInstrumentation(true);
+	}
+
+	// Record or replay controller events, as soon as the controller is created
+	auto const recordEventsFile = parser.value(recordEventsOption);
+	auto const replayEventsFile = parser.value(replayEventsOption);
+	if (!recordEventsFile.isEmpty() || !replayEventsFile.isEmpty())
+	{
+		auto const replaySpeed = parser.value(replaySpeedOption) == "max" ? hive::modelsLibrary::ControllerManager::ReplaySpeed::Maximum : hive::modelsLibrary::ControllerManager::ReplaySpeed::RealTime;
+		auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+		auto connection = std::make_shared<QMetaObject::Connection>();
+		*connection = QObject::connect(&manager, &hive::modelsLibrary::ControllerManager::controllerOnline, &app,
+			[connection, recordEventsFile, replayEventsFile, replaySpeed]()
+			{
+				// Only for the first controller
+				QObject::disconnect(*connection);
+
+				auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+				if (!recordEventsFile.isEmpty() && !manager.startEventsRecording(recordEventsFile))
+				{
+					std::cerr << "Failed to record controller events to " << recordEventsFile.toStdString() << std::endl;
+				}
+				if (!replayEventsFile.isEmpty())
+				{
+					auto errorMessage = QString{};
+					if (!manager.startEventsReplay(replayEventsFile, replaySpeed, errorMessage))
+					{
+						std::cerr << "Failed to replay controller events from " << replayEventsFile.toStdString() << ": " << errorMessage.toStdString() << std::endl;
+					}
+				}
+			});
+		QObject::connect(&manager, &hive::modelsLibrary::ControllerManager::eventsReplayFinished, &app,
+			[](std::uint64_t const eventsCount)
+			{
+				std::cout << "Controller events replay finished: " << eventsCount << " events" << std::endl;
+			});
+	}
+
 	// Register settings (creating default value if none was saved before)
 	auto const settingsFileParsed = parser.value(settingsFileOption);
 	auto settingsFile = std::optional<QString>{};
@@ -306,6 +357,7 @@ int main(int argc, char* argv[])
 	settings.registerSetting(settings::ConnectionMatrix_AllowCRFAudioConnection);
 	settings.registerSetting(settings::ConnectionMatrix_CollapsedByDefault);
 	settings.registerSetting(settings::ConnectionMatrix_ShowEntitySummary);
+	settings.registerSetting(settings::ConnectionMatrix_ShowOverview);
 
 	// Network
 	settings.registerSetting(settings::Network_ProtocolType);
@@ -419,6 +471,21 @@ int main(int argc, char* argv[])
 	}
 #endif // !BUGREPORTER_CATCH_EXCEPTIONS
 
+	// Dump event pipeline statistics
+	if (!dumpPerformanceFile.isEmpty())
+	{
+		auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+		auto file = QFile{ dumpPerformanceFile };
+		if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+		{
+			file.write(hive::modelsLibrary::ControllerManager::eventPipelineStatisticsToJson(manager.getEventPipelineStatistics()));
+		}
+		else
+		{
+			std::cerr << "Failed to write controller performance statistics to " << dumpPerformanceFile.toStdString() << std::endl;
+		}
+	}
+
 	// Destroy the controller before leaving main (so it's properly cleaned before all static variables are destroyed in a random order)
 	hive::modelsLibrary::ControllerManager::getInstance().destroyController();
 
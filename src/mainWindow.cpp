@@ -40,7 +40,9 @@
 #include "avdecc/hiveLogItems.hpp"
 #include "avdecc/channelConnectionManager.hpp"
 #include "avdecc/mcDomainManager.hpp"
+#include "avdecc/virtualEntitiesLoader.hpp"
 #include "mediaClock/mediaClockManagementDialog.hpp"
+#include "diagnostics/controllerPerformanceDialog.hpp"
 #include "newsFeed/newsFeed.hpp"
 #include "internals/config.hpp"
 #include "profiles/profiles.hpp"
@@ -71,6 +73,7 @@
 #include <hive/widgetModelsLibrary/entityLogoCache.hpp>
 #include <hive/widgetModelsLibrary/networkInterfacesListItemDelegate.hpp>
 
+#include <deque>
 #include <mutex>
 #include <memory>
 #include <optional>
@@ -134,6 +137,17 @@ public:
 
 	// Private Slots
 	Q_SLOT void currentControllerChanged();
+	Q_SLOT void loadProgressChanged(QString const& filePath, int const loadedCount, int const totalCount);
+	Q_SLOT void loadFinished(QString const& filePath, avdecc::VirtualEntitiesLoader::FileType const fileType, la::avdecc::jsonSerializer::DeserializationError const error, QString const& message, bool const cancelled);
+
+	// Private types
+	struct PendingLoad
+	{
+		QString fileName{};
+		avdecc::VirtualEntitiesLoader::FileType fileType{ avdecc::VirtualEntitiesLoader::FileType::AutoDetect };
+		la::avdecc::entity::model::jsonSerializer::Flags flags{};
+		bool silent{ false };
+	};
 
 	// Private methods
 	void setupAdvancedView(hive::VisibilityDefaults const& defaults);
@@ -146,6 +160,7 @@ public:
 	void createViewMenu();
 	void createToolbars();
 	void checkNpfStatus();
+	void loadNextFile();
 	void loadSettings();
 	void connectSignals();
 	void showChangeLog(QString const title, QString const versionString);
@@ -175,6 +190,10 @@ public:
 	SettingsSignaler _settingsSignaler{};
 	bool _mustResetViewSettings{ false };
 	QStringList _filesToLoad{};
+	avdecc::VirtualEntitiesLoader _virtualEntitiesLoader{ this };
+	std::deque<PendingLoad> _pendingLoads{}; // Files waiting to be loaded
+	std::optional<PendingLoad> _currentLoad{}; // File being loaded by _virtualEntitiesLoader
+	QProgressDialog* _loadProgressDialog{ nullptr };
 	bool _usingBetaAppcast{ false };
 	bool _usingBackupAppcast{ false };
 	std::unique_ptr<ListViewMatrixViewController> _listViewMatrixViewController{ nullptr }; // Remove smartpointer once in use in the upcoming layout classes
@@ -257,179 +276,192 @@ void MainWindowImpl::setupProfile()
 	}
 }
 
-void MainWindowImpl::loadFile(QString const& fileName, bool const silent)
+static QString deserializationErrorToString(la::avdecc::jsonSerializer::DeserializationError const error, QString const& message) noexcept
 {
-	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
-
-	auto const getErrorString = [](auto const error, auto const& message)
+	auto msg = QString{};
+	if (!!error)
 	{
-		auto msg = QString{};
-		if (!!error)
+		switch (error)
 		{
-			switch (error)
-			{
-				case la::avdecc::jsonSerializer::DeserializationError::AccessDenied:
-					msg = "Access Denied";
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::FileReadError:
-					msg = "Error Reading File";
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::IncompatibleDumpVersion:
-					msg = "Incompatible Dump Version";
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::ParseError:
-					msg = QString("Parse Error: %1").arg(message.c_str());
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::MissingKey:
-					msg = QString("Missing Key: %1").arg(message.c_str());
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::InvalidKey:
-					msg = QString("Invalid Key: %1").arg(message.c_str());
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::InvalidValue:
-					msg = QString("Invalid Value: %1").arg(message.c_str());
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::OtherError:
-					msg = message.c_str();
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::DuplicateEntityID:
-					msg = QString("An Entity already exists with the same EntityID: %1").arg(message.c_str());
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::NotCompliant:
-					msg = message.c_str();
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::Incomplete:
-					msg = message.c_str();
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::MissingInformation:
-					msg = message.c_str();
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::IncompatibleEntityModelVersion:
-					msg = "Incompatible Entity Model Version";
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::NotSupported:
-					msg = "Virtual Entity Loading not supported by this version of the AVDECC library";
-					break;
-				case la::avdecc::jsonSerializer::DeserializationError::InternalError:
-					msg = QString("Internal Error: %1").arg(message.c_str());
-					break;
-				default:
-					AVDECC_ASSERT(false, "Unknown Error");
-					msg = "Unknown Error";
-					break;
-			}
+			case la::avdecc::jsonSerializer::DeserializationError::AccessDenied:
+				msg = "Access Denied";
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::FileReadError:
+				msg = "Error Reading File";
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::IncompatibleDumpVersion:
+				msg = "Incompatible Dump Version";
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::ParseError:
+				msg = QString("Parse Error: %1").arg(message);
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::MissingKey:
+				msg = QString("Missing Key: %1").arg(message);
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::InvalidKey:
+				msg = QString("Invalid Key: %1").arg(message);
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::InvalidValue:
+				msg = QString("Invalid Value: %1").arg(message);
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::OtherError:
+				msg = message;
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::DuplicateEntityID:
+				msg = QString("An Entity already exists with the same EntityID: %1").arg(message);
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::NotCompliant:
+				msg = message;
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::Incomplete:
+				msg = message;
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::MissingInformation:
+				msg = message;
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::IncompatibleEntityModelVersion:
+				msg = "Incompatible Entity Model Version";
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::NotSupported:
+				msg = "Virtual Entity Loading not supported by this version of the AVDECC library";
+				break;
+			case la::avdecc::jsonSerializer::DeserializationError::InternalError:
+				msg = QString("Internal Error: %1").arg(message);
+				break;
+			default:
+				AVDECC_ASSERT(false, "Unknown Error");
+				msg = "Unknown Error";
+				break;
 		}
-		return msg;
-	};
-
-	auto const loadEntity = [&manager, &getErrorString](auto const& filePath, auto const flags)
-	{
-		auto const [error, message] = manager.loadVirtualEntityFromJson(filePath, flags);
-		return std::make_tuple(error, getErrorString(error, message));
-	};
-
-	auto const loadNetworkState = [&manager, &getErrorString](auto const& filePath, auto const flags)
-	{
-		auto const [error, message] = manager.loadVirtualEntitiesFromJsonNetworkState(filePath, flags);
-		return std::make_tuple(error, getErrorString(error, message));
-	};
+	}
+	return msg;
+}
 
+void MainWindowImpl::loadFile(QString const& fileName, bool const silent)
+{
 	auto const fi = QFileInfo{ fileName };
 	auto const ext = fi.suffix();
 
+	auto load = PendingLoad{ fileName, avdecc::VirtualEntitiesLoader::FileType::AutoDetect, la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDiagnostics }, silent };
+
 	// AVDECC Virtual Entity
 	if (ext == "ave")
 	{
-		auto flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDiagnostics };
-		flags.set(la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat);
-		auto [error, message] = loadEntity(fileName, flags);
-		if (!!error)
-		{
-			if (error == la::avdecc::jsonSerializer::DeserializationError::NotCompliant)
-			{
-				auto choice = QMessageBox::StandardButton::Yes;
-				if (silent)
-				{
-					LOG_HIVE_WARN(QString("[%1] Entity model is not fully IEEE1722.1 compliant").arg(fileName));
-				}
-				else
-				{
-					choice = static_cast<QMessageBox::StandardButton>(QMessageBox::question(_parent, "", "Entity model is not fully IEEE1722.1 compliant.\n\nDo you want to import anyway?", QMessageBox::StandardButton::Yes, QMessageBox::StandardButton::No));
-				}
-				if (choice == QMessageBox::StandardButton::Yes)
-				{
-					flags.set(la::avdecc::entity::model::jsonSerializer::Flag::IgnoreAEMSanityChecks);
-					auto const result = loadEntity(fileName, flags);
-					error = std::get<0>(result);
-					message = std::get<1>(result);
-					// Fallthrough to warning message
-				}
-			}
-			if (!!error)
-			{
-				if (silent)
-				{
-					LOG_HIVE_WARN(QString("[%1] Error loading file: %2").arg(fileName).arg(message));
-				}
-				else
-				{
-					QMessageBox::warning(_parent, "Failed to load Entity", QString("Error loading JSON file '%1':\n%2").arg(fileName).arg(message));
-				}
-			}
-		}
+		load.fileType = avdecc::VirtualEntitiesLoader::FileType::VirtualEntity;
+		load.flags.set(la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat);
 	}
-
 	// AVDECC Network State
 	else if (ext == "ans")
 	{
-		auto flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDiagnostics };
-		flags.set(la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat);
-		auto [error, message] = loadNetworkState(fileName, flags);
-		if (!!error)
+		load.fileType = avdecc::VirtualEntitiesLoader::FileType::NetworkState;
+		load.flags.set(la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat);
+	}
+	// Any kind of file, the loader has to autodetect
+	else if (ext != "json")
+	{
+		return;
+	}
+
+	// Files are loaded one at a time, in the worker thread of the loader
+	_pendingLoads.push_back(std::move(load));
+	loadNextFile();
+}
+
+void MainWindowImpl::loadNextFile()
+{
+	if (_currentLoad || _pendingLoads.empty())
+	{
+		return;
+	}
+
+	auto load = std::move(_pendingLoads.front());
+	_pendingLoads.pop_front();
+
+	// The loader is never busy here: a load is either current (_currentLoad is set) or waited for when cancelled
+	auto const started = _virtualEntitiesLoader.load(load.fileName, load.fileType, load.flags);
+	if (!AVDECC_ASSERT_WITH_RET(started, "VirtualEntitiesLoader should not be busy"))
+	{
+		return;
+	}
+
+	// Only shown if loading takes some time
+	_loadProgressDialog = new QProgressDialog(QString("Loading %1...").arg(QFileInfo{ load.fileName }.fileName()), "Cancel", 0, 0, _parent);
+	_loadProgressDialog->setMinimumWidth(350);
+	_loadProgressDialog->setWindowModality(Qt::WindowModal);
+	_loadProgressDialog->setMinimumDuration(500);
+	_loadProgressDialog->setAutoClose(false);
+	_loadProgressDialog->setAutoReset(false);
+	connect(_loadProgressDialog, &QProgressDialog::canceled, &_virtualEntitiesLoader, &avdecc::VirtualEntitiesLoader::cancel);
+
+	_currentLoad = std::move(load);
+}
+
+void MainWindowImpl::loadProgressChanged(QString const& filePath, int const loadedCount, int const totalCount)
+{
+	if (_loadProgressDialog)
+	{
+		_loadProgressDialog->setMaximum(totalCount);
+		_loadProgressDialog->setValue(loadedCount);
+		_loadProgressDialog->setLabelText(QString("Loading %1 (%2/%3 entities)...").arg(QFileInfo{ filePath }.fileName()).arg(loadedCount).arg(totalCount));
+	}
+}
+
+void MainWindowImpl::loadFinished(QString const& filePath, avdecc::VirtualEntitiesLoader::FileType const fileType, la::avdecc::jsonSerializer::DeserializationError const error, QString const& message, bool const cancelled)
+{
+	if (_loadProgressDialog)
+	{
+		_loadProgressDialog->deleteLater();
+		_loadProgressDialog = nullptr;
+	}
+
+	if (!AVDECC_ASSERT_WITH_RET(_currentLoad, "loadFinished received without a pending load"))
+	{
+		return;
+	}
+	auto load = std::move(*_currentLoad);
+	_currentLoad.reset();
+
+	if (cancelled)
+	{
+		LOG_HIVE_INFO(QString("[%1] Loading cancelled").arg(filePath));
+	}
+	else if (!!error)
+	{
+		auto const isEntity = fileType == avdecc::VirtualEntitiesLoader::FileType::VirtualEntity;
+		if (error == la::avdecc::jsonSerializer::DeserializationError::NotCompliant && isEntity && !load.flags.test(la::avdecc::entity::model::jsonSerializer::Flag::IgnoreAEMSanityChecks))
 		{
-			if (silent)
+			auto choice = QMessageBox::StandardButton::Yes;
+			if (load.silent)
 			{
-				LOG_HIVE_WARN(QString("[%1] Error loading file: %2").arg(fileName).arg(message));
+				LOG_HIVE_WARN(QString("[%1] Entity model is not fully IEEE1722.1 compliant").arg(filePath));
 			}
 			else
 			{
-				QMessageBox::warning(_parent, "Failed to load Network State", QString("Error loading JSON file '%1':\n%2").arg(fileName).arg(message));
+				choice = static_cast<QMessageBox::StandardButton>(QMessageBox::question(_parent, "", "Entity model is not fully IEEE1722.1 compliant.\n\nDo you want to import anyway?", QMessageBox::StandardButton::Yes, QMessageBox::StandardButton::No));
+			}
+			if (choice == QMessageBox::StandardButton::Yes)
+			{
+				// Load it again (before any other pending file), ignoring sanity checks
+				load.fileType = avdecc::VirtualEntitiesLoader::FileType::VirtualEntity;
+				load.flags.set(la::avdecc::entity::model::jsonSerializer::Flag::IgnoreAEMSanityChecks);
+				_pendingLoads.push_front(std::move(load));
 			}
 		}
-	}
-
-	// Any kind of file, we have to autodetect
-	else if (ext == "json")
-	{
-		auto flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDiagnostics };
-		// Start with AVE file type
-		auto [error, message] = loadEntity(fileName, flags);
-		if (!!error)
+		else
 		{
-			if (error == la::avdecc::jsonSerializer::DeserializationError::NotCompliant)
+			auto const errorString = deserializationErrorToString(error, message);
+			if (load.silent)
 			{
-				auto choice = QMessageBox::StandardButton::Yes;
-				if (silent)
-				{
-					LOG_HIVE_WARN(QString("[%1] Entity model is not fully IEEE1722.1 compliant").arg(fileName));
-				}
-				else
-				{
-					choice = static_cast<QMessageBox::StandardButton>(QMessageBox::question(_parent, "", "Entity model is not fully IEEE1722.1 compliant.\n\nDo you want to import anyway?", QMessageBox::StandardButton::Yes, QMessageBox::StandardButton::No));
-				}
-				if (choice == QMessageBox::StandardButton::Yes)
-				{
-					flags.set(la::avdecc::entity::model::jsonSerializer::Flag::IgnoreAEMSanityChecks);
-					loadEntity(fileName, flags);
-				}
+				LOG_HIVE_WARN(QString("[%1] Error loading file: %2").arg(filePath).arg(errorString));
 			}
 			else
 			{
-				// Then try ANS file type
-				loadNetworkState(fileName, flags);
+				QMessageBox::warning(_parent, isEntity ? "Failed to load Entity" : "Failed to load Network State", QString("Error loading JSON file '%1':\n%2").arg(filePath).arg(errorString));
 			}
 		}
 	}
+
+	loadNextFile();
 }
 
 void MainWindowImpl::currentControllerChanged()
@@ -458,6 +490,16 @@ void MainWindowImpl::currentControllerChanged()
 		checkNpfStatus();
 	}
 
+	// Stop loading virtual entities, they are bound to the current controller (wait for the worker before destroying it)
+	_pendingLoads.clear();
+	_virtualEntitiesLoader.cancelAndWait();
+	_currentLoad.reset();
+	if (_loadProgressDialog)
+	{
+		_loadProgressDialog->deleteLater();
+		_loadProgressDialog = nullptr;
+	}
+
 	// Clear the current controller
 	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
 	manager.destroyController();
@@ -733,6 +775,8 @@ void MainWindowImpl::connectSignals()
 {
 	connect(&_interfaceComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindowImpl::currentControllerChanged);
 	connect(&_refreshControllerButton, &QPushButton::clicked, this, &MainWindowImpl::currentControllerChanged);
+	connect(&_virtualEntitiesLoader, &avdecc::VirtualEntitiesLoader::progressChanged, this, &MainWindowImpl::loadProgressChanged);
+	connect(&_virtualEntitiesLoader, &avdecc::VirtualEntitiesLoader::loadFinished, this, &MainWindowImpl::loadFinished);
 	connect(&_discoverButton, &QPushButton::clicked, this,
 		[]()
 		{
@@ -911,6 +955,13 @@ void MainWindowImpl::connectSignals()
 			dialog.exec();
 		});
 
+	connect(actionControllerPerformance, &QAction::triggered, this,
+		[this]()
+		{
+			ControllerPerformanceDialog dialog{ _parent };
+			dialog.exec();
+		});
+
 	//
 
 	connect(actionAbout, &QAction::triggered, this,
@@ -153,6 +153,12 @@ private:
 			auto const lock = QSignalBlocker{ showEntitySummaryCheckBox };
 			showEntitySummaryCheckBox->setChecked(settings->getValue(settings::ConnectionMatrix_ShowEntitySummary.name).toBool());
 		}
+
+		// Show Overview
+		{
+			auto const lock = QSignalBlocker{ showOverviewCheckBox };
+			showOverviewCheckBox->setChecked(settings->getValue(settings::ConnectionMatrix_ShowOverview.name).toBool());
+		}
 	}
 
 	void loadControllerSettings()
@@ -338,6 +344,12 @@ void SettingsDialog::on_showEntitySummaryCheckBox_toggled(bool checked)
 	settings->setValue(settings::ConnectionMatrix_ShowEntitySummary.name, checked);
 }
 
+void SettingsDialog::on_showOverviewCheckBox_toggled(bool checked)
+{
+	auto* const settings = qApp->property(settings::SettingsManager::PropertyName).value<settings::SettingsManager*>();
+	settings->setValue(settings::ConnectionMatrix_ShowOverview.name, checked);
+}
+
 void SettingsDialog::on_discoveryDelayLineEdit_returnPressed()
 {
 	auto* const settings = qApp->property(settings::SettingsManager::PropertyName).value<settings::SettingsManager*>();
@@ -51,83 +51,57 @@ EntityStatisticsTreeWidgetItem::EntityStatisticsTreeWidgetItem(la::avdecc::Uniqu
 	updateMvuAecpUnsolicitedLossCounter(mvuAecpUnsolicitedLossCounter);
 	_enumerationTimeItem.setText(1, QString::number(enumerationTime.count()) + " msec");
 
-	// Listen for signals
-	connect(&manager, &hive::modelsLibrary::ControllerManager::aecpRetryCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+	// Listen for signals (targeted to this Entity only)
+	_signaler = manager.getDescriptorSignaler(_entityID, la::avdecc::entity::model::DescriptorType::Entity, la::avdecc::entity::model::DescriptorIndex{ 0u });
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::aecpRetryCounterChanged, this,
+		[this](std::uint64_t const value)
 		{
-			if (entityID == _entityID)
-			{
-				updateAecpRetryCounter(value);
-			}
+			updateAecpRetryCounter(value);
 		});
-	connect(&manager, &hive::modelsLibrary::ControllerManager::aecpTimeoutCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::aecpTimeoutCounterChanged, this,
+		[this](std::uint64_t const value)
 		{
-			if (entityID == _entityID)
-			{
-				updateAecpTimeoutCounter(value);
-			}
+			updateAecpTimeoutCounter(value);
 		});
-	connect(&manager, &hive::modelsLibrary::ControllerManager::aecpUnexpectedResponseCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::aecpUnexpectedResponseCounterChanged, this,
+		[this](std::uint64_t const value)
 		{
-			if (entityID == _entityID)
-			{
-				updateAecpUnexpectedResponseCounter(value);
-			}
+			updateAecpUnexpectedResponseCounter(value);
 		});
-	connect(&manager, &hive::modelsLibrary::ControllerManager::aecpResponseAverageTimeChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, std::chrono::milliseconds const& value)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::aecpResponseAverageTimeChanged, this,
+		[this](std::chrono::milliseconds const& value)
 		{
-			if (entityID == _entityID)
-			{
-				updateAecpResponseAverageTime(value);
-			}
+			updateAecpResponseAverageTime(value);
 		});
-	connect(&manager, &hive::modelsLibrary::ControllerManager::aemAecpUnsolicitedCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::aemAecpUnsolicitedCounterChanged, this,
+		[this](std::uint64_t const value)
 		{
-			if (entityID == _entityID)
-			{
-				updateAemAecpUnsolicitedCounter(value);
-			}
+			updateAemAecpUnsolicitedCounter(value);
 		});
-	connect(&manager, &hive::modelsLibrary::ControllerManager::aemAecpUnsolicitedLossCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::aemAecpUnsolicitedLossCounterChanged, this,
+		[this](std::uint64_t const value)
 		{
-			if (entityID == _entityID)
-			{
-				updateAemAecpUnsolicitedLossCounter(value);
-			}
+			updateAemAecpUnsolicitedLossCounter(value);
 		});
-	connect(&manager, &hive::modelsLibrary::ControllerManager::mvuAecpUnsolicitedCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::mvuAecpUnsolicitedCounterChanged, this,
+		[this](std::uint64_t const value)
 		{
-			if (entityID == _entityID)
-			{
-				updateMvuAecpUnsolicitedCounter(value);
-			}
+			updateMvuAecpUnsolicitedCounter(value);
 		});
-	connect(&manager, &hive::modelsLibrary::ControllerManager::mvuAecpUnsolicitedLossCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, std::uint64_t const value)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::mvuAecpUnsolicitedLossCounterChanged, this,
+		[this](std::uint64_t const value)
 		{
-			if (entityID == _entityID)
-			{
-				updateMvuAecpUnsolicitedLossCounter(value);
-			}
+			updateMvuAecpUnsolicitedLossCounter(value);
 		});
-	connect(&manager, &hive::modelsLibrary::ControllerManager::statisticsErrorCounterChanged, this,
-		[this](la::avdecc::UniqueIdentifier const entityID, hive::modelsLibrary::ControllerManager::StatisticsErrorCounters const& errorCounters)
+	connect(_signaler.get(), &hive::modelsLibrary::DescriptorSignaler::statisticsErrorCounterChanged, this,
+		[this](hive::modelsLibrary::ControllerManager::StatisticsErrorCounters const& errorCounters)
 		{
-			if (entityID == _entityID)
-			{
-				_errorCounters = errorCounters;
-				updateAecpRetryCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpRetries]);
-				updateAecpTimeoutCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpTimeouts]);
-				updateAecpUnexpectedResponseCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpUnexpectedResponses]);
-				updateAemAecpUnsolicitedLossCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AemAecpUnsolicitedLosses]);
-				updateMvuAecpUnsolicitedLossCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::MvuAecpUnsolicitedLosses]);
-			}
+			_errorCounters = errorCounters;
+			updateAecpRetryCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpRetries]);
+			updateAecpTimeoutCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpTimeouts]);
+			updateAecpUnexpectedResponseCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpUnexpectedResponses]);
+			updateAemAecpUnsolicitedLossCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AemAecpUnsolicitedLosses]);
+			updateMvuAecpUnsolicitedLossCounter(_counters[hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::MvuAecpUnsolicitedLosses]);
 		});
 }
 
@@ -73,6 +73,7 @@ private:
 	void updateMvuAecpUnsolicitedLossCounter(std::uint64_t const value) noexcept;
 
 	la::avdecc::UniqueIdentifier const _entityID{};
+	hive::modelsLibrary::ControllerManager::SharedDescriptorSignaler _signaler{};
 
 	// Statistics
 	EntityStatisticTreeWidgetItem _aecpRetryCounterItem{ hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpRetries, this };
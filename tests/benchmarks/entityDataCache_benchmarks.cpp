@@ -0,0 +1,150 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file entityDataCache_benchmarks.cpp
+* @author Christophe Calmejane
+*/
+
+// Measures the throughput of the cached data queries (used by paint paths) while the cache is being updated from the manager's thread
+
+#include <benchmark/benchmark.h>
+#include <hive/modelsLibrary/controllerManager.hpp>
+
+#include <QCoreApplication>
+#include <QString>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+auto const NetworkState = QString{ "data/connectionMatrix/18-Redundant_Redundant-ConnectedNoError_ConnectedLinkDown.json" };
+auto constexpr WritesPerIteration = 100u;
+
+/** Creates a Virtual controller for the duration of a benchmark */
+class VirtualController final
+{
+public:
+	VirtualController()
+	{
+		hive::modelsLibrary::ControllerManager::getInstance().createController(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "Benchmarks", 0x0001, la::avdecc::UniqueIdentifier::getNullUniqueIdentifier(), "en", nullptr);
+	}
+
+	~VirtualController()
+	{
+		hive::modelsLibrary::ControllerManager::getInstance().destroyController();
+		QCoreApplication::processEvents();
+	}
+
+	bool loadNetworkState(QString const& filePath) const noexcept
+	{
+		auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics };
+		auto const [error, message] = hive::modelsLibrary::ControllerManager::getInstance().loadVirtualEntitiesFromJsonNetworkState(filePath, flags);
+		QCoreApplication::processEvents();
+		return !error;
+	}
+};
+
+std::vector<la::avdecc::UniqueIdentifier> getEntities() noexcept
+{
+	auto entities = std::vector<la::avdecc::UniqueIdentifier>{};
+	hive::modelsLibrary::ControllerManager::getInstance().foreachEntity(
+		[&entities](la::avdecc::UniqueIdentifier const& entityID, la::avdecc::controller::ControlledEntity const& /*entity*/)
+		{
+			entities.push_back(entityID);
+		});
+	return entities;
+}
+
+} // namespace
+
+/* *********************************
+   EntityDataCache read contention
+*/
+// Each iteration is a fixed number of cache updates from the manager's thread, while state.range(0) threads keep reading the cache
+static void BM_EntityDataCache_ReadContention(benchmark::State& state)
+{
+	auto const controller = VirtualController{};
+	if (!controller.loadNetworkState(NetworkState))
+	{
+		state.SkipWithError("Failed to load network state");
+		return;
+	}
+
+	auto const entities = getEntities();
+	if (entities.empty())
+	{
+		state.SkipWithError("No entity loaded");
+		return;
+	}
+
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+	auto stop = std::atomic_bool{ false };
+	auto totalReads = std::atomic<std::uint64_t>{ 0u };
+	auto readers = std::vector<std::thread>{};
+
+	for (auto i = 0; i < state.range(0); ++i)
+	{
+		readers.emplace_back(
+			[&manager, &entities, &stop, &totalReads]()
+			{
+				auto reads = std::uint64_t{ 0u };
+				while (!stop)
+				{
+					for (auto const& entityID : entities)
+					{
+						benchmark::DoNotOptimize(manager.getStatisticsCounters(entityID));
+						benchmark::DoNotOptimize(manager.getStreamInputErrorCounters(entityID, la::avdecc::entity::model::StreamIndex{ 0u }));
+						benchmark::DoNotOptimize(manager.getDiagnostics(entityID));
+						benchmark::DoNotOptimize(manager.isRedundancyWarning(entityID));
+						reads += 4u;
+					}
+				}
+				totalReads += reads;
+			});
+	}
+
+	auto writes = std::uint64_t{ 0u };
+	for (auto _ : state)
+	{
+		for (auto write = 0u; write < WritesPerIteration; ++write)
+		{
+			for (auto const& entityID : entities)
+			{
+				manager.clearAllStatisticsCounterValidFlags(entityID);
+				manager.clearStatisticsCounterValidFlags(entityID, hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpRetries);
+				writes += 2u;
+			}
+			QCoreApplication::processEvents();
+		}
+	}
+
+	stop = true;
+	for (auto& reader : readers)
+	{
+		reader.join();
+	}
+
+	state.counters["reads"] = benchmark::Counter(static_cast<double>(totalReads.load()), benchmark::Counter::kIsRate);
+	state.counters["writes"] = benchmark::Counter(static_cast<double>(writes), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_EntityDataCache_ReadContention)->Arg(1)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,80 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file main.cpp
+* @author Christophe Calmejane
+*/
+
+#include <benchmark/benchmark.h>
+#include <la/avdecc/utils.hpp>
+
+#include <QApplication>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		// Models require a running Qt application
+		auto app = QApplication{ argc, argv };
+
+		// Unless specified on the command line, always save the results in a machine-readable file so they can be compared between releases
+		auto arguments = std::vector<char*>{ argv, argv + argc };
+		auto hasOutputFile = false;
+		for (auto const* const arg : arguments)
+		{
+			if (std::strncmp(arg, "--benchmark_out=", 16) == 0)
+			{
+				hasOutputFile = true;
+			}
+		}
+		auto outputFileArg = std::string{ "--benchmark_out=HiveBenchmarks.json" };
+		auto outputFormatArg = std::string{ "--benchmark_out_format=json" };
+		if (!hasOutputFile)
+		{
+			arguments.push_back(outputFileArg.data());
+			arguments.push_back(outputFormatArg.data());
+		}
+		auto argumentsCount = static_cast<int>(arguments.size());
+
+		// Initialize Google Benchmark framework
+		::benchmark::Initialize(&argumentsCount, arguments.data());
+		if (::benchmark::ReportUnrecognizedArguments(argumentsCount, arguments.data()))
+		{
+			return 1;
+		}
+
+		// Disable ASSERTS so loading generated networks is not interrupted
+		la::avdecc::utils::disableAssert();
+
+		// Run all benchmarks
+		::benchmark::RunSpecifiedBenchmarks();
+		::benchmark::Shutdown();
+
+		return 0;
+	}
+	catch (...)
+	{
+		return 1;
+	}
+}
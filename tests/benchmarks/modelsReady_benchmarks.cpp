@@ -0,0 +1,364 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file modelsReady_benchmarks.cpp
+* @author Christophe Calmejane
+*/
+
+// Measures the time between loading N virtual entities (through the Virtual protocol interface) and each model being ready to be displayed
+
+#include <benchmark/benchmark.h>
+#include <hive/modelsLibrary/controllerManager.hpp>
+#include <hive/modelsLibrary/discoveredEntitiesModel.hpp>
+#include <connectionMatrix/model.hpp>
+#include <avdecc/channelConnectionManager.hpp>
+#include <avdecc/mcDomainManager.hpp>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QString>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Network state with one talker and one listener connected to it, duplicated as many times as required
+auto const TemplateNetworkState = QString{ "data/connectionMatrix/9-Normal_Normal-ConnectedNoError_ConnectedNoError.json" };
+auto const TemplateTalkerID = QString{ "001B92FFFE0222BF" };
+auto const TemplateListenerID = QString{ "001B92FFFE02233B" };
+auto constexpr ReadyTimeout = std::chrono::seconds{ 120 };
+
+using Clock = std::chrono::steady_clock;
+
+struct GeneratedNetwork
+{
+	QString filePath{};
+	std::vector<std::pair<la::avdecc::UniqueIdentifier, la::avdecc::UniqueIdentifier>> talkerListenerPairs{};
+	std::size_t entitiesCount{ 0u };
+};
+
+/** Replaces all identifiers derived from the MAC address of an entity (EntityID, StreamIDs and MAC address itself) */
+void replaceEntityIdentity(QString& content, QString const& templateEntityID, std::uint32_t const newIdentity) noexcept
+{
+	auto const templateMac = templateEntityID.right(6);
+	auto const newMac = QString{ "%1" }.arg(newIdentity, 6, 16, QChar{ '0' }).toUpper();
+	auto const templateMacString = QString{ "00:1B:92:%1:%2:%3" }.arg(templateMac.mid(0, 2)).arg(templateMac.mid(2, 2)).arg(templateMac.mid(4, 2));
+	auto const newMacString = QString{ "00:1B:92:%1:%2:%3" }.arg(newMac.mid(0, 2)).arg(newMac.mid(2, 2)).arg(newMac.mid(4, 2));
+
+	content.replace("0x001B92FFFE" + templateMac, "0x001B92FFFE" + newMac, Qt::CaseInsensitive); // EntityID
+	content.replace("0x001B92" + templateMac, "0x001B92" + newMac, Qt::CaseInsensitive); // StreamIDs
+	content.replace(templateMacString, newMacString, Qt::CaseInsensitive); // MAC address
+}
+
+/** Generates (once) a network state with entitiesCount entities, made of connected talker/listener pairs */
+GeneratedNetwork const& generateNetwork(std::size_t const entitiesCount)
+{
+	static auto s_Networks = std::map<std::size_t, GeneratedNetwork>{};
+
+	if (auto const it = s_Networks.find(entitiesCount); it != s_Networks.end())
+	{
+		return it->second;
+	}
+
+	auto network = GeneratedNetwork{};
+
+	auto templateFile = QFile{ TemplateNetworkState };
+	if (!templateFile.open(QIODevice::ReadOnly))
+	{
+		return s_Networks[entitiesCount] = network;
+	}
+	auto const templateContent = QString::fromUtf8(templateFile.readAll());
+	auto document = QJsonDocument::fromJson(templateContent.toUtf8());
+	auto root = document.object();
+	auto entities = QJsonArray{};
+
+	for (auto pair = 0u; pair < (entitiesCount + 1u) / 2u; ++pair)
+	{
+		auto const talkerIdentity = static_cast<std::uint32_t>(0x100000u + pair * 2u);
+		auto const listenerIdentity = talkerIdentity + 1u;
+		auto content = templateContent;
+		replaceEntityIdentity(content, TemplateTalkerID, talkerIdentity);
+		replaceEntityIdentity(content, TemplateListenerID, listenerIdentity);
+
+		auto const pairEntities = QJsonDocument::fromJson(content.toUtf8()).object()["entities"].toArray();
+		for (auto const& entity : pairEntities)
+		{
+			if (entities.size() < static_cast<decltype(entities.size())>(entitiesCount))
+			{
+				entities.append(entity);
+			}
+		}
+		network.talkerListenerPairs.emplace_back(la::avdecc::UniqueIdentifier{ 0x001B92FFFE000000ull | talkerIdentity }, la::avdecc::UniqueIdentifier{ 0x001B92FFFE000000ull | listenerIdentity });
+	}
+	network.entitiesCount = static_cast<std::size_t>(entities.size());
+
+	root["entities"] = entities;
+	document.setObject(root);
+
+	network.filePath = QDir::temp().filePath(QString{ "HiveBenchmarks_%1.json" }.arg(entitiesCount));
+	auto outputFile = QFile{ network.filePath };
+	if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		network.filePath.clear();
+	}
+	else
+	{
+		outputFile.write(document.toJson(QJsonDocument::Compact));
+	}
+
+	return s_Networks[entitiesCount] = network;
+}
+
+/** Creates a Virtual controller for the duration of a benchmark iteration */
+class VirtualController final
+{
+public:
+	VirtualController()
+	{
+		hive::modelsLibrary::ControllerManager::getInstance().createController(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "Benchmarks", 0x0001, la::avdecc::UniqueIdentifier::getNullUniqueIdentifier(), "en", nullptr);
+	}
+
+	~VirtualController()
+	{
+		hive::modelsLibrary::ControllerManager::getInstance().destroyController();
+		QCoreApplication::processEvents();
+	}
+
+	bool loadNetworkState(QString const& filePath) const noexcept
+	{
+		auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics };
+		auto const [error, message] = hive::modelsLibrary::ControllerManager::getInstance().loadVirtualEntitiesFromJsonNetworkState(filePath, flags);
+		return !error;
+	}
+};
+
+/** Processes Qt events until isReady returns true, returns false on timeout */
+bool waitUntilReady(std::function<bool()> const& isReady) noexcept
+{
+	auto const start = Clock::now();
+	while (!isReady())
+	{
+		if ((Clock::now() - start) > ReadyTimeout)
+		{
+			return false;
+		}
+		QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+	}
+	return true;
+}
+
+/**
+* Runs one iteration of a ready-latency benchmark.
+* @param createModel Creates the model under test, before the entities are loaded.
+* @param isReady Returns true when the model is ready to be displayed (called repeatedly while processing events).
+*/
+template<typename ModelType>
+void runModelReadyBenchmark(benchmark::State& state, std::function<std::unique_ptr<ModelType>()> const& createModel, std::function<bool(ModelType&, GeneratedNetwork const&)> const& isReady)
+{
+	auto const& network = generateNetwork(static_cast<std::size_t>(state.range(0)));
+	if (network.filePath.isEmpty())
+	{
+		state.SkipWithError("Failed to generate network state");
+		return;
+	}
+
+	for (auto _ : state)
+	{
+		auto const controller = VirtualController{};
+		auto const model = createModel();
+
+		auto const start = Clock::now();
+		if (!controller.loadNetworkState(network.filePath))
+		{
+			state.SkipWithError("Failed to load network state");
+			return;
+		}
+		if (!waitUntilReady(
+					[&model, &network, &isReady]()
+					{
+						return isReady(*model, network);
+					}))
+		{
+			state.SkipWithError("Timeout waiting for the model");
+			return;
+		}
+		state.SetIterationTime(std::chrono::duration<double>(Clock::now() - start).count());
+	}
+
+	state.counters["entities"] = static_cast<double>(network.entitiesCount);
+	state.counters["entities_per_second"] = benchmark::Counter(static_cast<double>(network.entitiesCount) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+/** Collects the entities the MCDomainManager notified a media clock domain change for */
+class MediaClockDomainsListener final : public QObject
+{
+public:
+	MediaClockDomainsListener()
+	{
+		connect(&avdecc::mediaClock::MCDomainManager::getInstance(), &avdecc::mediaClock::MCDomainManager::mediaClockConnectionsUpdate, this,
+			[this](std::vector<la::avdecc::UniqueIdentifier> const& entityIDs)
+			{
+				_entities.insert(entityIDs.begin(), entityIDs.end());
+			});
+	}
+
+	bool contains(la::avdecc::UniqueIdentifier const& entityID) const noexcept
+	{
+		return _entities.count(entityID) > 0;
+	}
+
+private:
+	std::unordered_set<la::avdecc::UniqueIdentifier, la::avdecc::UniqueIdentifier::hash> _entities{};
+};
+
+/** Placeholder for the singleton managers, which cannot be created per iteration */
+struct Singleton
+{
+};
+
+} // namespace
+
+/* *********************************
+   connectionMatrix::Model
+*/
+static void BM_ConnectionMatrixModel_Ready(benchmark::State& state)
+{
+	runModelReadyBenchmark<connectionMatrix::Model>(
+		state,
+		[]()
+		{
+			auto model = std::make_unique<connectionMatrix::Model>();
+			model->setMode(connectionMatrix::Model::Mode::Stream);
+			return model;
+		},
+		[](connectionMatrix::Model& model, GeneratedNetwork const& network)
+		{
+			for (auto const& [talkerID, listenerID] : network.talkerListenerPairs)
+			{
+				if (!model.talkerNodeFromEntityID(talkerID) || !model.listenerNodeFromEntityID(listenerID))
+				{
+					return false;
+				}
+			}
+			return true;
+		});
+}
+BENCHMARK(BM_ConnectionMatrixModel_Ready)->Arg(10)->Arg(100)->Arg(1000)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+/* *********************************
+   DiscoveredEntitiesModel
+*/
+// Ready when the information of every loaded entity has been computed
+static void BM_DiscoveredEntitiesModel_Ready(benchmark::State& state)
+{
+	runModelReadyBenchmark<hive::modelsLibrary::HeadlessDiscoveredEntitiesModel>(
+		state,
+		[]()
+		{
+			return std::make_unique<hive::modelsLibrary::HeadlessDiscoveredEntitiesModel>();
+		},
+		[](hive::modelsLibrary::HeadlessDiscoveredEntitiesModel& model, GeneratedNetwork const& network)
+		{
+			auto const& entities = model.model();
+			if (entities.entitiesCount() != network.entitiesCount)
+			{
+				return false;
+			}
+			for (auto const& [talkerID, listenerID] : network.talkerListenerPairs)
+			{
+				if (!entities.entity(talkerID) || !entities.entity(listenerID))
+				{
+					return false;
+				}
+			}
+			return true;
+		});
+}
+BENCHMARK(BM_DiscoveredEntitiesModel_Ready)->Arg(10)->Arg(100)->Arg(1000)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+/* *********************************
+   ChannelConnectionManager
+*/
+// Ready when the channel connections between each talker/listener pair have been resolved
+static void BM_ChannelConnectionManager_Ready(benchmark::State& state)
+{
+	// Make sure the singleton exists before the entities are loaded
+	avdecc::ChannelConnectionManager::getInstance();
+
+	runModelReadyBenchmark<Singleton>(
+		state,
+		[]()
+		{
+			return std::make_unique<Singleton>();
+		},
+		[](Singleton& /*model*/, GeneratedNetwork const& network)
+		{
+			auto& manager = avdecc::ChannelConnectionManager::getInstance();
+			for (auto const& [talkerID, listenerID] : network.talkerListenerPairs)
+			{
+				auto const connections = manager.getAllChannelConnectionsBetweenDevices(talkerID, la::avdecc::entity::model::StreamPortIndex{ 0u }, listenerID);
+				if (!connections || connections->targets.empty())
+				{
+					return false;
+				}
+			}
+			return true;
+		});
+}
+BENCHMARK(BM_ChannelConnectionManager_Ready)->Arg(10)->Arg(100)->Arg(1000)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+/* *********************************
+   MCDomainManager
+*/
+// Ready when the media clock domain of every loaded entity has been computed and notified
+static void BM_MCDomainManager_Ready(benchmark::State& state)
+{
+	// Make sure the singleton exists before the entities are loaded
+	avdecc::mediaClock::MCDomainManager::getInstance();
+
+	runModelReadyBenchmark<MediaClockDomainsListener>(
+		state,
+		[]()
+		{
+			return std::make_unique<MediaClockDomainsListener>();
+		},
+		[](MediaClockDomainsListener& listener, GeneratedNetwork const& network)
+		{
+			for (auto const& [talkerID, listenerID] : network.talkerListenerPairs)
+			{
+				if (!listener.contains(talkerID) || !listener.contains(listenerID))
+				{
+					return false;
+				}
+			}
+			return true;
+		});
+}
+BENCHMARK(BM_MCDomainManager_Ready)->Arg(10)->Arg(100)->Arg(1000)->UseManualTime()->Unit(benchmark::kMillisecond);
@@ -26,7 +26,13 @@
 #include <hive/modelsLibrary/controllerManager.hpp>
 #include <connectionMatrix/model.hpp>
 
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QString>
+#include <QStringList>
 #include <QModelIndex>
 #ifdef _WIN32
 #	pragma warning(push)
@@ -36,6 +42,10 @@
 #ifdef _WIN32
 #	pragma warning(pop)
 #endif
+
+#include <cstdint>
+#include <vector>
+
 namespace
 {
 class ConnectionMatrix_F : public ::testing::Test
@@ -64,6 +74,11 @@ public:
 	{
 		auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
 		controllerManager.destroyController();
+
+		for (auto const& filePath : _generatedFiles)
+		{
+			QFile::remove(filePath);
+		}
 	}
 
 	void loadNetworkState(QString const& filePath)
@@ -75,11 +90,122 @@ public:
 		QTest::qWait(10); // Flush Qt EventLoop
 	}
 
+	// Returns the entity ID of the entityIndex-th entity of a copy made by generateNetworkState
+	static la::avdecc::UniqueIdentifier generatedEntityID(int const copy, int const entityIndex) noexcept
+	{
+		return la::avdecc::UniqueIdentifier{ std::uint64_t{ 0x001B92FF00000000 } | (static_cast<std::uint64_t>(copy + 1) << 16) | static_cast<std::uint64_t>(entityIndex) };
+	}
+
+	// Writes a network state made of copiesCount copies of the entities of filePath, each copy using its own entity IDs (starting with firstCopy), and returns its path
+	QString generateNetworkState(QString const& filePath, int const firstCopy, int const copiesCount)
+	{
+		auto file = QFile{ filePath };
+		if (!file.open(QIODevice::ReadOnly))
+		{
+			ADD_FAILURE() << "Failed to open NetworkState file";
+			return {};
+		}
+		auto const source = QString::fromUtf8(file.readAll());
+		auto root = QJsonDocument::fromJson(source.toUtf8()).object();
+
+		// Collect the entity IDs to replace
+		auto entityIDs = QStringList{};
+		for (auto const& entity : root.value("entities").toArray())
+		{
+			entityIDs.append(entity.toObject().value("adp_information").toObject().value("common").toObject().value("entity_id").toString());
+		}
+
+		// Connections between the entities of a copy are kept, as their IDs are replaced everywhere in the file
+		auto entities = QJsonArray{};
+		for (auto copy = firstCopy; copy < firstCopy + copiesCount; ++copy)
+		{
+			auto text = source;
+			for (auto i = 0; i < entityIDs.size(); ++i)
+			{
+				text.replace(entityIDs[i], QString{ "0x%1" }.arg(QString::number(static_cast<qulonglong>(generatedEntityID(copy, i).getValue()), 16).toUpper().rightJustified(16, '0')));
+			}
+			for (auto const& entity : QJsonDocument::fromJson(text.toUtf8()).object().value("entities").toArray())
+			{
+				entities.append(entity);
+			}
+		}
+		root["entities"] = entities;
+
+		auto const generatedFilePath = QDir::temp().filePath(QString{ "HiveTests_ConnectionMatrix_%1_%2.json" }.arg(firstCopy).arg(copiesCount));
+		auto generatedFile = QFile{ generatedFilePath };
+		if (!generatedFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+		{
+			ADD_FAILURE() << "Failed to create NetworkState file";
+			return {};
+		}
+		generatedFile.write(QJsonDocument{ root }.toJson());
+		_generatedFiles.push_back(generatedFilePath);
+
+		return generatedFilePath;
+	}
+
+	void unloadEntity(la::avdecc::UniqueIdentifier const entityID)
+	{
+		auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
+		ASSERT_TRUE(controllerManager.unloadVirtualEntity(entityID)) << "Failed to unload entity";
+		QTest::qWait(10); // Flush Qt EventLoop
+	}
+
 	connectionMatrix::Model& getModel() noexcept
 	{
 		return _model;
 	}
 
+	// Rebuilds all the cached data of a model, as if its entities all came online at once
+	static void rebuildModel(connectionMatrix::Model& model) noexcept
+	{
+		model.setTransposed(!model.isTransposed());
+		model.setTransposed(!model.isTransposed());
+	}
+
+	// Accesses all the intersections of the model, so that the next changes update already computed data
+	void computeAllIntersectionData() noexcept
+	{
+		auto& model = getModel();
+		for (auto talkerSection = 0; talkerSection < model.rowCount(); ++talkerSection)
+		{
+			for (auto listenerSection = 0; listenerSection < model.columnCount(); ++listenerSection)
+			{
+				model.intersectionData(model.getIntersectionIndex(talkerSection, listenerSection));
+			}
+		}
+	}
+
+	// Validates all the intersections of the model against the ones of a reference model, as well as its sections
+	void validateSameIntersectionData(connectionMatrix::Model const& referenceModel) noexcept
+	{
+		auto& model = getModel();
+		ASSERT_EQ(referenceModel.rowCount(), model.rowCount());
+		ASSERT_EQ(referenceModel.columnCount(), model.columnCount());
+
+		for (auto talkerSection = 0; talkerSection < model.rowCount(); ++talkerSection)
+		{
+			ASSERT_EQ(talkerSection, model.section(model.node(talkerSection, Qt::Vertical), Qt::Vertical));
+		}
+		for (auto listenerSection = 0; listenerSection < model.columnCount(); ++listenerSection)
+		{
+			ASSERT_EQ(listenerSection, model.section(model.node(listenerSection, Qt::Horizontal), Qt::Horizontal));
+		}
+
+		// Listeners first, so that the intersections are not computed in the same order than the reference model
+		for (auto listenerSection = model.columnCount() - 1; listenerSection >= 0; --listenerSection)
+		{
+			for (auto talkerSection = model.rowCount() - 1; talkerSection >= 0; --talkerSection)
+			{
+				auto const& expected = referenceModel.intersectionData(referenceModel.getIntersectionIndex(talkerSection, listenerSection));
+				auto const& data = model.intersectionData(model.getIntersectionIndex(talkerSection, listenerSection));
+				ASSERT_EQ(expected.type, data.type) << "Talker " << talkerSection << " Listener " << listenerSection;
+				EXPECT_EQ(expected.state, data.state) << "Talker " << talkerSection << " Listener " << listenerSection;
+				EXPECT_TRUE((expected.flags == data.flags)) << "Talker " << talkerSection << " Listener " << listenerSection;
+			}
+		}
+	}
+
 	void validateIntersectionData(int const talkerSection, int const listenerSection, connectionMatrix::Model::IntersectionData::Type const intersectionType, connectionMatrix::Model::IntersectionData::State const intersectionState, connectionMatrix::Model::IntersectionData::Flags const intersectionFlags) noexcept
 	{
 		auto& model = getModel();
@@ -90,6 +216,7 @@ public:
 	}
 
 private:
+	std::vector<QString> _generatedFiles{};
 	connectionMatrix::Model _model{ nullptr };
 	int x{ 0 };
 	QApplication _app{ x, nullptr };
@@ -2095,3 +2222,222 @@ TEST_F(ConnectionMatrix_F, EntityEntitySummary_NormalRedundant_ConnectedNoError_
 	}
 	validateIntersectionData(1, 4, connectionMatrix::Model::IntersectionData::Type::Entity_Entity, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{ connectionMatrix::Model::IntersectionData::Flag::MediaLocked });
 }
+
+/* *********************************
+   Intersection Data Computation
+*/
+TEST_F(ConnectionMatrix_F, IntersectionDataComputation_EntityOfflineOnline)
+{
+	auto referenceModel = connectionMatrix::Model{ nullptr };
+	referenceModel.setMode(connectionMatrix::Model::Mode::Stream);
+
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState(generateNetworkState("data/connectionMatrix/9-Normal_Normal-ConnectedNoError_ConnectedNoError.json", 0, 2)));
+	computeAllIntersectionData();
+
+	// Talker of the connected streams going offline
+	ASSERT_NO_FATAL_FAILURE(unloadEntity(generatedEntityID(0, 1)));
+	rebuildModel(referenceModel);
+	ASSERT_NO_FATAL_FAILURE(validateSameIntersectionData(referenceModel));
+
+	// Whole copy going offline then online again
+	ASSERT_NO_FATAL_FAILURE(unloadEntity(generatedEntityID(0, 0)));
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState(generateNetworkState("data/connectionMatrix/9-Normal_Normal-ConnectedNoError_ConnectedNoError.json", 0, 1)));
+	rebuildModel(referenceModel);
+	validateSameIntersectionData(referenceModel);
+}
+
+TEST_F(ConnectionMatrix_F, IntersectionDataComputation_StreamConnectionChanged)
+{
+	auto referenceModel = connectionMatrix::Model{ nullptr };
+	referenceModel.setMode(connectionMatrix::Model::Mode::Stream);
+
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState("data/connectionMatrix/2-Normal_Normal-NoError_ConnectedWrongFormat.json"));
+	computeAllIntersectionData();
+
+	auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
+	auto const talkerID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE02233B };
+	auto const listenerID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE0222BF };
+
+	// Connect Stream0, already computed intersections must be updated
+	emit controllerManager.streamInputConnectionChanged(la::avdecc::entity::model::StreamIdentification{ listenerID, 0u }, la::avdecc::entity::model::StreamInputConnectionInfo{ la::avdecc::entity::model::StreamIdentification{ talkerID, 0u }, la::avdecc::entity::model::StreamInputConnectionInfo::State::Connected });
+	{
+		auto& model = getModel();
+		EXPECT_EQ(connectionMatrix::Model::IntersectionData::State::Connected, model.intersectionData(model.getIntersectionIndex(6, 1)).state);
+	}
+	rebuildModel(referenceModel);
+	ASSERT_NO_FATAL_FAILURE(validateSameIntersectionData(referenceModel));
+
+	// Disconnect Stream1
+	emit controllerManager.streamInputConnectionChanged(la::avdecc::entity::model::StreamIdentification{ listenerID, 1u }, la::avdecc::entity::model::StreamInputConnectionInfo{});
+	{
+		auto& model = getModel();
+		EXPECT_EQ(connectionMatrix::Model::IntersectionData::State::NotConnected, model.intersectionData(model.getIntersectionIndex(7, 2)).state);
+	}
+	rebuildModel(referenceModel);
+	validateSameIntersectionData(referenceModel);
+}
+
+TEST_F(ConnectionMatrix_F, EntityConnections_StreamConnectionChanged)
+{
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState("data/connectionMatrix/2-Normal_Normal-NoError_ConnectedWrongFormat.json"));
+
+	auto& model = getModel();
+	auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
+	auto const talkerID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE02233B };
+	auto const listenerID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE0222BF };
+
+	// Stream1 is connected with a wrong format
+	{
+		auto const connections = model.entityConnections(talkerID, listenerID);
+		EXPECT_EQ(1u, connections.connectedCount);
+		EXPECT_EQ(1u, connections.errorsCount);
+	}
+
+	// Connect Stream0
+	emit controllerManager.streamInputConnectionChanged(la::avdecc::entity::model::StreamIdentification{ listenerID, 0u }, la::avdecc::entity::model::StreamInputConnectionInfo{ la::avdecc::entity::model::StreamIdentification{ talkerID, 0u }, la::avdecc::entity::model::StreamInputConnectionInfo::State::Connected });
+	{
+		auto const connections = model.entityConnections(talkerID, listenerID);
+		EXPECT_EQ(2u, connections.connectedCount);
+		EXPECT_EQ(1u, connections.errorsCount);
+	}
+
+	// Disconnect Stream1
+	emit controllerManager.streamInputConnectionChanged(la::avdecc::entity::model::StreamIdentification{ listenerID, 1u }, la::avdecc::entity::model::StreamInputConnectionInfo{});
+	{
+		auto const connections = model.entityConnections(talkerID, listenerID);
+		EXPECT_EQ(1u, connections.connectedCount);
+		EXPECT_EQ(0u, connections.errorsCount);
+	}
+
+	// Talker going offline, the listener is now connected to an offline talker
+	ASSERT_NO_FATAL_FAILURE(unloadEntity(talkerID));
+	{
+		auto const connections = model.entityConnections(la::avdecc::UniqueIdentifier{}, listenerID);
+		EXPECT_EQ(1u, connections.connectedCount);
+		EXPECT_EQ(0u, connections.errorsCount);
+	}
+}
+
+TEST_F(ConnectionMatrix_F, IntersectionDataComputation_ListenerStreamFormatChanged)
+{
+	auto referenceModel = connectionMatrix::Model{ nullptr };
+	referenceModel.setMode(connectionMatrix::Model::Mode::Stream);
+
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState("data/connectionMatrix/2-Normal_Normal-NoError_ConnectedWrongFormat.json"));
+	validateIntersectionData(7, 2, connectionMatrix::Model::IntersectionData::Type::SingleStream_SingleStream, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{ connectionMatrix::Model::IntersectionData::Flag::WrongFormatPossible });
+
+	auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
+	auto const listenerID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE0222BF };
+
+	// Listener Stream1 switching to the talker format, the cached verdict of the previous formats must not be used anymore
+	emit controllerManager.streamFormatChanged(listenerID, la::avdecc::entity::model::DescriptorType::StreamInput, 1u, la::avdecc::entity::model::StreamFormat{ 0x0205022002006000 });
+	validateIntersectionData(7, 2, connectionMatrix::Model::IntersectionData::Type::SingleStream_SingleStream, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{});
+	validateIntersectionData(5, 0, connectionMatrix::Model::IntersectionData::Type::Entity_Entity, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{});
+	rebuildModel(referenceModel);
+	ASSERT_NO_FATAL_FAILURE(validateSameIntersectionData(referenceModel));
+
+	// And back to its original format
+	emit controllerManager.streamFormatChanged(listenerID, la::avdecc::entity::model::DescriptorType::StreamInput, 1u, la::avdecc::entity::model::StreamFormat{ 0x020702200200C000 });
+	validateIntersectionData(7, 2, connectionMatrix::Model::IntersectionData::Type::SingleStream_SingleStream, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{ connectionMatrix::Model::IntersectionData::Flag::WrongFormatPossible });
+	validateIntersectionData(5, 0, connectionMatrix::Model::IntersectionData::Type::Entity_Entity, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{ connectionMatrix::Model::IntersectionData::Flag::WrongFormatPossible });
+	rebuildModel(referenceModel);
+	validateSameIntersectionData(referenceModel);
+}
+
+TEST_F(ConnectionMatrix_F, IntersectionDataComputation_SummaryChildrenChanged)
+{
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState("data/connectionMatrix/2-Normal_Normal-NoError_ConnectedWrongFormat.json"));
+	validateIntersectionData(5, 0, connectionMatrix::Model::IntersectionData::Type::Entity_Entity, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{ connectionMatrix::Model::IntersectionData::Flag::WrongFormatPossible });
+
+	auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
+	auto const talkerID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE02233B };
+	auto const listenerID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE0222BF };
+
+	// Disconnect the only connected stream
+	emit controllerManager.streamInputConnectionChanged(la::avdecc::entity::model::StreamIdentification{ listenerID, 1u }, la::avdecc::entity::model::StreamInputConnectionInfo{});
+	validateIntersectionData(5, 0, connectionMatrix::Model::IntersectionData::Type::Entity_Entity, connectionMatrix::Model::IntersectionData::State::NotConnected, connectionMatrix::Model::IntersectionData::Flags{});
+	validateIntersectionData(5, 2, connectionMatrix::Model::IntersectionData::Type::Entity_SingleStream, connectionMatrix::Model::IntersectionData::State::NotConnected, connectionMatrix::Model::IntersectionData::Flags{});
+	validateIntersectionData(7, 0, connectionMatrix::Model::IntersectionData::Type::Entity_SingleStream, connectionMatrix::Model::IntersectionData::State::NotConnected, connectionMatrix::Model::IntersectionData::Flags{});
+
+	// Connect it again
+	emit controllerManager.streamInputConnectionChanged(la::avdecc::entity::model::StreamIdentification{ listenerID, 1u }, la::avdecc::entity::model::StreamInputConnectionInfo{ la::avdecc::entity::model::StreamIdentification{ talkerID, 1u }, la::avdecc::entity::model::StreamInputConnectionInfo::State::Connected });
+	validateIntersectionData(5, 0, connectionMatrix::Model::IntersectionData::Type::Entity_Entity, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{ connectionMatrix::Model::IntersectionData::Flag::WrongFormatPossible });
+	validateIntersectionData(5, 2, connectionMatrix::Model::IntersectionData::Type::Entity_SingleStream, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{ connectionMatrix::Model::IntersectionData::Flag::WrongFormatPossible });
+	validateIntersectionData(7, 0, connectionMatrix::Model::IntersectionData::Type::Entity_SingleStream, connectionMatrix::Model::IntersectionData::State::Connected, connectionMatrix::Model::IntersectionData::Flags{ connectionMatrix::Model::IntersectionData::Flag::WrongFormatPossible });
+}
+
+TEST_F(ConnectionMatrix_F, IntersectionDataComputation_BulkInsertionAndRemoval)
+{
+	auto referenceModel = connectionMatrix::Model{ nullptr };
+	referenceModel.setMode(connectionMatrix::Model::Mode::Stream);
+
+	// Enough entities at once to rebuild the whole model
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState(generateNetworkState("data/connectionMatrix/18-Redundant_Redundant-ConnectedNoError_ConnectedLinkDown.json", 1, 8)));
+	computeAllIntersectionData();
+
+	// Inserted before all other entities, shifting all sections
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState(generateNetworkState("data/connectionMatrix/18-Redundant_Redundant-ConnectedNoError_ConnectedLinkDown.json", 0, 1)));
+	rebuildModel(referenceModel);
+	ASSERT_NO_FATAL_FAILURE(validateSameIntersectionData(referenceModel));
+
+	// Removed from the middle of the model
+	for (auto const copy : { 3, 4 })
+	{
+		for (auto const entityIndex : { 0, 1 })
+		{
+			ASSERT_NO_FATAL_FAILURE(unloadEntity(generatedEntityID(copy, entityIndex)));
+		}
+	}
+	rebuildModel(referenceModel);
+	validateSameIntersectionData(referenceModel);
+}
+
+TEST_F(ConnectionMatrix_F, IntersectionDataComputation_BulkInsertionIntoLargerModel)
+{
+	auto referenceModel = connectionMatrix::Model{ nullptr };
+	referenceModel.setMode(connectionMatrix::Model::Mode::Stream);
+
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState(generateNetworkState("data/connectionMatrix/18-Redundant_Redundant-ConnectedNoError_ConnectedLinkDown.json", 0, 12)));
+	computeAllIntersectionData();
+
+	// Fewer entities than already known (2 per copy), but enough to rebuild the whole model
+	ASSERT_NO_FATAL_FAILURE(loadNetworkState(generateNetworkState("data/connectionMatrix/18-Redundant_Redundant-ConnectedNoError_ConnectedLinkDown.json", 12, 8)));
+	rebuildModel(referenceModel);
+	validateSameIntersectionData(referenceModel);
+}
+
+TEST_F(ConnectionMatrix_F, IntersectionDataComputation_ParallelMatchesSerial)
+{
+	auto referenceModel = connectionMatrix::Model{ nullptr };
+	referenceModel.setMode(connectionMatrix::Model::Mode::Stream);
+
+	// Few entities at once, intersections are lazily computed on the calling thread
+	for (auto copy = 0; copy < 24; ++copy)
+	{
+		ASSERT_NO_FATAL_FAILURE(loadNetworkState(generateNetworkState("data/connectionMatrix/18-Redundant_Redundant-ConnectedNoError_ConnectedLinkDown.json", copy, 1)));
+	}
+
+	// Rebuilding the reference model precomputes its intersections on worker threads (ParallelComputationMinimumIntersectionsCount)
+	ASSERT_LE(16384, getModel().rowCount() * getModel().columnCount());
+	rebuildModel(referenceModel);
+	validateSameIntersectionData(referenceModel);
+}
+
+TEST_F(ConnectionMatrix_F, IntersectionDataComputation_ParallelMatchesSerial_ChannelMode)
+{
+	getModel().setMode(connectionMatrix::Model::Mode::Channel);
+
+	auto referenceModel = connectionMatrix::Model{ nullptr };
+	referenceModel.setMode(connectionMatrix::Model::Mode::Channel);
+
+	// Few entities at once, intersections are lazily computed on the calling thread
+	for (auto copy = 0; copy < 24; ++copy)
+	{
+		ASSERT_NO_FATAL_FAILURE(loadNetworkState(generateNetworkState("data/connectionMatrix/9-Normal_Normal-ConnectedNoError_ConnectedNoError.json", copy, 1)));
+	}
+
+	// Rebuilding the reference model precomputes its intersections on worker threads, from a snapshot of the channel connections
+	ASSERT_LE(16384, getModel().rowCount() * getModel().columnCount());
+	rebuildModel(referenceModel);
+	validateSameIntersectionData(referenceModel);
+}
@@ -0,0 +1,189 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file controllerManager_tests.cpp
+* @author Christophe Calmejane
+*/
+
+#include <gtest/gtest.h>
+#include <hive/modelsLibrary/controllerManager.hpp>
+
+#include <QCoreApplication>
+#include <QString>
+#ifdef _WIN32
+#	pragma warning(push)
+#	pragma warning(disable : 4127) // Disable conditional expression is constant
+#endif
+#include <QTest>
+#ifdef _WIN32
+#	pragma warning(pop)
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+class ControllerManager_F : public ::testing::Test
+{
+public:
+	virtual void SetUp() override
+	{
+		auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
+
+		// Create a controller
+		try
+		{
+			controllerManager.createController(la::avdecc::protocol::ProtocolInterface::Type::Virtual, "Unit Tests", 0x0001, la::avdecc::UniqueIdentifier::getNullUniqueIdentifier(), "en", nullptr);
+		}
+		catch (la::avdecc::controller::Controller::Exception const&)
+		{
+			ASSERT_FALSE(true);
+		}
+	}
+
+	virtual void TearDown() override
+	{
+		auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
+		controllerManager.destroyController();
+	}
+
+	void loadNetworkState(QString const& filePath)
+	{
+		auto& controllerManager = hive::modelsLibrary::ControllerManager::getInstance();
+		auto const flags = la::avdecc::entity::model::jsonSerializer::Flags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics };
+		auto const [err, msg] = controllerManager.loadVirtualEntitiesFromJsonNetworkState(filePath, flags);
+		ASSERT_EQ(la::avdecc::jsonSerializer::DeserializationError::NoError, err) << "Failed to load NetworkState file";
+		QTest::qWait(10); // Flush Qt EventLoop
+	}
+
+	std::vector<la::avdecc::UniqueIdentifier> getEntities() const noexcept
+	{
+		auto entities = std::vector<la::avdecc::UniqueIdentifier>{};
+		hive::modelsLibrary::ControllerManager::getInstance().foreachEntity(
+			[&entities](la::avdecc::UniqueIdentifier const& entityID, la::avdecc::controller::ControlledEntity const& /*entity*/)
+			{
+				entities.push_back(entityID);
+			});
+		return entities;
+	}
+
+private:
+	int x{ 0 };
+	QCoreApplication _app{ x, nullptr };
+};
+} // namespace
+
+/* *********************************
+   EntityDataCache concurrent access
+*/
+// Cached data queries (used by paint paths) are made from other threads while the cache is being updated from the manager's thread.
+// Values not touched by the writer must stay consistent for the readers, and all readers must see the final state once the writer is done.
+// Throughput under contention is measured by BM_EntityDataCache_ReadContention (HiveBenchmarks).
+TEST_F(ControllerManager_F, EntityDataCache_ConcurrentAccess)
+{
+	loadNetworkState("data/connectionMatrix/18-Redundant_Redundant-ConnectedNoError_ConnectedLinkDown.json");
+	if (HasFatalFailure())
+	{
+		return;
+	}
+
+	auto const entities = getEntities();
+	ASSERT_FALSE(entities.empty());
+
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+	auto constexpr ReadersCount = 4u;
+	auto constexpr ReadPasses = 200u;
+	auto constexpr WritePasses = 200u;
+
+	// Snapshot of the values the writer does not modify
+	auto expectedRedundancyWarnings = std::vector<bool>{};
+	auto expectedLatencyErrorsCounts = std::vector<std::size_t>{};
+	for (auto const& entityID : entities)
+	{
+		expectedRedundancyWarnings.push_back(manager.isRedundancyWarning(entityID));
+		expectedLatencyErrorsCounts.push_back(manager.getDiagnostics(entityID).streamInputOverLatency.size());
+	}
+
+	auto mismatches = std::atomic<std::uint32_t>{ 0u };
+	auto readers = std::vector<std::thread>{};
+
+	for (auto i = 0u; i < ReadersCount; ++i)
+	{
+		readers.emplace_back(
+			[&manager, &entities, &expectedRedundancyWarnings, &expectedLatencyErrorsCounts, &mismatches]()
+			{
+				for (auto pass = 0u; pass < ReadPasses; ++pass)
+				{
+					for (auto index = 0u; index < entities.size(); ++index)
+					{
+						auto const& entityID = entities[index];
+						manager.getStatisticsCounters(entityID);
+						manager.getStreamInputErrorCounters(entityID, la::avdecc::entity::model::StreamIndex{ 0u });
+						if (manager.isRedundancyWarning(entityID) != expectedRedundancyWarnings[index] || manager.getDiagnostics(entityID).streamInputOverLatency.size() != expectedLatencyErrorsCounts[index])
+						{
+							++mismatches;
+						}
+					}
+				}
+			});
+	}
+
+	// Writer: update the cache from this (the manager's) thread
+	for (auto pass = 0u; pass < WritePasses; ++pass)
+	{
+		for (auto const& entityID : entities)
+		{
+			manager.clearAllStatisticsCounterValidFlags(entityID);
+			manager.clearStatisticsCounterValidFlags(entityID, hive::modelsLibrary::ControllerManager::StatisticsErrorCounterFlag::AecpRetries);
+		}
+		QCoreApplication::processEvents();
+	}
+
+	for (auto& reader : readers)
+	{
+		reader.join();
+	}
+
+	EXPECT_EQ(0u, mismatches.load());
+
+	// Once the writer is done, all threads must read the same counters
+	for (auto const& entityID : entities)
+	{
+		auto const expectedCounters = manager.getStatisticsCounters(entityID);
+		auto counters = hive::modelsLibrary::ControllerManager::StatisticsErrorCounters{};
+		auto reader = std::thread{
+			[&manager, &entityID, &counters]()
+			{
+				counters = manager.getStatisticsCounters(entityID);
+			}
+		};
+		reader.join();
+		EXPECT_EQ(expectedCounters.size(), counters.size());
+		for (auto const& [flag, value] : expectedCounters)
+		{
+			auto const it = counters.find(flag);
+			ASSERT_NE(counters.end(), it);
+			EXPECT_EQ(value, it->second);
+		}
+	}
+}
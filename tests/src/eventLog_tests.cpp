@@ -0,0 +1,165 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+* @file eventLog_tests.cpp
+* @author Christophe Calmejane
+*/
+
+#include <gtest/gtest.h>
+#include <eventLog.hpp>
+
+#include <QByteArray>
+#include <QDir>
+#include <QFile>
+#include <QString>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace eventLog = hive::modelsLibrary::eventLog;
+
+TEST(EventLog, SerializeRoundTrip)
+{
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE0222BFull };
+	auto const stream = la::avdecc::entity::model::StreamIdentification{ entityID, la::avdecc::entity::model::StreamIndex{ 3u } };
+	auto const name = QString{ "Entity é" };
+	auto const text = std::string{ "Some text" };
+	auto const optional = std::optional<std::uint32_t>{ 42u };
+	auto const values = std::vector<std::uint16_t>{ 1u, 2u, 3u };
+	auto const counters = std::map<std::uint8_t, std::uint64_t>{ { 1u, 10u }, { 2u, 20u } };
+
+	auto buffer = eventLog::Buffer{};
+	eventLog::serialize(buffer, entityID);
+	eventLog::serialize(buffer, stream);
+	eventLog::serialize(buffer, name);
+	eventLog::serialize(buffer, text);
+	eventLog::serialize(buffer, optional);
+	eventLog::serialize(buffer, values);
+	eventLog::serialize(buffer, counters);
+
+	auto reader = eventLog::Reader{ buffer.data(), buffer.size() };
+	auto readEntityID = la::avdecc::UniqueIdentifier{};
+	auto readStream = la::avdecc::entity::model::StreamIdentification{};
+	auto readName = QString{};
+	auto readText = std::string{};
+	auto readOptional = std::optional<std::uint32_t>{};
+	auto readValues = std::vector<std::uint16_t>{};
+	auto readCounters = std::map<std::uint8_t, std::uint64_t>{};
+	eventLog::deserialize(reader, readEntityID);
+	eventLog::deserialize(reader, readStream);
+	eventLog::deserialize(reader, readName);
+	eventLog::deserialize(reader, readText);
+	eventLog::deserialize(reader, readOptional);
+	eventLog::deserialize(reader, readValues);
+	eventLog::deserialize(reader, readCounters);
+
+	EXPECT_TRUE(reader.isValid());
+	EXPECT_EQ(0u, reader.remaining());
+	EXPECT_EQ(entityID, readEntityID);
+	EXPECT_EQ(stream, readStream);
+	EXPECT_EQ(name, readName);
+	EXPECT_EQ(text, readText);
+	EXPECT_EQ(optional, readOptional);
+	EXPECT_EQ(values, readValues);
+	EXPECT_EQ(counters, readCounters);
+}
+
+TEST(EventLog, DeserializeInvalidSize)
+{
+	// Declared size larger than the remaining data
+	{
+		auto buffer = eventLog::Buffer{};
+		eventLog::detail::writeSize(buffer, 100u);
+		eventLog::detail::writeRaw(buffer, "abc", 3u);
+
+		auto reader = eventLog::Reader{ buffer.data(), buffer.size() };
+		auto value = QByteArray{ "previous" };
+		eventLog::deserialize(reader, value);
+		EXPECT_FALSE(reader.isValid());
+		EXPECT_TRUE(value.isEmpty());
+	}
+
+	// Declared size not representable as an int (QByteArray)
+	{
+		auto buffer = eventLog::Buffer{};
+		eventLog::detail::writeSize(buffer, 0xFFFFFFFFu);
+
+		auto reader = eventLog::Reader{ buffer.data(), buffer.size() };
+		auto value = QByteArray{};
+		eventLog::deserialize(reader, value);
+		EXPECT_FALSE(reader.isValid());
+		EXPECT_TRUE(value.isEmpty());
+	}
+
+	// Same for std::string
+	{
+		auto buffer = eventLog::Buffer{};
+		eventLog::detail::writeSize(buffer, 0xFFFFFFFFu);
+
+		auto reader = eventLog::Reader{ buffer.data(), buffer.size() };
+		auto value = std::string{ "previous" };
+		eventLog::deserialize(reader, value);
+		EXPECT_FALSE(reader.isValid());
+		EXPECT_TRUE(value.empty());
+	}
+}
+
+TEST(EventLog, FileRoundTrip)
+{
+	auto const filePath = QDir::temp().filePath("HiveTests_EventLog.bin");
+	auto const networkState = QByteArray{ "Network State" };
+	auto const entityID = la::avdecc::UniqueIdentifier{ 0x001B92FFFE0222BFull };
+	auto const name = QString{ "Talker" };
+
+	{
+		auto writer = eventLog::Writer::create(filePath, networkState);
+		ASSERT_NE(nullptr, writer);
+		writer->writeEvent(eventLog::EventType::EntityOnline, entityID);
+		writer->writeEvent(eventLog::EventType::EntityNameChanged, entityID, name);
+		writer->writeEvent(eventLog::EventType::EntityOffline, entityID);
+		EXPECT_EQ(3u, writer->getEventsCount());
+	}
+
+	auto errorMessage = QString{};
+	auto const log = eventLog::readEventLog(filePath, errorMessage);
+	QFile::remove(filePath);
+	ASSERT_TRUE(log.has_value()) << errorMessage.toStdString();
+	EXPECT_EQ(networkState, log->networkState);
+	ASSERT_EQ(3u, log->events.size());
+	EXPECT_EQ(eventLog::EventType::EntityOnline, log->events[0].type);
+	EXPECT_EQ(eventLog::EventType::EntityNameChanged, log->events[1].type);
+	EXPECT_EQ(eventLog::EventType::EntityOffline, log->events[2].type);
+	EXPECT_LE(log->events[0].timestamp, log->events[1].timestamp);
+	EXPECT_LE(log->events[1].timestamp, log->events[2].timestamp);
+
+	auto const& payload = log->events[1].payload;
+	auto reader = eventLog::Reader{ payload.data(), payload.size() };
+	auto readEntityID = la::avdecc::UniqueIdentifier{};
+	auto readName = QString{};
+	eventLog::deserialize(reader, readEntityID);
+	eventLog::deserialize(reader, readName);
+	EXPECT_TRUE(reader.isValid());
+	EXPECT_EQ(0u, reader.remaining());
+	EXPECT_EQ(entityID, readEntityID);
+	EXPECT_EQ(name, readName);
+}
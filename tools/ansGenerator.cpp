@@ -0,0 +1,607 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Generates synthetic ATDECC Network State files (.ans or .json) of any size, to be used for scale tests and benchmarks
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cerrno> // errno
+#include <cstdint>
+#include <cstdio> // snprintf
+#include <cstring> // strerror
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace
+{
+struct Options
+{
+	std::uint32_t talkers{ 10u };
+	std::uint32_t listeners{ 100u };
+	double redundantRatio{ 0.0 };
+	std::uint32_t streams{ 4u };
+	std::uint32_t channels{ 8u };
+	std::uint32_t clusterChannels{ 1u };
+	double mappingsRatio{ 1.0 };
+	double connectionDensity{ 0.5 };
+	std::uint32_t clockChainLength{ 1u };
+	std::uint32_t seed{ 0u };
+	std::string outputFile{};
+};
+
+/** Description of a generated entity, required to connect entities together */
+struct EntityInfo
+{
+	std::uint32_t macSuffix{ 0u }; // Lower 24 bits of the primary interface MAC address (secondary interface is macSuffix + 1)
+	bool isRedundant{ false };
+	std::uint32_t level{ 0u }; // 0 for talkers, position in the media clock chain for listeners
+	json entity{};
+};
+
+auto constexpr MaxEntities = std::uint32_t{ 0x7FFFFFu }; // Each entity uses 2 MAC addresses out of 24 bits
+auto constexpr StreamFormatBase = std::uint64_t{ 0x0205022000000000u }; // AAF, 48kHz, INT_32BIT, 32 bits depth
+auto constexpr SamplesPerFrame = std::uint64_t{ 6u }; // Class A at 48kHz
+auto constexpr SamplingRate = "0x0000BB80"; // 48kHz
+auto constexpr UnknownEntityID = "0xFFFFFFFFFFFFFFFF";
+auto constexpr NullEntityID = "0x0000000000000000";
+auto constexpr StreamIndexNone = 65535u;
+
+std::string toHexString(std::uint64_t const value) noexcept
+{
+	char buffer[19];
+	std::snprintf(buffer, sizeof(buffer), "0x%016llX", static_cast<unsigned long long>(value));
+	return buffer;
+}
+
+std::string macAddressToString(std::uint64_t const mac) noexcept
+{
+	char buffer[18];
+	std::snprintf(buffer, sizeof(buffer), "%02X:%02X:%02X:%02X:%02X:%02X", static_cast<unsigned>((mac >> 40) & 0xFF), static_cast<unsigned>((mac >> 32) & 0xFF), static_cast<unsigned>((mac >> 24) & 0xFF), static_cast<unsigned>((mac >> 16) & 0xFF), static_cast<unsigned>((mac >> 8) & 0xFF), static_cast<unsigned>(mac & 0xFF));
+	return buffer;
+}
+
+std::uint64_t makeMacAddress(std::uint32_t const macSuffix) noexcept
+{
+	return std::uint64_t{ 0x001B92000000u } | (macSuffix & 0xFFFFFFu);
+}
+
+std::uint64_t makeEntityID(std::uint32_t const macSuffix) noexcept
+{
+	// EUI-64 derived from the MAC address
+	auto const mac = makeMacAddress(macSuffix);
+	return ((mac & 0xFFFFFF000000u) << 16) | std::uint64_t{ 0xFFFE000000u } | (mac & 0xFFFFFFu);
+}
+
+std::uint64_t makeStreamID(std::uint32_t const macSuffix, std::uint16_t const streamIndex) noexcept
+{
+	return (makeMacAddress(macSuffix) << 16) | streamIndex;
+}
+
+std::uint64_t makeStreamDestMac(std::uint32_t const macSuffix, std::uint16_t const streamIndex) noexcept
+{
+	// Use the MAAP range, each stream of each entity gets its own address
+	return std::uint64_t{ 0x91E0F0000000u } | ((static_cast<std::uint64_t>(macSuffix) * 256u + streamIndex) & 0xFFFFFFu);
+}
+
+std::string makeStreamFormat(std::uint32_t const channels) noexcept
+{
+	return toHexString(StreamFormatBase | (static_cast<std::uint64_t>(channels & 0x3FFu) << 22) | (SamplesPerFrame << 12));
+}
+
+json localizedString(std::uint32_t const index) noexcept
+{
+	return json{ { "index", index }, { "offset", 0 } };
+}
+
+/** Number of stream descriptors per direction (each redundant pair uses 2 descriptors) */
+std::uint32_t streamDescriptorsCount(Options const& options, bool const isRedundant) noexcept
+{
+	return isRedundant ? options.streams * 2u : options.streams;
+}
+
+/** Number of channels of each stream mapped to a cluster */
+std::uint32_t mappedChannelsCount(Options const& options) noexcept
+{
+	return static_cast<std::uint32_t>(static_cast<double>(options.channels) * options.mappingsRatio + 0.5);
+}
+
+/** EntityModelID of the generated entities: entities sharing the same static model must share the same EntityModelID (AEM cache), so it is derived from every option changing the descriptors tree */
+std::uint64_t makeEntityModelID(Options const& options, bool const isRedundant) noexcept
+{
+	// FNV-1a of the model parameters, in the lower 32 bits (the upper ones are the vendor OUI)
+	auto hash = std::uint32_t{ 0x811C9DC5u };
+	for (auto const value : { isRedundant ? 1u : 0u, options.streams, options.channels, options.clusterChannels, mappedChannelsCount(options) })
+	{
+		for (auto byte = 0u; byte < 4u; ++byte)
+		{
+			hash ^= (value >> (byte * 8u)) & 0xFFu;
+			hash *= 0x01000193u;
+		}
+	}
+	return std::uint64_t{ 0x001B92FF00000000u } | hash;
+}
+
+json makeStreamDescriptor(Options const& options, bool const isInput, bool const isRedundant, std::uint32_t const macSuffix, std::uint16_t const streamIndex) noexcept
+{
+	auto const isSecondary = isRedundant && streamIndex >= options.streams;
+	auto const format = makeStreamFormat(options.channels);
+
+	auto stat = json{
+		{ "avb_interface_index", isSecondary ? 1 : 0 },
+		{ "backedup_talker_entity_id", NullEntityID },
+		{ "backedup_talker_unique", 0 },
+		{ "backup_talker_entity_id_0", NullEntityID },
+		{ "backup_talker_entity_id_1", NullEntityID },
+		{ "backup_talker_entity_id_2", NullEntityID },
+		{ "backup_talker_unique_id_0", 0 },
+		{ "backup_talker_unique_id_1", 0 },
+		{ "backup_talker_unique_id_2", 0 },
+		{ "buffer_length", isInput ? 2166000 : 0 },
+		{ "clock_domain_index", 0 },
+		{ "formats", json::array({ format }) },
+		{ "localized_description", localizedString(4u) },
+		{ "stream_flags", isInput ? json::array({ "CLOCK_SYNC_SOURCE", "CLASS_A" }) : json::array({ "CLASS_A" }) },
+	};
+	if (isRedundant)
+	{
+		stat["redundant_streams"] = json::array({ isSecondary ? streamIndex - options.streams : streamIndex + options.streams });
+	}
+
+	auto dynamicInfo = json{
+		{ "acmp_status", "SUCCESS" },
+		{ "are_pdus_encrypted", false },
+		{ "does_support_encrypted", false },
+		{ "flags_ex", nullptr },
+		{ "has_saved_state", false },
+		{ "has_talker_failed", false },
+		{ "is_class_b", false },
+		{ "msrp_accumulated_latency", isInput ? 0 : 2000000 },
+		{ "msrp_failure_code", nullptr },
+		{ "probing_status", 0 },
+		{ "stream_vlan_id", nullptr },
+	};
+
+	auto dynamic = json{
+		{ "object_name", "" },
+		{ "stream_format", format },
+		{ "stream_running", true },
+	};
+
+	if (isInput)
+	{
+		dynamicInfo["last_received_flags"] = json::array({ "MSRP_ACC_LAT_VALID", "STREAM_FORMAT_VALID" });
+		dynamicInfo["stream_id"] = nullptr;
+		dynamic["connected_talker"] = json{ { "entity_id", UnknownEntityID }, { "stream_index", StreamIndexNone } };
+		dynamic["connection_state"] = "NOT_CONNECTED";
+		dynamic["counters"] = json{ { "EARLY_TIMESTAMP", 0 }, { "FRAMES_RX", 0 }, { "LATE_TIMESTAMP", 0 }, { "MEDIA_LOCKED", 0 }, { "MEDIA_RESET", 0 }, { "MEDIA_UNLOCKED", 0 }, { "SEQ_NUM_MISMATCH", 0 }, { "STREAM_INTERRUPTED", 0 }, { "TIMESTAMP_NOT_VALID", 0 }, { "TIMESTAMP_UNCERTAIN", 0 }, { "TIMESTAMP_VALID", 0 }, { "UNSUPPORTED_FORMAT", 0 } };
+	}
+	else
+	{
+		dynamicInfo["last_received_flags"] = json::array({ "MSRP_ACC_LAT_VALID", "STREAM_ID_VALID", "STREAM_FORMAT_VALID" });
+		dynamicInfo["stream_dest_mac"] = macAddressToString(makeStreamDestMac(macSuffix, streamIndex));
+		dynamicInfo["stream_id"] = toHexString(makeStreamID(macSuffix, streamIndex));
+		dynamic["counters"] = json{ { "FRAMES_TX", 0 }, { "MEDIA_RESET", 0 }, { "STREAM_START", 0 }, { "STREAM_STOP", 0 }, { "TIMESTAMP_UNCERTAIN", 0 } };
+	}
+	dynamic["stream_dynamic_info"] = std::move(dynamicInfo);
+
+	return json{ { "_index (informative)", streamIndex }, { "dynamic", std::move(dynamic) }, { "static", std::move(stat) } };
+}
+
+json makeStreamPortDescriptor(Options const& options, bool const isRedundant, std::uint32_t const portIndex, std::uint32_t const baseCluster) noexcept
+{
+	auto const channelsPerEntity = options.streams * options.channels;
+	auto const clustersCount = (channelsPerEntity + options.clusterChannels - 1u) / options.clusterChannels;
+	auto const mappedChannels = mappedChannelsCount(options);
+
+	auto clusters = json::array();
+	for (auto cluster = 0u; cluster < clustersCount; ++cluster)
+	{
+		clusters.push_back(json{
+			{ "_index (informative)", baseCluster + cluster },
+			{ "dynamic", json{ { "object_name", "" } } },
+			{ "static", json{ { "block_latency", 0 }, { "channel_count", std::min(options.clusterChannels, channelsPerEntity - cluster * options.clusterChannels) }, { "format", "MBLA" }, { "localized_description", localizedString(5u) }, { "path_latency", 0 }, { "signal_index", 0 }, { "signal_output", 0 }, { "signal_type", "INVALID" } } },
+		});
+	}
+
+	auto mappings = json::array();
+	for (auto stream = 0u; stream < options.streams; ++stream)
+	{
+		for (auto channel = 0u; channel < mappedChannels; ++channel)
+		{
+			auto const globalChannel = stream * options.channels + channel;
+			auto const mapping = json{ { "cluster_channel", globalChannel % options.clusterChannels }, { "cluster_offset", globalChannel / options.clusterChannels }, { "stream_channel", channel }, { "stream_index", stream } };
+			mappings.push_back(mapping);
+			if (isRedundant)
+			{
+				auto secondaryMapping = mapping;
+				secondaryMapping["stream_index"] = stream + options.streams;
+				mappings.push_back(std::move(secondaryMapping));
+			}
+		}
+	}
+
+	return json{
+		{ "_index (informative)", portIndex },
+		{ "audio_cluster_descriptors", std::move(clusters) },
+		{ "audio_map_descriptors", nullptr },
+		{ "dynamic", json{ { "dynamic_mappings", std::move(mappings) } } },
+		{ "static", json{ { "clock_domain_index", 0 }, { "flags", json::array({ "CLOCK_SYNC_SOURCE", "SYNC_SAMPLE_RATE_CONV" }) } } },
+	};
+}
+
+json makeAvbInterfaceDescriptor(std::uint32_t const index, std::uint32_t const macSuffix, std::uint64_t const grandmasterID) noexcept
+{
+	auto const clockIdentity = toHexString(makeEntityID(macSuffix));
+	return json{
+		{ "_index (informative)", index },
+		{ "dynamic", json{ { "as_path", json::array({ toHexString(grandmasterID), clockIdentity }) }, { "avb_interface_info", json{ { "flags", json::array({ "AS_CAPABLE", "GPTP_ENABLED", "SRP_ENABLED" }) }, { "msrp_mappings", json::array({ json{ { "priority", 3 }, { "traffic_class", 6 }, { "vlan_id", 2 } } }) }, { "propagation_delay", 0 } } }, { "counters", json{ { "GPTP_GM_CHANGED", 1 }, { "LINK_DOWN", 0 }, { "LINK_UP", 1 } } }, { "gptp_domain_number", 0 }, { "gptp_grandmaster_id", toHexString(grandmasterID) }, { "object_name", "" } } },
+		{ "static", json{ { "clock_accuracy", 34 }, { "clock_class", 248 }, { "clock_identity", clockIdentity }, { "domain_number", 0 }, { "flags", json::array({ "GPTP_GRANDMASTER_SUPPORTED", "GPTP_SUPPORTED", "SRP_SUPPORTED" }) }, { "localized_description", localizedString(6u) }, { "log_announce_interval", 0 }, { "log_pdelay_interval", 0 }, { "log_sync_interval", 253 }, { "mac_address", macAddressToString(makeMacAddress(macSuffix)) }, { "offset_scaled_log_variance", 17258 }, { "port_number", 1 }, { "priority1", 248 }, { "priority2", 248 } } },
+	};
+}
+
+json makeEntity(Options const& options, std::uint32_t const entityIndex, EntityInfo const& info, std::uint64_t const grandmasterID) noexcept
+{
+	auto const entityID = toHexString(makeEntityID(info.macSuffix));
+	auto const entityModelID = toHexString(makeEntityModelID(options, info.isRedundant));
+	auto const streamsCount = streamDescriptorsCount(options, info.isRedundant);
+	auto const interfacesCount = info.isRedundant ? 2u : 1u;
+
+	// ADP
+	auto adpInterfaces = json::array();
+	for (auto i = 0u; i < interfacesCount; ++i)
+	{
+		adpInterfaces.push_back(json{ { "available_index", 1 }, { "avb_interface_index", i }, { "gptp_domain_number", 0 }, { "gptp_grandmaster_id", toHexString(grandmasterID) }, { "mac_address", macAddressToString(makeMacAddress(info.macSuffix + i)) }, { "valid_time", 10 } });
+	}
+	auto const adp = json{
+		{ "common", json{ { "association_id", nullptr }, { "controller_capabilities", nullptr }, { "entity_capabilities", json::array({ "AEM_SUPPORTED", "CLASS_A_SUPPORTED", "GPTP_SUPPORTED", "AEM_IDENTIFY_CONTROL_INDEX_VALID", "AEM_INTERFACE_INDEX_VALID" }) }, { "entity_id", entityID }, { "entity_model_id", entityModelID }, { "identify_control_index", 0 }, { "listener_capabilities", json::array({ "IMPLEMENTED", "MEDIA_CLOCK_SINK", "AUDIO_SINK" }) }, { "listener_stream_sinks", streamsCount }, { "talker_capabilities", json::array({ "IMPLEMENTED", "MEDIA_CLOCK_SOURCE", "AUDIO_SOURCE" }) }, { "talker_stream_sources", streamsCount } } },
+		{ "interfaces", std::move(adpInterfaces) },
+	};
+
+	// Configuration
+	auto streamInputs = json::array();
+	auto streamOutputs = json::array();
+	for (auto i = 0u; i < streamsCount; ++i)
+	{
+		streamInputs.push_back(makeStreamDescriptor(options, true, info.isRedundant, info.macSuffix, static_cast<std::uint16_t>(i)));
+		streamOutputs.push_back(makeStreamDescriptor(options, false, info.isRedundant, info.macSuffix, static_cast<std::uint16_t>(i)));
+	}
+
+	auto avbInterfaces = json::array();
+	for (auto i = 0u; i < interfacesCount; ++i)
+	{
+		avbInterfaces.push_back(makeAvbInterfaceDescriptor(i, info.macSuffix + i, grandmasterID));
+	}
+
+	// One INTERNAL clock source, then one per stream input
+	auto clockSources = json::array({ json{ { "_index (informative)", 0 }, { "dynamic", json{ { "clock_source_flags", nullptr }, { "clock_source_identifier", NullEntityID }, { "object_name", "" } } }, { "static", json{ { "clock_source_location_index", 0 }, { "clock_source_location_type", "AUDIO_UNIT" }, { "clock_source_type", "INTERNAL" }, { "localized_description", localizedString(3u) } } } } });
+	auto clockSourceIndexes = json::array({ 0 });
+	for (auto i = 0u; i < streamsCount; ++i)
+	{
+		clockSources.push_back(json{ { "_index (informative)", i + 1u }, { "dynamic", json{ { "clock_source_flags", json::array({ "LOCAL_ID" }) }, { "clock_source_identifier", NullEntityID }, { "object_name", "" } } }, { "static", json{ { "clock_source_location_index", i }, { "clock_source_location_type", "STREAM_INPUT" }, { "clock_source_type", "INPUT_STREAM" }, { "localized_description", localizedString(4u) } } } });
+		clockSourceIndexes.push_back(i + 1u);
+	}
+	auto const clockDomain = json{ { "_index (informative)", 0 }, { "dynamic", json{ { "clock_source_index", 0 }, { "counters", json{ { "LOCKED", 1 }, { "UNLOCKED", 0 } } }, { "object_name", "" } } }, { "static", json{ { "clock_sources", std::move(clockSourceIndexes) }, { "localized_description", localizedString(3u) } } } };
+
+	auto const clustersCount = (options.streams * options.channels + options.clusterChannels - 1u) / options.clusterChannels;
+	auto const audioUnit = json{
+		{ "_index (informative)", 0 },
+		{ "dynamic", json{ { "current_sampling_rate", SamplingRate }, { "object_name", "" } } },
+		{ "static", json{ { "clock_domain_index", 0 }, { "localized_description", localizedString(3u) }, { "sampling_rates", json::array({ SamplingRate }) } } },
+		{ "stream_port_input_descriptors", json::array({ makeStreamPortDescriptor(options, info.isRedundant, 0u, 0u) }) },
+		{ "stream_port_output_descriptors", json::array({ makeStreamPortDescriptor(options, info.isRedundant, 0u, clustersCount) }) },
+	};
+
+	auto const identifyControl = json{
+		{ "_index (informative)", 0 },
+		{ "dynamic", json{ { "object_name", "" }, { "values", json{ { "type", "CONTROL_LINEAR_UINT8" }, { "values", json::array({ 0 }) } } } } },
+		{ "static", json{ { "block_latency", 0 }, { "control_domain", 0 }, { "control_latency", 0 }, { "control_type", "0x90E0F00000000001" }, { "control_value_type", json{ { "read_only", false }, { "unknown", false }, { "value_type", "CONTROL_LINEAR_UINT8" } } }, { "localized_description", localizedString(2u) }, { "reset_time", 0 }, { "signal_index", 0 }, { "signal_output", 0 }, { "signal_type", "INVALID" }, { "values", json{ { "type", "CONTROL_LINEAR_UINT8" }, { "values", json::array({ json{ { "default", 0 }, { "maximum", 255 }, { "minimum", 0 }, { "step", 255 }, { "string", nullptr }, { "unit", json{ { "code", "UNITLESS" }, { "multiplier", 0 } } } } }) } } } } },
+	};
+
+	auto const locale = json{
+		{ "_index (informative)", 0 },
+		{ "static", json{ { "_base_string_descriptor (informative)", 0 }, { "locale_id", "en-US" } } },
+		{ "strings_descriptors", json::array({ json{ { "_index (informative)", 0 }, { "static", json{ { "strings", json::array({ "Hive", "Generated Entity", "Identify", "Audio Unit", "Stream", "Channel", "AVB Interface" }) } } } } }) },
+	};
+
+	auto const configuration = json{
+		{ "_index (informative)", 0 },
+		{ "audio_unit_descriptors", json::array({ audioUnit }) },
+		{ "avb_interface_descriptors", std::move(avbInterfaces) },
+		{ "clock_domain_descriptors", json::array({ clockDomain }) },
+		{ "clock_source_descriptors", std::move(clockSources) },
+		{ "control_descriptors", json::array({ identifyControl }) },
+		{ "dynamic", json{ { "object_name", "" } } },
+		{ "locale_descriptors", json::array({ locale }) },
+		{ "static", json{ { "localized_description", localizedString(1u) } } },
+		{ "stream_input_descriptors", std::move(streamInputs) },
+		{ "stream_output_descriptors", std::move(streamOutputs) },
+	};
+
+	auto const entityName = std::string{ info.level == 0u ? "Talker " : "Listener " } + std::to_string(entityIndex + 1u);
+
+	return json{
+		{ "adp_information", adp },
+		{ "compatibility_flags", json::array({ "IEEE17221", "MILAN" }) },
+		{ "diagnostics", json{ { "redundancy_warning", false }, { "stream_input_latency_errors", json::array() } } },
+		{ "dump_version", 1 },
+		{ "entity_model", json{ { "entity_descriptor", json{ { "configuration_descriptors", json::array({ configuration }) }, { "dynamic", json{ { "counters", json::object() }, { "current_configuration", 0 }, { "entity_name", entityName }, { "firmware_version", "1.0.0" }, { "group_name", "" }, { "serial_number", std::to_string(entityIndex + 1u) } } }, { "static", json{ { "model_name_string", localizedString(1u) }, { "vendor_name_string", localizedString(0u) } } } } } } },
+		{ "entity_model_id", entityModelID },
+		{ "milan_information", json{ { "certification_version", "0.0.0.0" }, { "flags", info.isRedundant ? json::array({ "REDUNDANCY" }) : json(nullptr) }, { "protocol_version", 1 } } },
+		{ "state", json{ { "acquire_state", "NOT_SUPPORTED" }, { "active_configuration", 0 }, { "lock_state", "NOT_LOCKED" }, { "locking_controller_id", UnknownEntityID }, { "owning_controller_id", UnknownEntityID }, { "subscribed_unsol", true } } },
+		{ "statistics", json{ { "aecp_response_average_time", 0 }, { "aecp_retry_counter", 0 }, { "aecp_timeout_counter", 0 }, { "aecp_unexpected_response_counter", 0 }, { "aem_aecp_unsolicited_counter", 0 }, { "enumeration_time", 0 } } },
+	};
+}
+
+/** Connects the listener stream input to the talker stream output (updating the listener's dynamic model) */
+void connectStream(EntityInfo& listener, std::uint16_t const listenerStreamIndex, EntityInfo const& talker, std::uint16_t const talkerStreamIndex) noexcept
+{
+	auto& dynamic = listener.entity["entity_model"]["entity_descriptor"]["configuration_descriptors"][0]["stream_input_descriptors"][listenerStreamIndex]["dynamic"];
+	dynamic["connected_talker"] = json{ { "entity_id", toHexString(makeEntityID(talker.macSuffix)) }, { "stream_index", talkerStreamIndex } };
+	dynamic["connection_state"] = "CONNECTED";
+	dynamic["counters"]["MEDIA_LOCKED"] = 1;
+
+	auto& info = dynamic["stream_dynamic_info"];
+	info["flags_ex"] = json::array({ "REGISTERING" });
+	info["has_saved_state"] = true;
+	info["last_received_flags"] = json::array({ "FAST_CONNECT", "SAVED_STATE", "STREAM_VLAN_ID_VALID", "CONNECTED", "STREAM_DEST_MAC_VALID", "MSRP_ACC_LAT_VALID", "STREAM_ID_VALID", "STREAM_FORMAT_VALID" });
+	info["msrp_accumulated_latency"] = 763772;
+	info["probing_status"] = 3;
+	info["stream_dest_mac"] = macAddressToString(makeStreamDestMac(talker.macSuffix, talkerStreamIndex));
+	info["stream_id"] = toHexString(makeStreamID(talker.macSuffix, talkerStreamIndex));
+	info["stream_vlan_id"] = 2;
+}
+
+/** Connects a (possibly redundant) listener stream to a (possibly redundant) talker stream */
+void connectLogicalStream(Options const& options, EntityInfo& listener, std::uint16_t const listenerStream, EntityInfo const& talker, std::uint16_t const talkerStream) noexcept
+{
+	connectStream(listener, listenerStream, talker, talkerStream);
+	// Both redundant: also connect the secondary streams
+	if (listener.isRedundant && talker.isRedundant)
+	{
+		connectStream(listener, static_cast<std::uint16_t>(listenerStream + options.streams), talker, static_cast<std::uint16_t>(talkerStream + options.streams));
+	}
+}
+
+void setClockSource(EntityInfo& entity, std::uint16_t const clockSourceIndex) noexcept
+{
+	entity.entity["entity_model"]["entity_descriptor"]["configuration_descriptors"][0]["clock_domain_descriptors"][0]["dynamic"]["clock_source_index"] = clockSourceIndex;
+}
+
+bool parseUnsigned(char const* const value, std::uint32_t& result) noexcept
+{
+	try
+	{
+		auto pos = std::size_t{ 0u };
+		auto const v = std::stoul(value, &pos);
+		if (value[pos] != '\0')
+		{
+			return false;
+		}
+		result = static_cast<std::uint32_t>(v);
+		return true;
+	}
+	catch (...)
+	{
+		return false;
+	}
+}
+
+bool parseRatio(char const* const value, double& result) noexcept
+{
+	try
+	{
+		auto pos = std::size_t{ 0u };
+		auto const v = std::stod(value, &pos);
+		if (value[pos] != '\0' || v < 0.0 || v > 1.0)
+		{
+			return false;
+		}
+		result = v;
+		return true;
+	}
+	catch (...)
+	{
+		return false;
+	}
+}
+
+void printUsage() noexcept
+{
+	std::cout << "Usage: [options] <Output File (*.ans;*.json)>" << std::endl;
+	std::cout << "Options:" << std::endl;
+	std::cout << "  --talkers <count>            Number of talkers, clocked internally (default 10)" << std::endl;
+	std::cout << "  --listeners <count>          Number of listeners (default 100)" << std::endl;
+	std::cout << "  --redundant <ratio>          Ratio of redundant entities, from 0 to 1 (default 0)" << std::endl;
+	std::cout << "  --streams <count>            Number of audio streams (or redundant pairs) per direction and entity (default 4)" << std::endl;
+	std::cout << "  --channels <count>           Number of channels per stream (default 8)" << std::endl;
+	std::cout << "  --cluster-channels <count>   Number of channels per audio cluster (default 1)" << std::endl;
+	std::cout << "  --mappings <ratio>           Ratio of stream channels having an audio mapping, from 0 to 1 (default 1)" << std::endl;
+	std::cout << "  --density <ratio>            Ratio of connected listener streams, from 0 to 1 (default 0.5)" << std::endl;
+	std::cout << "  --clock-chain <length>       Length of media clock chains, listeners being clocked by the previous listener of the chain (default 1)" << std::endl;
+	std::cout << "  --seed <value>               Random seed (default 0)" << std::endl;
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) noexcept
+{
+	for (auto i = 1; i < argc; ++i)
+	{
+		auto const arg = std::string{ argv[i] };
+		if (arg.rfind("--", 0) != 0)
+		{
+			if (!options.outputFile.empty())
+			{
+				return false;
+			}
+			options.outputFile = arg;
+			continue;
+		}
+		if (i + 1 >= argc)
+		{
+			std::cout << "Missing value for option " << arg << std::endl;
+			return false;
+		}
+		auto const* const value = argv[++i];
+		auto ok = false;
+		if (arg == "--talkers")
+			ok = parseUnsigned(value, options.talkers);
+		else if (arg == "--listeners")
+			ok = parseUnsigned(value, options.listeners);
+		else if (arg == "--redundant")
+			ok = parseRatio(value, options.redundantRatio);
+		else if (arg == "--streams")
+			ok = parseUnsigned(value, options.streams) && options.streams > 0u && options.streams < 0x7FFFu;
+		else if (arg == "--channels")
+			ok = parseUnsigned(value, options.channels) && options.channels > 0u && options.channels <= 0x3FFu;
+		else if (arg == "--cluster-channels")
+			ok = parseUnsigned(value, options.clusterChannels) && options.clusterChannels > 0u;
+		else if (arg == "--mappings")
+			ok = parseRatio(value, options.mappingsRatio);
+		else if (arg == "--density")
+			ok = parseRatio(value, options.connectionDensity);
+		else if (arg == "--clock-chain")
+			ok = parseUnsigned(value, options.clockChainLength) && options.clockChainLength > 0u;
+		else if (arg == "--seed")
+			ok = parseUnsigned(value, options.seed);
+		else
+		{
+			std::cout << "Unknown option " << arg << std::endl;
+			return false;
+		}
+		if (!ok)
+		{
+			std::cout << "Invalid value for option " << arg << ": " << value << std::endl;
+			return false;
+		}
+	}
+	return !options.outputFile.empty() && options.talkers > 0u && (options.talkers + options.listeners) <= MaxEntities;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	auto options = Options{};
+	if (!parseOptions(argc, argv, options))
+	{
+		printUsage();
+		return 1;
+	}
+
+	auto randomGenerator = std::mt19937{ options.seed };
+	auto uniform = std::uniform_real_distribution<double>{ 0.0, 1.0 };
+
+	// Create all entities: talkers first, then listeners distributed among the levels of the media clock chains
+	auto const entitiesCount = options.talkers + options.listeners;
+	auto entities = std::vector<EntityInfo>(entitiesCount);
+	auto levels = std::vector<std::vector<std::uint32_t>>(options.clockChainLength + 1u);
+	for (auto index = 0u; index < entitiesCount; ++index)
+	{
+		auto& info = entities[index];
+		info.macSuffix = 0x100000u + index * 2u;
+		info.isRedundant = uniform(randomGenerator) < options.redundantRatio;
+		info.level = index < options.talkers ? 0u : 1u + ((index - options.talkers) % options.clockChainLength);
+		levels[info.level].push_back(index);
+	}
+
+	// The first talker is the gPTP grandmaster
+	auto const grandmasterID = makeEntityID(entities[0].macSuffix);
+	for (auto index = 0u; index < entitiesCount; ++index)
+	{
+		entities[index].entity = makeEntity(options, index, entities[index], grandmasterID);
+	}
+
+	// Connect listeners to entities of the previous level. The first stream is always connected (when there is a source) so it can be used as media clock
+	auto connectionsCount = std::size_t{ 0u };
+	for (auto level = 1u; level < levels.size(); ++level)
+	{
+		auto const& sources = levels[level - 1u];
+		if (sources.empty())
+		{
+			continue;
+		}
+		auto pickSource = std::uniform_int_distribution<std::size_t>{ 0u, sources.size() - 1u };
+		auto pickStream = std::uniform_int_distribution<std::uint32_t>{ 0u, options.streams - 1u };
+
+		for (auto const listenerIndex : levels[level])
+		{
+			auto& listener = entities[listenerIndex];
+			for (auto stream = 0u; stream < options.streams; ++stream)
+			{
+				if (stream != 0u && uniform(randomGenerator) >= options.connectionDensity)
+				{
+					continue;
+				}
+				if (stream == 0u && options.connectionDensity == 0.0)
+				{
+					continue;
+				}
+				auto const& talker = entities[sources[pickSource(randomGenerator)]];
+				connectLogicalStream(options, listener, static_cast<std::uint16_t>(stream), talker, static_cast<std::uint16_t>(pickStream(randomGenerator)));
+				++connectionsCount;
+
+				// Use the first stream as media clock source (clock source index 0 is INTERNAL)
+				if (stream == 0u)
+				{
+					setClockSource(listener, 1u);
+				}
+			}
+		}
+	}
+
+	// Build the network state
+	auto networkState = json{ { "_dump_source (informative)", "Hive ANS Generator" }, { "dump_version", 1 }, { "entities", json::array() } };
+	auto& entitiesArray = networkState["entities"];
+	for (auto& info : entities)
+	{
+		entitiesArray.push_back(std::move(info.entity));
+	}
+
+	// Try to open the output file
+	auto ofs = std::ofstream{ options.outputFile, std::ios::binary | std::ios::out };
+
+	// Failed to open file to writting
+	if (!ofs.is_open())
+	{
+		std::cout << "Cannot open output file '" << options.outputFile << "': " << std::strerror(errno) << std::endl;
+		return 3;
+	}
+
+	// Human readable JSON if requested, MessagePack otherwise
+	auto const isJson = options.outputFile.size() >= 5 && options.outputFile.compare(options.outputFile.size() - 5, 5, ".json") == 0;
+	if (isJson)
+	{
+		ofs << networkState.dump(4);
+	}
+	else
+	{
+		auto const binary = json::to_msgpack(networkState);
+		ofs.write(reinterpret_cast<char const*>(binary.data()), binary.size() * sizeof(decltype(binary)::value_type));
+	}
+
+	std::cout << "Successfully generated " << entitiesCount << " entities (" << options.talkers << " talkers, " << options.listeners << " listeners) with " << connectionsCount << " stream connections" << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,170 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "daemon.hpp"
+#include "config.hpp"
+#include "avdecc/channelConnectionManager.hpp"
+#include "avdecc/hiveLogItems.hpp"
+#include "avdecc/mcDomainManager.hpp"
+
+#include <hive/modelsLibrary/controllerManager.hpp>
+#include <hive/modelsLibrary/helper.hpp>
+
+#include <QFile>
+#include <QFileInfo>
+
+namespace
+{
+la::avdecc::entity::model::jsonSerializer::Flags const LoadFlags{ la::avdecc::entity::model::jsonSerializer::Flag::ProcessADP, la::avdecc::entity::model::jsonSerializer::Flag::ProcessCompatibility, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDynamicModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessMilan, la::avdecc::entity::model::jsonSerializer::Flag::ProcessState, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStaticModel, la::avdecc::entity::model::jsonSerializer::Flag::ProcessStatistics, la::avdecc::entity::model::jsonSerializer::Flag::ProcessDiagnostics };
+auto constexpr ChangesFlushInterval = std::chrono::milliseconds{ 250 };
+
+QString dumpSource() noexcept
+{
+	static auto s_DumpSource = QString{ "%1 v%2 using L-Acoustics AVDECC Controller v%3" }.arg(hived::internals::applicationShortName).arg(hived::internals::versionString).arg(la::avdecc::controller::getVersion().c_str());
+
+	return s_DumpSource;
+}
+
+} // namespace
+
+/* ************************************************************ */
+/* Daemon                                                       */
+/* ************************************************************ */
+Daemon::Daemon(Configuration const& configuration, QObject* parent)
+	: QObject{ parent }
+	, _configuration{ configuration }
+{
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+
+	// Only write a snapshot when something changed since the previous one
+	connect(&manager, &hive::modelsLibrary::ControllerManager::entitiesChangedBatch, this,
+		[this](hive::modelsLibrary::ControllerManager::EntitiesChangedBatch const& changes)
+		{
+			if (!changes.empty())
+			{
+				_isDirty = true;
+			}
+		});
+
+	connect(&_snapshotTimer, &QTimer::timeout, this, &Daemon::writeSnapshot);
+}
+
+Daemon::~Daemon()
+{
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+	manager.setEnableCoalescedNotifications(false);
+}
+
+bool Daemon::start() noexcept
+{
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+
+	try
+	{
+		manager.createController(_configuration.protocolType, _configuration.interfaceID, _configuration.progID, la::avdecc::UniqueIdentifier::getNullUniqueIdentifier(), "en", nullptr);
+	}
+	catch (la::avdecc::controller::Controller::Exception const& e)
+	{
+		LOG_HIVE_ERROR(QString("Cannot create controller: %1").arg(e.what()));
+#ifdef __linux__
+		if (e.getError() == la::avdecc::controller::Controller::Error::InterfaceOpenError)
+		{
+			LOG_HIVE_INFO("Make sure hived is allowed to use RAW SOCKETS: sudo setcap cap_net_raw+ep hived");
+		}
+#endif // __linux__
+		return false;
+	}
+
+	LOG_HIVE_INFO(QString("Controller %1 running on %2").arg(hive::modelsLibrary::helper::uniqueIdentifierToString(manager.getControllerEID())).arg(_configuration.interfaceID));
+
+	// Instantiate the managers so they start tracking the network right now
+	avdecc::ChannelConnectionManager::getInstance();
+	avdecc::mediaClock::MCDomainManager::getInstance();
+
+	// All changes to the network are marked through the coalesced notifications, no need for a fine-grained dirty tracking
+	manager.setEnableCoalescedNotifications(true, ChangesFlushInterval);
+
+	for (auto const& filePath : _configuration.filesToLoad)
+	{
+		loadFile(filePath);
+	}
+
+	if (!_configuration.snapshotFilePath.isEmpty())
+	{
+		_snapshotTimer.start(std::chrono::duration_cast<std::chrono::milliseconds>(_configuration.snapshotInterval));
+	}
+
+	return true;
+}
+
+void Daemon::writeSnapshot() noexcept
+{
+	if (_configuration.snapshotFilePath.isEmpty() || !_isDirty)
+	{
+		return;
+	}
+
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+	auto flags = la::avdecc::entity::model::jsonSerializer::Flags{ LoadFlags };
+	if (_configuration.binarySnapshot)
+	{
+		flags.set(la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat);
+	}
+
+	// Serialize to a temporary file first so readers never see a partially written snapshot
+	auto const tempFilePath = _configuration.snapshotFilePath + ".tmp";
+	auto const [error, message] = manager.serializeAllControlledEntitiesAsJson(tempFilePath, flags, dumpSource());
+	if (!!error && error != la::avdecc::jsonSerializer::SerializationError::Incomplete)
+	{
+		LOG_HIVE_ERROR(QString("Failed to write snapshot: %1").arg(message.c_str()));
+		QFile::remove(tempFilePath);
+		return;
+	}
+
+	QFile::remove(_configuration.snapshotFilePath);
+	if (!QFile::rename(tempFilePath, _configuration.snapshotFilePath))
+	{
+		LOG_HIVE_ERROR(QString("Failed to replace snapshot file: %1").arg(_configuration.snapshotFilePath));
+		return;
+	}
+
+	_isDirty = false;
+
+	auto domains = avdecc::mediaClock::MCDomainManager::getInstance().createMediaClockDomainModel();
+	auto const mediaClockDomainsCount = domains.getMediaClockDomains().size();
+	LOG_HIVE_INFO(QString("Snapshot written: %1 entities, %2 media clock domains%3").arg(_entitiesModel.model().entitiesCount()).arg(mediaClockDomainsCount).arg(error == la::avdecc::jsonSerializer::SerializationError::Incomplete ? " (some entities are incomplete)" : ""));
+}
+
+void Daemon::loadFile(QString const& filePath) noexcept
+{
+	auto& manager = hive::modelsLibrary::ControllerManager::getInstance();
+	auto const ext = QFileInfo{ filePath }.suffix();
+
+	auto flags = la::avdecc::entity::model::jsonSerializer::Flags{ LoadFlags };
+	if (ext != "json")
+	{
+		flags.set(la::avdecc::entity::model::jsonSerializer::Flag::BinaryFormat);
+	}
+
+	auto const [error, message] = (ext == "ave") ? manager.loadVirtualEntityFromJson(filePath, flags) : manager.loadVirtualEntitiesFromJsonNetworkState(filePath, flags);
+	if (!!error)
+	{
+		LOG_HIVE_WARN(QString("[%1] Error loading file: %2").arg(filePath).arg(message.c_str()));
+	}
+}
@@ -0,0 +1,64 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <hive/modelsLibrary/discoveredEntitiesModel.hpp>
+#include <la/avdecc/controller/avdeccController.hpp>
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+
+#include <chrono>
+#include <cstdint>
+
+/** Headless controller: keeps the models up-to-date and periodically writes a snapshot of the network state */
+class Daemon : public QObject
+{
+public:
+	struct Configuration
+	{
+		la::avdecc::protocol::ProtocolInterface::Type protocolType{ la::avdecc::protocol::ProtocolInterface::Type::None };
+		QString interfaceID{};
+		std::uint16_t progID{ 1u };
+		QStringList filesToLoad{}; /**< Network State (.ans) and Virtual Entity (.ave) files to load once the controller is created */
+		QString snapshotFilePath{}; /**< Empty to disable snapshots */
+		std::chrono::seconds snapshotInterval{ 60 };
+		bool binarySnapshot{ true }; /**< Compact (MessagePack) snapshot instead of human readable JSON */
+	};
+
+	Daemon(Configuration const& configuration, QObject* parent = nullptr);
+	~Daemon();
+
+	/** Creates the controller and starts the snapshot timer. Returns false if the controller cannot be created. */
+	bool start() noexcept;
+
+	/** Immediately writes a snapshot of the network state, if it changed since the last one */
+	void writeSnapshot() noexcept;
+
+private:
+	void loadFile(QString const& filePath) noexcept;
+
+	Configuration const _configuration{};
+	hive::modelsLibrary::HeadlessDiscoveredEntitiesModel _entitiesModel{}; /**< Only used to keep the computed entity information alive */
+	QTimer _snapshotTimer{};
+	bool _isDirty{ true };
+};
@@ -0,0 +1,247 @@
+/*
+* Copyright (C) 2017-2025, Emilien Vallot, Christophe Calmejane and other contributors
+
+* This file is part of Hive.
+
+* Hive is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+
+* Hive is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+
+* You should have received a copy of the GNU Lesser General Public License
+* along with Hive.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <la/avdecc/utils.hpp>
+#include <la/avdecc/logger.hpp>
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTimer>
+#include <QtGlobal>
+
+#include <csignal>
+#include <iostream>
+#include <chrono>
+#include <map>
+#include <optional>
+
+#include "daemon.hpp"
+#include "config.hpp"
+
+#include <hive/modelsLibrary/controllerManager.hpp>
+
+static QtMessageHandler previousHandler = nullptr;
+static void qtMessageHandler(QtMsgType msgType, QMessageLogContext const& logContext, QString const& message)
+{
+	if (msgType == QtMsgType::QtFatalMsg)
+	{
+		AVDECC_ASSERT_WITH_RET(false, message.toStdString());
+	}
+	previousHandler(msgType, logContext, message);
+}
+
+// Only async-signal-safe operations are allowed in a signal handler, the flag is polled from the event loop
+static volatile std::sig_atomic_t s_TerminationRequested = 0;
+static void signalHandler(int /*signal*/)
+{
+	s_TerminationRequested = 1;
+}
+
+/** Forwards the avdecc log items to the standard error output */
+class ConsoleLogger final : public la::avdecc::logger::Logger::Observer
+{
+public:
+	ConsoleLogger()
+	{
+		la::avdecc::logger::Logger::getInstance().registerObserver(this);
+	}
+
+	~ConsoleLogger()
+	{
+		la::avdecc::logger::Logger::getInstance().unregisterObserver(this);
+	}
+
+private:
+	virtual void onLogItem(la::avdecc::logger::Level const level, la::avdecc::logger::LogItem const* const item) noexcept override
+	{
+		std::cerr << "[" << levelToString(level) << "] " << item->getMessage() << std::endl;
+	}
+
+	static char const* levelToString(la::avdecc::logger::Level const level) noexcept
+	{
+		switch (level)
+		{
+			case la::avdecc::logger::Level::Trace:
+				return "Trace";
+			case la::avdecc::logger::Level::Debug:
+				return "Debug";
+			case la::avdecc::logger::Level::Info:
+				return "Info";
+			case la::avdecc::logger::Level::Warn:
+				return "Warning";
+			case la::avdecc::logger::Level::Error:
+				return "Error";
+			default:
+				return "Unknown";
+		}
+	}
+};
+
+static std::optional<la::avdecc::protocol::ProtocolInterface::Type> protocolTypeFromString(QString const& name) noexcept
+{
+	static auto const s_Types = std::map<QString, la::avdecc::protocol::ProtocolInterface::Type>{
+		{ "pcap", la::avdecc::protocol::ProtocolInterface::Type::PCap },
+		{ "macos", la::avdecc::protocol::ProtocolInterface::Type::MacOSNative },
+		{ "proxy", la::avdecc::protocol::ProtocolInterface::Type::Proxy },
+		{ "virtual", la::avdecc::protocol::ProtocolInterface::Type::Virtual },
+		{ "serial", la::avdecc::protocol::ProtocolInterface::Type::Serial },
+		{ "local", la::avdecc::protocol::ProtocolInterface::Type::Local },
+	};
+
+	if (auto const it = s_Types.find(name.toLower()); it != s_Types.end())
+	{
+		if (la::avdecc::protocol::ProtocolInterface::getSupportedProtocolInterfaceTypes().test(it->second))
+		{
+			return it->second;
+		}
+	}
+	return std::nullopt;
+}
+
+int main(int argc, char* argv[])
+{
+	// Replace Qt Message Handler
+	previousHandler = qInstallMessageHandler(&qtMessageHandler);
+
+	QCoreApplication::setOrganizationDomain(hived::internals::companyDomain);
+	QCoreApplication::setOrganizationName(hived::internals::companyName);
+	QCoreApplication::setApplicationName(hived::internals::applicationShortName);
+	QCoreApplication::setApplicationVersion(hived::internals::versionString);
+
+	// Create the Qt Application (no GUI)
+	QCoreApplication app(argc, argv);
+
+	// Parse command line
+	auto parser = QCommandLineParser{};
+	parser.setApplicationDescription(hived::internals::applicationLongName);
+	auto const protocolOption = QCommandLineOption{ { "p", "protocol" }, "Protocol interface type (pcap, macos, proxy, virtual, serial, local)", "Protocol", "pcap" };
+	auto const interfaceOption = QCommandLineOption{ { "i", "interface" }, "Network interface to use (not required for the virtual protocol)", "Interface" };
+	auto const progIDOption = QCommandLineOption{ "prog-id", "Controller ProgID, to run multiple controllers on the same computer", "ProgID", "1" };
+	auto const snapshotOption = QCommandLineOption{ { "o", "snapshot" }, "Periodically write the network state to the specified file (.ans, or .json for a human readable one)", "Network State" };
+	auto const snapshotIntervalOption = QCommandLineOption{ "snapshot-interval", "Interval between two snapshots of the network state, in seconds", "Seconds", "60" };
+	auto const ansFilesOption = QCommandLineOption{ "ans", "Load the specified ATDECC Network State (.ans)", "Network State" };
+	auto const aveFilesOption = QCommandLineOption{ "ave", "Load the specified ATDECC Virtual Entity (.ave)", "Virtual Entity" };
+	auto const verboseOption = QCommandLineOption{ { "v", "verbose" }, "Also log debug and trace messages" };
+	parser.addOption(protocolOption);
+	parser.addOption(interfaceOption);
+	parser.addOption(progIDOption);
+	parser.addOption(snapshotOption);
+	parser.addOption(snapshotIntervalOption);
+	parser.addOption(ansFilesOption);
+	parser.addOption(aveFilesOption);
+	parser.addOption(verboseOption);
+	parser.addHelpOption();
+	parser.addVersionOption();
+
+	parser.process(app);
+
+	// Runtime sanity check on Avdecc Library compilation options
+	{
+		auto const options = la::avdecc::getCompileOptions();
+		if (!options.test(la::avdecc::CompileOption::EnableRedundancy))
+		{
+			std::cerr << "Avdecc Library was not compiled with Redundancy feature, which is required by " << hived::internals::applicationShortName.toStdString() << std::endl;
+			return 1;
+		}
+	}
+
+	// Runtime sanity check on Avdecc Controller Library compilation options
+	{
+		auto const options = la::avdecc::controller::getCompileOptions();
+		if (!options.test(la::avdecc::controller::CompileOption::EnableRedundancy))
+		{
+			std::cerr << "Avdecc Controller Library was not compiled with Redundancy feature, which is required by " << hived::internals::applicationShortName.toStdString() << std::endl;
+			return 1;
+		}
+	}
+
+	// Build the daemon configuration
+	auto configuration = Daemon::Configuration{};
+	{
+		auto const protocolType = protocolTypeFromString(parser.value(protocolOption));
+		if (!protocolType)
+		{
+			std::cerr << "Unsupported protocol interface type: " << parser.value(protocolOption).toStdString() << std::endl;
+			return 1;
+		}
+		configuration.protocolType = *protocolType;
+		configuration.interfaceID = parser.value(interfaceOption);
+		if (configuration.interfaceID.isEmpty() && configuration.protocolType != la::avdecc::protocol::ProtocolInterface::Type::Virtual)
+		{
+			std::cerr << "A network interface is required for this protocol interface type" << std::endl;
+			return 1;
+		}
+
+		auto ok = false;
+		configuration.progID = parser.value(progIDOption).toUShort(&ok);
+		if (!ok)
+		{
+			std::cerr << "Invalid ProgID: " << parser.value(progIDOption).toStdString() << std::endl;
+			return 1;
+		}
+
+		configuration.snapshotFilePath = parser.value(snapshotOption);
+		configuration.binarySnapshot = !configuration.snapshotFilePath.endsWith(".json", Qt::CaseInsensitive);
+		auto const interval = parser.value(snapshotIntervalOption).toUInt(&ok);
+		if (!ok || interval == 0u)
+		{
+			std::cerr << "Invalid snapshot interval: " << parser.value(snapshotIntervalOption).toStdString() << std::endl;
+			return 1;
+		}
+		configuration.snapshotInterval = std::chrono::seconds{ interval };
+
+		configuration.filesToLoad = parser.values(ansFilesOption) + parser.values(aveFilesOption);
+	}
+
+	// Setup logging
+	auto const consoleLogger = ConsoleLogger{};
+	la::avdecc::logger::Logger::getInstance().setLevel(parser.isSet(verboseOption) ? la::avdecc::logger::Level::Trace : la::avdecc::logger::Level::Info);
+
+	// Cleanly exit on termination request
+	std::signal(SIGINT, &signalHandler);
+	std::signal(SIGTERM, &signalHandler);
+	auto terminationTimer = QTimer{};
+	QObject::connect(&terminationTimer, &QTimer::timeout, &app,
+		[]()
+		{
+			if (s_TerminationRequested)
+			{
+				QCoreApplication::quit();
+			}
+		});
+	terminationTimer.start(std::chrono::milliseconds{ 100 });
+
+	auto retValue = int{ 1 };
+	{
+		auto daemon = Daemon{ configuration };
+		if (daemon.start())
+		{
+			retValue = app.exec();
+
+			// Always leave an up-to-date snapshot behind
+			daemon.writeSnapshot();
+		}
+	}
+
+	// Destroy the controller before leaving main (so it's properly cleaned before all static variables are destroyed in a random order)
+	hive::modelsLibrary::ControllerManager::getInstance().destroyController();
+
+	// Return from main
+	return retValue;
+}